@@ -163,6 +163,10 @@ NC3_inq_var(int ncid, int varid, char *name,
 extern int
 NC3_inq_varid(int ncid, const char *name, int *varidp);
 
+extern int
+NC3_inq_var_offset(int ncid, int varid, long long *offsetp,
+	 long long *recstridep);
+
 extern int
 NC3_rename_var(int ncid, int varid, const char *name);
 
@@ -181,6 +181,13 @@ typedef struct NC_VAR_INFO
    int pixels_per_block;
    size_t chunk_cache_size, chunk_cache_nelems;
    float chunk_cache_preemption;
+   unsigned long long cache_accesses; /* Number of reads and writes of the var */
+   unsigned long long cache_hits;     /* Chunks estimated to have been found in the chunk cache */
+   unsigned long long cache_misses;   /* Chunks estimated to have been read from the file */
+   double cache_heat;           /* Recent access frequency, for sharing out the chunk cache budget */
+   size_t *last_chunk_box;      /* First and last chunk along each dim touched by the last access */
+   float extent_growth;         /* Factor by which unlimited extents are pre-grown, <= 1 disables */
+   hsize_t *logical_dims;       /* Lengths seen by the user, if the HDF5 extent was pre-grown */
 #ifdef USE_HDF4
    /* Stuff below is for hdf4 files. */
    int sdsid;
@@ -352,6 +359,8 @@ int nc4_rec_write_groups_types(NC_GRP_INFO_T *grp);
 int nc4_enddef_netcdf4_file(NC_HDF5_FILE_INFO_T *h5);
 int nc4_reopen_dataset(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var);
 int nc4_adjust_var_cache(NC_GRP_INFO_T *grp, NC_VAR_INFO_T * var);
+int nc4_chunk_cache_access(NC_VAR_INFO_T *var, const hsize_t *start, const hsize_t *count);
+int nc4_rec_trim_extents(NC_GRP_INFO_T *grp);
 
 /* The following functions manipulate the in-memory linked list of
    metadata, without using HDF calls. */
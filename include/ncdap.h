@@ -34,6 +34,7 @@ typedef unsigned int NCFLAGS;
 #define NCF_PREFETCH        (0x0200) /* Cache prefetch enabled/disabled */
 #define NCF_PREFETCH_EAGER  (0x0400) /* Do eager prefetch; 0=>lazy */
 #define NCF_PREFETCH_ALL    (0x0800) /* Prefetch all variables */
+#define NCF_BATCH           (0x1000) /* Defer partial variable fetches and batch them */
 /*COLUMBIA_HACK*/
 #define NCF_COLUMBIA        (0x80000000) /* Hack for columbia server */
 
@@ -140,6 +140,10 @@ extern int NCP_finalize(void);
 extern NC_Dispatch* NC4_dispatch_table;
 extern int NC4_initialize(void);
 extern int NC4_finalize(void);
+extern int NC4_inq_chunk_written(int ncid, int varid, const size_t *startp,
+                                 int *writtenp);
+struct NC_memio;
+extern int NC4_close_memio(int ncid, struct NC_memio *memio);
 #endif
 
 /* Vectors of ones and zeros */
@@ -180,6 +184,7 @@ extern int NCDEFAULT_get_varm(int, int, const size_t*,
 extern int NCDEFAULT_put_varm(int, int, const size_t*,
                const size_t*, const ptrdiff_t*, const ptrdiff_t*,
                const void*, nc_type);
+extern int NCDEFAULT_inq_var_offset(int, int, long long*, long long*);
 
 /**************************************************/
 /* Forward */
@@ -249,6 +254,8 @@ int (*inq_var_all)(int ncid, int varid, char *name, nc_type *xtypep,
 
 int (*var_par_access)(int, int, int);
 
+int (*inq_var_offset)(int, int, long long*, long long*);
+
 /* Note the following may still be invoked by netcdf client code
    even when the file is a classic file; they will just return an error or
    be ignored.
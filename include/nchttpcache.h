@@ -0,0 +1,66 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+#ifndef NCHTTPCACHE_H
+#define NCHTTPCACHE_H 1
+
+#include <stdio.h>
+#include <sys/types.h>
+#include "ncexternl.h"
+#include "ncbytes.h"
+
+/*
+A persistent, on-disk cache of http responses shared by the DAP2 and
+DAP4 clients and enabled by setting HTTP.CACHE.DIR in the rc file.
+
+Each response is keyed by its complete url, constraint included,
+and is kept as two files named by a hash of that url: <hash>.dat holds
+the raw response body and <hash>.url holds its Last-Modified time and
+the url itself (to detect hash collisions).  The caller revalidates an
+entry with a conditional GET (If-Modified-Since) and only uses the
+cached body if the server reports it unchanged.  Responses with no
+Last-Modified time cannot be revalidated and so are never cached.
+
+The mtime of the .url file records when an entry was last used; each
+store evicts least recently used entries until the bodies total no
+more than maxsize bytes.  Files are written under temporary names and
+renamed into place, so several processes may share one cache.
+*/
+
+/* Default limit on the size of the cache, in bytes */
+#define NCHTTPCACHE_MAXSIZE (1024ULL*1024ULL*1024ULL)
+
+typedef struct NChttpcache {
+    char* dir; /* cache directory; NULL => caching is off */
+    unsigned long long maxsize; /* limit on the total size of the bodies */
+} NChttpcache;
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__) || defined(__CPLUSPLUS)
+extern "C" {
+#endif
+
+/* Set up cache to use the directory dir (creating it if need be) and
+   hold at most maxsize bytes; maxsize == 0 => use the default */
+EXTERNL int nchttpcache_init(NChttpcache*, const char* dir, unsigned long long maxsize);
+EXTERNL void nchttpcache_clear(NChttpcache*);
+
+/* Return 1 and its Last-Modified time if url is cached, else 0 */
+EXTERNL int nchttpcache_lookup(NChttpcache*, const char* url, long* lastmodifiedp);
+
+/* Append the cached body for url to buf, or write it to stream (which
+   is rewound first), and mark the entry as just used */
+EXTERNL int nchttpcache_get(NChttpcache*, const char* url, NCbytes* buf);
+EXTERNL int nchttpcache_getfile(NChttpcache*, const char* url, FILE* stream, off_t* sizep);
+
+/* Cache the body for url, taken from the first len bytes of data or
+   from all of stream, and evict entries as needed */
+EXTERNL int nchttpcache_put(NChttpcache*, const char* url, long lastmodified, const char* data, size_t len);
+EXTERNL int nchttpcache_putfile(NChttpcache*, const char* url, long lastmodified, FILE* stream);
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__) || defined(__CPLUSPLUS)
+}
+#endif
+
+#endif /*NCHTTPCACHE_H*/
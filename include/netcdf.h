@@ -284,6 +284,14 @@ As a rule, NC_MAX_VAR_DIMS <= NC_MAX_DIMS.
 #define NC_CONTIGUOUS 1
 /**@}*/
 
+/** In HDF5 files you can describe how a variable will be read with
+ * nc_def_var_access(), and have chunk sizes chosen to suit. These
+ * flags may be or'ed together to balance several patterns. */
+/**@{*/
+#define NC_ACCESS_TIMESERIES 0x1 /**< All of the record (or first) dimension at one point. */
+#define NC_ACCESS_SLICE      0x2 /**< Whole slices across the last two dimensions. */
+/**@}*/
+
 /** In HDF5 files you can set check-summing for each variable.
 Currently the only checksum available is Fletcher-32, which can be set
 with the function nc_def_var_fletcher32.  These defines are used
@@ -848,6 +856,38 @@ nc_def_var_chunking(int ncid, int varid, int storage, const size_t *chunksizesp)
 EXTERNL int
 nc_inq_var_chunking(int ncid, int varid, int *storagep, size_t *chunksizesp);
 
+/* Choose chunking for a variable from how it will be read. This must
+   be done after nc_def_var and before nc_enddef. */
+EXTERNL int
+nc_def_var_access(int ncid, int varid, int pattern, size_t nslabs,
+		  const size_t *slabcountsp);
+
+/* Flag for nc_get_chunk_iter(): skip chunks holding only fill values;
+   for netCDF-4, chunks that were never written. */
+#define NC_CHUNK_ITER_SKIP_FILL 0x1
+
+/* Opaque iterator over the chunks of a variable. */
+typedef struct nc_chunk_iter nc_chunk_iter_t;
+
+/* Get an iterator over the chunk-aligned tiles of a variable. */
+EXTERNL int
+nc_get_chunk_iter(int ncid, int varid, int flags, nc_chunk_iter_t **iterpp);
+
+/* Get the start and count of the next tile, nvalues is 0 when done. */
+EXTERNL int
+nc_next_chunk_iter(nc_chunk_iter_t *iterp, size_t *startp, size_t *countp,
+		   size_t *nvaluesp);
+
+/* Release a chunk iterator. */
+EXTERNL int
+nc_free_chunk_iter(nc_chunk_iter_t *iterp);
+
+/* Get where a variable's data starts in a classic format file, and
+   the distance between its records. */
+EXTERNL int
+nc_inq_var_offset(int ncid, int varid, long long *offsetp,
+		  long long *recstridep);
+
 /* Define fill value behavior for a variable. This must be done after
    nc_def_var and before nc_enddef. */
 EXTERNL int
@@ -882,6 +922,27 @@ nc_set_chunk_cache(size_t size, size_t nelems, float preemption);
 EXTERNL int
 nc_get_chunk_cache(size_t *sizep, size_t *nelemsp, float *preemptionp);
 
+/* Set the total chunk cache size shared out among all open variables. */
+EXTERNL int
+nc_set_chunk_cache_budget(size_t budget);
+
+/* Get the total chunk cache size shared out among all open variables. */
+EXTERNL int
+nc_get_chunk_cache_budget(size_t *budgetp);
+
+/* Get estimated chunk cache statistics for a variable. */
+EXTERNL int
+nc_inq_var_chunk_cache_stats(int ncid, int varid, unsigned long long *accessesp,
+			     unsigned long long *hitsp, unsigned long long *missesp);
+
+/* Set the factor by which unlimited dimensions are pre-grown. */
+EXTERNL int
+nc_set_extent_growth(float factor);
+
+/* Get the factor by which unlimited dimensions are pre-grown. */
+EXTERNL int
+nc_get_extent_growth(float *factorp);
+
 /* Set the per-variable cache size, nelems, and preemption policy. */
 EXTERNL int
 nc_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems,
@@ -18,8 +18,20 @@
 extern "C" {
 #endif
 
+/* The image of an in-memory file, handed back by nc_close_memio(). */
+typedef struct NC_memio {
+    size_t size;  /* length of the image in bytes */
+    void* memory; /* the image, to be released with free() */
+} NC_memio;
+
 EXTERNL int nc_open_mem(const char* path, int mode, size_t size, void* memory, int* ncidp);
 
+/* Create a netCDF-4 file in memory, without touching the filesystem. */
+EXTERNL int nc_create_mem(const char* path, int mode, size_t initialsize, int* ncidp);
+
+/* Close an in-memory file, and hand back its final image. */
+EXTERNL int nc_close_memio(int ncid, NC_memio* memio);
+
 #if defined(__cplusplus)
 }
 #endif
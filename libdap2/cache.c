@@ -14,15 +14,21 @@ So this flag controls this. By default, it is on.
 #define GRADS_PREFETCH
 
 static int iscacheableconstraint(DCEconstraint* con);
+static int iscacheablesubset(DCEconstraint* con);
+static NCerror prefetchgroups(NCDAPCOMMON*, NClist*, size_t);
+static NCerror makecachenode(NCDAPCOMMON*, OCddsnode, DCEconstraint*, NClist*, int, NCcachenode**);
 
 /* Return 1 if we can reuse cached data to address
    the current get_vara request; return 0 otherwise.
    Target is in the constrained tree space.
-   Currently, if the target matches a cache that is not
-   a whole variable, then match is false.
+   Request, if not NULL, is the fetch projection that would
+   be used to get the requested part of target; a cache node
+   that is not a whole variable matches if one of its
+   projections contains the request.
 */
 int
-iscached(NCDAPCOMMON* nccomm, CDFnode* target, NCcachenode** cachenodep)
+iscached(NCDAPCOMMON* nccomm, CDFnode* target, DCEprojection* request,
+         NCcachenode** cachenodep)
 {
     int i,j,found,index;
     NCcache* cache;
@@ -46,15 +52,24 @@ iscached(NCDAPCOMMON* nccomm, CDFnode* target, NCcachenode** cachenodep)
 	}
     }
 
+    /* Walking a part of a sequence is not supported */
+    if(request != NULL && dapinsequence(target))
+	request = NULL;
+
     /*search other cache nodes starting at latest first */
     index = 0;
     for(i=nclistlength(cache->nodes)-1;i>=0;i--) {
         cachenode = (NCcachenode*)nclistget(cache->nodes,i);
-	/* We currently do not try to match constraints;
-           If the cachenode is constrained by more than
-           simple wholevariable projections, then skip it.
+	/* If the cachenode is constrained by more than simple
+           wholevariable projections, then it can only be used
+           if one of its projections contains the request.
         */
-	if(!cachenode->wholevariable) continue;
+	if(!cachenode->wholevariable) {
+	    if(request == NULL
+	       || !iscacheablesubset(cachenode->constraint)
+	       || dapcontainingprojection(cachenode->constraint->projections,request) == NULL)
+		continue;
+	}
         for(found=0,j=0;j<nclistlength(cachenode->vars);j++) {
             CDFnode* var = (CDFnode*)nclistget(cachenode->vars,j);
             if(var == target) {found=1;index=i;break;}
@@ -88,6 +103,11 @@ else
    1. All prefetches are whole variable fetches.
    2. If the data set is unconstrainable, we
       will prefetch the whole thing
+   3. If the prefetch is larger than the fetch limit and several
+      fetches can be in flight at once, the variables are split
+      into groups that are fetched concurrently;
+      the first group becomes the prefetch node and the others
+      are ordinary (whole variable) cache nodes.
 */
 NCerror
 prefetchdata(NCDAPCOMMON* nccomm)
@@ -141,6 +161,21 @@ nclog(NCLOGDBG,"prefetch: %s",var->ncfullname);
 	goto done;
     }
 
+    if(!FLAGSET(nccomm->controls,NCF_UNCONSTRAINABLE)
+       && FLAGSET(nccomm->controls,NCF_CACHE)
+       && dap_canfetchn(nccomm)) {
+	size_t ngroups, total = 0;
+	for(i=0;i<nclistlength(vars);i++)
+	    total += ((CDFnode*)nclistget(vars,i))->estimatedsize;
+	ngroups = (total + nccomm->cdf.fetchlimit - 1) / nccomm->cdf.fetchlimit;
+	if(ngroups > nccomm->cdf.concurrency) ngroups = nccomm->cdf.concurrency;
+	if(ngroups > nclistlength(vars)) ngroups = nclistlength(vars);
+	if(ngroups > 1) {
+	    ncstat = prefetchgroups(nccomm,vars,ngroups);
+	    goto done;
+	}
+    }
+
     /* Create a single constraint consisting of the projections for the variables;
        each projection is whole variable. The selections are passed on as is.
        Conditionally, The exception is if we are prefetching everything.
@@ -204,6 +239,79 @@ done:
     return THROW(ncstat);
 }
 
+/* Prefetch vars as ngroups concurrent fetches of about equal size */
+static NCerror
+prefetchgroups(NCDAPCOMMON* nccomm, NClist* vars, size_t ngroups)
+{
+    NCerror ncstat = NC_NOERR;
+    DCEconstraint* urlconstraint = nccomm->oc.dapconstraint;
+    DCEconstraint** constraints = NULL;
+    NClist** varlists = NULL;
+    NCcachenode** nodes = NULL;
+    size_t* sizes = NULL;
+    size_t i,g;
+
+    constraints = (DCEconstraint**)calloc(ngroups,sizeof(DCEconstraint*));
+    varlists = (NClist**)calloc(ngroups,sizeof(NClist*));
+    nodes = (NCcachenode**)calloc(ngroups,sizeof(NCcachenode*));
+    sizes = (size_t*)calloc(ngroups,sizeof(size_t));
+    if(constraints == NULL || varlists == NULL || nodes == NULL || sizes == NULL)
+	{ncstat = NC_ENOMEM; goto done;}
+    for(g=0;g<ngroups;g++) {
+	constraints[g] = (DCEconstraint*)dcecreate(CES_CONSTRAINT);
+	constraints[g]->projections = nclistnew();
+	constraints[g]->selections = dceclonelist(urlconstraint->selections);
+	varlists[g] = nclistnew();
+    }
+    /* Put each variable into the smallest group so far */
+    for(i=0;i<nclistlength(vars);i++) {
+        CDFnode* var = (CDFnode*)nclistget(vars,i);
+	DCEprojection* varprojection;
+	size_t smallest = 0;
+	for(g=1;g<ngroups;g++)
+	    if(sizes[g] < sizes[smallest]) smallest = g;
+	ncstat = dapvar2projection(var,&varprojection);
+	if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+	nclistpush(constraints[smallest]->projections,(void*)varprojection);
+	nclistpush(varlists[smallest],(void*)var);
+	sizes[smallest] += var->estimatedsize;
+    }
+if(SHOWFETCH) {
+for(g=0;g<ngroups;g++) {
+char* s = dumpprojections(constraints[g]->projections);
+LOG2(NCLOGNOTE,"prefetch.final[%lu]: %s",(unsigned long)g,s);
+nullfree(s);
+}
+}
+
+    ncstat = buildcachenodes(nccomm,ngroups,constraints,varlists,nodes,NCF_PREFETCH);
+    if(ncstat != NC_NOERR) goto done;
+    for(g=0;g<ngroups;g++) {
+	nodes[g]->wholevariable = 1; /* All prefetches are whole variable */
+	if(g == 0) {
+	    /* Make the first cache node be the prefetch node */
+	    nccomm->cdf.cache->prefetch = nodes[g];
+	} else {
+	    nodes[g]->isprefetch = 0;
+	    insertcachenode(nccomm,nodes[g]);
+	}
+    }
+if(SHOWFETCH) {
+LOG0(NCLOGNOTE,"prefetch.complete");
+}
+
+done:
+    for(g=0;g<ngroups;g++) {
+	if(constraints != NULL) dcefree((DCEnode*)constraints[g]);
+	if(varlists != NULL) nclistfree(varlists[g]);
+    }
+    nullfree(constraints);
+    nullfree(varlists);
+    nullfree(nodes);
+    nullfree(sizes);
+    return THROW(ncstat);
+}
+
 NCerror
 buildcachenode(NCDAPCOMMON* nccomm,
 	        DCEconstraint* constraint,
@@ -212,10 +320,8 @@ buildcachenode(NCDAPCOMMON* nccomm,
 		NCFLAGS flags)
 {
     NCerror ncstat = NC_NOERR;
-    OCerror ocstat = OC_NOERR;
     OClink conn = nccomm->oc.conn;
     OCddsnode ocroot = NULL;
-    CDFnode* dxdroot = NULL;
     NCcachenode* cachenode = NULL;
     char* ce = NULL;
     int isprefetch = 0;
@@ -232,6 +338,94 @@ buildcachenode(NCDAPCOMMON* nccomm,
     nullfree(ce);
     if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
 
+    ncstat = makecachenode(nccomm,ocroot,constraint,varlist,isprefetch,&cachenode);
+    constraint = NULL; /* makecachenode takes control of constraint */
+    if(ncstat) {THROWCHK(ncstat); goto done;}
+
+    /* Insert into the cache. If not caching, then
+       remove any previous cache node
+    */
+    if(!isprefetch)
+	insertcachenode(nccomm,cachenode);
+
+#ifdef DEBUG
+fprintf(stderr,"buildcachenode: %s\n",dumpcachenode(cachenode));
+#endif
+
+done:
+    if(constraint != NULL) dcefree((DCEnode*)constraint);
+    if(cachep) *cachep = cachenode;
+    return THROW(ncstat);
+}
+
+/* Like buildcachenode, but for n constraints whose responses are
+   fetched concurrently (see dap_fetchn). The cache nodes are not
+   inserted into the cache, so that none of them can be purged
+   before the caller is through with it; use insertcachenode.
+   Takes control of the constraints.
+*/
+NCerror
+buildcachenodes(NCDAPCOMMON* nccomm,
+		size_t n,
+	        DCEconstraint** constraints,
+		NClist** varlists,
+		NCcachenode** cachenodes,
+		NCFLAGS flags)
+{
+    NCerror ncstat = NC_NOERR;
+    OClink conn = nccomm->oc.conn;
+    OCddsnode* ocroots = NULL;
+    char** ces = NULL;
+    size_t i;
+    int isprefetch = ((flags & NCF_PREFETCH) != 0);
+
+    for(i=0;i<n;i++) cachenodes[i] = NULL;
+    ocroots = (OCddsnode*)calloc(n,sizeof(OCddsnode));
+    ces = (char**)calloc(n,sizeof(char*));
+    if(ocroots == NULL || ces == NULL) {ncstat = NC_ENOMEM; goto done;}
+    for(i=0;i<n;i++)
+        ces[i] = dcebuildconstraintstring(constraints[i]);
+
+    ncstat = dap_fetchn(nccomm,conn,n,(const char**)ces,ocroots);
+    if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+
+    for(i=0;i<n;i++) {
+	ncstat = makecachenode(nccomm,ocroots[i],constraints[i],varlists[i],
+			       isprefetch,&cachenodes[i]);
+	constraints[i] = NULL; /* makecachenode takes control of constraint */
+	ocroots[i] = NULL;
+	if(ncstat) {THROWCHK(ncstat); goto done;}
+    }
+
+done:
+    for(i=0;i<n;i++) {
+	if(constraints[i] != NULL) dcefree((DCEnode*)constraints[i]);
+	constraints[i] = NULL;
+	if(ces != NULL) nullfree(ces[i]);
+	if(ocroots != NULL && ocroots[i] != NULL)
+	    oc_root_free(conn,ocroots[i]);
+	if(ncstat != NC_NOERR) {
+	    freenccachenode(nccomm,cachenodes[i]);
+	    cachenodes[i] = NULL;
+	}
+    }
+    nullfree(ces);
+    nullfree(ocroots);
+    return THROW(ncstat);
+}
+
+/* Build a cache node from a fetched DATADDS; takes control of
+   constraint. */
+static NCerror
+makecachenode(NCDAPCOMMON* nccomm, OCddsnode ocroot, DCEconstraint* constraint,
+	      NClist* varlist, int isprefetch, NCcachenode** cachep)
+{
+    NCerror ncstat = NC_NOERR;
+    OCerror ocstat = OC_NOERR;
+    OClink conn = nccomm->oc.conn;
+    CDFnode* dxdroot = NULL;
+    NCcachenode* cachenode = NULL;
+
     ncstat = buildcdftree(nccomm,ocroot,OCDATA,&dxdroot);
     if(ncstat) {THROWCHK(ncstat); goto done;}
 
@@ -264,41 +458,6 @@ buildcachenode(NCDAPCOMMON* nccomm,
 #ifdef DEBUG
 fprintf(stderr,"buildcachenode: new cache node: %s\n",
 	dumpcachenode(cachenode));
-#endif
-    /* Insert into the cache. If not caching, then
-       remove any previous cache node
-    */
-    if(!isprefetch) {
-	NCcache* cache = nccomm->cdf.cache;
-	if(cache->nodes == NULL) cache->nodes = nclistnew();
-	/* remove cache nodes to get below the max cache size */
-	while(cache->cachesize + cachenode->xdrsize > cache->cachelimit
-	      && nclistlength(cache->nodes) > 0) {
-	    NCcachenode* node = (NCcachenode*)nclistremove(cache->nodes,0);
-#ifdef DEBUG
-fprintf(stderr,"buildcachenode: purge cache node: %s\n",
-	dumpcachenode(cachenode));
-#endif
-	    cache->cachesize -= node->xdrsize;
-	    freenccachenode(nccomm,node);
-	}
-	/* Remove cache nodes to get below the max cache count */
-	/* If not caching, then cachecount should be 0 */
-	while(nclistlength(cache->nodes) > cache->cachecount) {
-	    NCcachenode* node = (NCcachenode*)nclistremove(cache->nodes,0);
-#ifdef DEBUG
-fprintf(stderr,"buildcachenode: count purge cache node: %s\n",
-	dumpcachenode(node));
-#endif
-	    cache->cachesize -= node->xdrsize;
-	    freenccachenode(nccomm,node);
-        }
-        nclistpush(nccomm->cdf.cache->nodes,(void*)cachenode);
-        cache->cachesize += cachenode->xdrsize;
-    }
-
-#ifdef DEBUG
-fprintf(stderr,"buildcachenode: %s\n",dumpcachenode(cachenode));
 #endif
 
 done:
@@ -306,13 +465,48 @@ done:
     if(cachep) *cachep = cachenode;
     if(ocstat != OC_NOERR) ncstat = ocerrtoncerr(ocstat);
     if(ncstat != OC_NOERR) {
-	freecdfroot(dxdroot);
+	if(cachenode == NULL || cachenode->datadds != dxdroot)
+	    freecdfroot(dxdroot);
 	freenccachenode(nccomm,cachenode);
 	if(cachep) *cachep = NULL;
     }
     return THROW(ncstat);
 }
 
+/* Insert a cache node, purging the least recently used nodes
+   to stay within the cache limits */
+void
+insertcachenode(NCDAPCOMMON* nccomm, NCcachenode* cachenode)
+{
+    NCcache* cache = nccomm->cdf.cache;
+    if(cache->nodes == NULL) cache->nodes = nclistnew();
+    /* remove cache nodes to get below the max cache size */
+    while(cache->cachesize + cachenode->xdrsize > cache->cachelimit
+	  && nclistlength(cache->nodes) > 0) {
+	NCcachenode* node = (NCcachenode*)nclistremove(cache->nodes,0);
+#ifdef DEBUG
+fprintf(stderr,"buildcachenode: purge cache node: %s\n",
+	dumpcachenode(cachenode));
+#endif
+	cache->cachesize -= node->xdrsize;
+	freenccachenode(nccomm,node);
+    }
+    /* Remove cache nodes to get below the max cache count;
+       normally only limited when fetching to disk.
+       If not caching, then cachecount should be 0 */
+    while(nclistlength(cache->nodes) > cache->cachecount) {
+	NCcachenode* node = (NCcachenode*)nclistremove(cache->nodes,0);
+#ifdef DEBUG
+fprintf(stderr,"buildcachenode: count purge cache node: %s\n",
+	dumpcachenode(node));
+#endif
+	cache->cachesize -= node->xdrsize;
+	freenccachenode(nccomm,node);
+    }
+    nclistpush(cache->nodes,(void*)cachenode);
+    cache->cachesize += cachenode->xdrsize;
+}
+
 NCcachenode*
 createnccachenode(void)
 {
@@ -389,6 +583,17 @@ iscacheableconstraint(DCEconstraint* con)
     return 1;
 }
 
+/* Can the data for a part of a variable be extracted from
+   a cache node built with this constraint? (see nc3d_getvarx) */
+static int
+iscacheablesubset(DCEconstraint* con)
+{
+    if(con == NULL) return 0;
+    if(con->selections != NULL && nclistlength(con->selections) > 0)
+	return 0; /* cant deal with selections */
+    return 1;
+}
+
 /*
 A variable is prefetchable if
 1. it is atomic
@@ -838,6 +838,103 @@ fprintf(stderr,"dapshiftprojection.after: %s\n",dumpprojection(projection));
     return ncstat;
 }
 
+/* Does outer select every element that slice selects? */
+static int
+dapslicecontains(DCEslice* outer, DCEslice* slice)
+{
+    size_t slicelast, outerlast;
+    if(slice->count == 0) return 1;
+    if(outer->count == 0) return 0;
+    slicelast = slice->first + (slice->count - 1) * slice->stride;
+    outerlast = outer->first + (outer->count - 1) * outer->stride;
+    if(slice->first < outer->first || slicelast > outerlast) return 0;
+    if(((slice->first - outer->first) % outer->stride) != 0) return 0;
+    if(slice->count > 1 && (slice->stride % outer->stride) != 0) return 0;
+    return 1;
+}
+
+/* Return 1 if outer and projection name the same variable
+   and the slices of outer cover every element selected
+   by the slices of projection.
+*/
+int
+dapcontainsprojection(DCEprojection* outer, DCEprojection* projection)
+{
+    int i,j;
+    NClist* osegments;
+    NClist* segments;
+
+    if(outer->discrim != CES_VAR || projection->discrim != CES_VAR)
+	return 0;
+    if(outer->var->annotation != projection->var->annotation)
+	return 0;
+    osegments = outer->var->segments;
+    segments = projection->var->segments;
+    if(nclistlength(osegments) != nclistlength(segments))
+	return 0;
+    for(i=0;i<nclistlength(segments);i++) {
+	DCEsegment* oseg = (DCEsegment*)nclistget(osegments,i);
+	DCEsegment* seg = (DCEsegment*)nclistget(segments,i);
+	if(oseg->rank != seg->rank) return 0;
+        for(j=0;j<seg->rank;j++) {
+	    if(!dapslicecontains(oseg->slices+j,seg->slices+j))
+		return 0;
+	}
+    }
+    return 1;
+}
+
+/* Return the projection in the list that contains projection, or NULL */
+DCEprojection*
+dapcontainingprojection(NClist* projections, DCEprojection* projection)
+{
+    int i;
+    for(i=0;i<nclistlength(projections);i++) {
+	DCEprojection* outer = (DCEprojection*)nclistget(projections,i);
+	if(dapcontainsprojection(outer,projection))
+	    return outer;
+    }
+    return NULL;
+}
+
+/* Rewrite the walk projection so that it addresses the data
+   fetched using outer, which must contain projection (see
+   dapcontainsprojection). Projection and outer have had their
+   pseudo dimensions removed; walk is a shifted vara projection
+   of the same variable, so any pseudo dimensions are left alone.
+*/
+int
+daprebaseprojection(DCEprojection* walk, DCEprojection* projection, DCEprojection* outer)
+{
+    int i,j;
+    NClist* wsegments = walk->var->segments;
+    NClist* osegments = outer->var->segments;
+    NClist* segments = projection->var->segments;
+
+    ASSERT(nclistlength(wsegments) == nclistlength(segments));
+    for(i=0;i<nclistlength(segments);i++) {
+	DCEsegment* wseg = (DCEsegment*)nclistget(wsegments,i);
+	DCEsegment* oseg = (DCEsegment*)nclistget(osegments,i);
+	DCEsegment* seg = (DCEsegment*)nclistget(segments,i);
+	ASSERT(wseg->rank >= seg->rank);
+        for(j=0;j<seg->rank;j++) {
+	    DCEslice* wslice = wseg->slices+j;
+	    DCEslice* oslice = oseg->slices+j;
+	    DCEslice* slice = seg->slices+j;
+	    wslice->first = (slice->first - oslice->first) / oslice->stride;
+	    wslice->stride = (slice->count > 1 ? slice->stride / oslice->stride : 1);
+	    wslice->count = slice->count;
+	    wslice->length = wslice->count * wslice->stride;
+	    wslice->last = (wslice->first + wslice->length) - 1;
+	    wslice->declsize = oslice->count;
+	}
+    }
+#ifdef DEBUG1
+fprintf(stderr,"daprebaseprojection: %s\n",dumpprojection(walk));
+#endif
+    return NC_NOERR;
+}
+
 /* Compute the set of variables referenced in the projections
    of the input constraint.
 */
@@ -26,5 +26,8 @@ extern NCerror dapfixprojections(NClist* list);
 extern int dapvar2projection(CDFnode* var, DCEprojection** projectionp);
 extern int daprestrictprojection(NClist* projections, DCEprojection* var, DCEprojection** resultp);
 extern int dapshiftprojection(DCEprojection*);
+extern int dapcontainsprojection(DCEprojection* outer, DCEprojection* projection);
+extern DCEprojection* dapcontainingprojection(NClist* projections, DCEprojection* projection);
+extern int daprebaseprojection(DCEprojection* walk, DCEprojection* projection, DCEprojection* outer);
 
 #endif /*CONSTRAINTS_H*/
@@ -87,6 +87,8 @@ extern NCerror nc3d_getvarx(int ncid, int varid,
 	    const ptrdiff_t *stridep,
 	    void *data,
 	    nc_type dsttype0);
+extern NCerror nc3d_flushbatch(NCDAPCOMMON*);
+extern void nc3d_discardbatch(NCDAPCOMMON*);
 
 /**************************************************/
 
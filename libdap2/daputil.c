@@ -738,6 +738,76 @@ oc_dumpnode(conn,*rootp);
     return ncstat;
 }
 
+/* Can a fetch be split into several that are in flight at once? */
+int
+dap_canfetchn(NCDAPCOMMON* nccomm)
+{
+    OCflags flags = 0;
+    if(nccomm->cdf.concurrency <= 1)
+	return 0;
+    if(FLAGSET(nccomm->controls,NCF_ONDISK))
+	flags |= OCONDISK;
+    return oc_fetchn_concurrent(nccomm->oc.conn,flags);
+}
+
+/* Provide a wrapper for oc_fetchn so we can log what it does;
+   the n DATADDS requests are sent concurrently when possible. */
+NCerror
+dap_fetchn(NCDAPCOMMON* nccomm, OClink conn, size_t n, const char** ces,
+           OCddsnode* roots)
+{
+    NCerror ncstat = NC_NOERR;
+    OCerror ocstat = OC_NOERR;
+    OCflags flags = 0;
+    int httpcode = 0;
+    size_t i;
+
+    if(FLAGSET(nccomm->controls,NCF_ONDISK)) {
+	flags |= OCONDISK;
+    }
+
+    if(SHOWFETCH) {
+	/* Build uri string minus the constraint and #tag */
+	char* baseurl = ncuribuild(nccomm->oc.url,NULL,".dods",NCURIBASE);
+	for(i=0;i<n;i++)
+            LOG2(NCLOGNOTE,"fetch: %s?%s",baseurl,ces[i]);
+	nullfree(baseurl);
+#ifdef HAVE_GETTIMEOFDAY
+	gettimeofday(&time0,NULL);
+#endif
+    }
+    ocstat = oc_fetchn(conn,n,ces,flags,roots);
+    if(FLAGSET(nccomm->controls,NCF_SHOWFETCH)) {
+#ifdef HAVE_GETTIMEOFDAY
+        double secs;
+	gettimeofday(&time1,NULL);
+	secs = deltatime();
+	nclog(NCLOGNOTE,"fetch complete: %0.3f secs",secs);
+#else
+	nclog(NCLOGNOTE,"fetch complete.");
+#endif
+    }
+
+    /* Look at the HTTP return code */
+    httpcode = oc_httpcode(conn);
+    if(httpcode < 400) {
+        ncstat = ocerrtoncerr(ocstat);
+    } else if(httpcode >= 500) {
+        ncstat = NC_EDAPSVC;
+    } else if(httpcode == 401) {
+	ncstat = NC_EAUTH;
+    } else if(httpcode == 404) {
+	ncstat = NC_ENOTFOUND;
+    } else {
+	ncstat = NC_EACCESS;
+    }
+    if(ncstat != NC_NOERR && ocstat == OC_NOERR) {
+	for(i=0;i<n;i++)
+	    {oc_root_free(conn,roots[i]); roots[i] = NULL;}
+    }
+    return ncstat;
+}
+
 /* Check a name to see if it contains illegal dap characters
 */
 
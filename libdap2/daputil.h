@@ -67,6 +67,8 @@ extern size_t dapdimproduct(NClist* dimensions);
 
 /* Provide a wrapper for oc_fetch so we can log what it does */
 extern NCerror dap_fetch(struct NCDAPCOMMON*,OClink,const char*,OCdxd,OCobject*);
+extern int dap_canfetchn(struct NCDAPCOMMON*);
+extern NCerror dap_fetchn(struct NCDAPCOMMON*,OClink,size_t,const char**,OCobject*);
 
 extern int dap_badname(char* name);
 extern char* dap_repairname(char* name);
@@ -12,6 +12,13 @@
 
 #define NEWVARM
 
+/* Max size of the buffer used to convert (or pick out the strided
+   elements of) a run of data during extraction */
+#define EXTRACTBUFSIZE (64*1024)
+/* A run of the last dimension with a larger stride than this is read
+   one element at a time, rather than reading all of the span it covers */
+#define MAXGATHERSTRIDE 8
+
 static DCEnode* save = NULL;
 
 /* Define a tracker for memory to support*/
@@ -40,6 +47,10 @@ static int extractstring(NCDAPCOMMON*, Getvara*, CDFnode*, DCEsegment*, size_t d
 static void freegetvara(Getvara* vara);
 static NCerror makegetvar(NCDAPCOMMON*, CDFnode*, void*, nc_type, Getvara**);
 static NCerror attachsubset(CDFnode* target, CDFnode* pattern);
+static int isbatched(NCDAPCOMMON*, CDFnode* var);
+static int isbatchable(DCEprojection* fetchprojection);
+static size_t slabcount(NCDAPCOMMON*, CDFnode* var, DCEprojection* fetchprojection);
+static NCerror fetchslabs(NCDAPCOMMON*, Getvara*, NClist* vars, DCEprojection* fetchprojection, DCEprojection* walkprojection, size_t nslabs);
 
 /**************************************************/
 /**
@@ -65,6 +76,9 @@ b. The target variable (as specified in nc_get_vara())
    that it might be part of the prefetch mixed in with other prefetched
    variables.
 	   fetchprojection = N.A. since variable is in the cache
+b'. The part of the target variable requested by nc_get_vara()
+   is contained in the slices of a cached constrained variable.
+	   fetchprojection = N.A. since the part is in the cache
 c. Vara is requesting part of a variable but NCF_WHOLEVAR flag is set.
 	   fetchprojection = unsliced vara variable => fetch whole variable
 d. Vara is requesting part of a variable and NCF_WHOLEVAR flag is not set.
@@ -85,6 +99,13 @@ d. Vara is requesting part of a variable and NCF_WHOLEVAR flag is not set.
        from the vara projection that will properly access the cached data.
        This walk projection shifts the merged projection so all slices
        start at 0 and have a stride of 1.
+   For case b', the shifted walk projection is rebased onto the
+       slices of the cached projection, so the odometer walks
+       only the requested elements of the cached data.
+
+4. If the "batch" parameter was given, then a case d request is
+   not fetched at once; instead it is queued and the queued requests
+   are later fetched together (see nc3d_flushbatch).
 */
 
 NCerror
@@ -121,6 +142,7 @@ nc3d_getvarx(int ncid, int varid,
 #define FETCHVAR   2 /* fetch whole variable */
 #define FETCHPART  4 /* fetch constrained variable */
 #define CACHED     8 /* whole variable is already in the cache */
+#define CACHEDPART 16 /* a cached constrained variable contains the request */
 
     ncstat = NC_check_id(ncid, (NC**)&drno);
     if(ncstat != NC_NOERR) goto fail;
@@ -269,16 +291,40 @@ fprintf(stderr,"getvarx: walkprojection: |%s|\n",dumpprojection(walkprojection))
     vars = nclistnew();
     nclistpush(vars,(void*)varainfo->target);
 
+    /* A constraint can only project a variable once, so reading
+       a variable that is already queued completes the batch */
+    if(FLAGSET(dapcomm->controls,NCF_BATCH) && isbatched(dapcomm,cdfvar)) {
+        ncstat = nc3d_flushbatch(dapcomm);
+        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto fail;}
+    }
+
+    /* If we would fetch part of the variable, then compute the
+       fetch projection now so a cached part can be matched against it */
+    if(!FLAGSET(dapcomm->controls,NCF_UNCONSTRAINABLE)
+       && !FLAGSET(dapcomm->controls,NCF_WHOLEVAR)) {
+        /* Create fetch projection as the merge of the url projections
+           and the vara projection */
+        ncstat = daprestrictprojection(dapcomm->oc.dapconstraint->projections,
+				       varaprojection,&fetchprojection);
+        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto fail;}
+	/* elide any sequence and string dimensions (dap servers do not allow such). */
+	ncstat = removepseudodims(fetchprojection);
+        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto fail;}
+    }
+
     state = 0;
-    if(iscached(dapcomm,cdfvar,&cachenode)) { /* ignores non-whole variable cache entries */
-	state = CACHED;
+    if(iscached(dapcomm,cdfvar,fetchprojection,&cachenode)) {
 	ASSERT((cachenode != NULL));
 #ifdef DEBUG
 fprintf(stderr,"var is in cache\n");
 #endif
-        /* If it is cached, then it is a whole variable but may still
-           need to apply constraints during the walk */
-	ASSERT(cachenode->wholevariable); /* by construction */
+        /* If it is cached as a whole variable, then we may still
+           need to apply constraints during the walk; otherwise
+           the cached part contains the request */
+	if(cachenode->wholevariable)
+	    state = CACHED;
+	else
+	    state = CACHEDPART;
     } else if(FLAGSET(dapcomm->controls,NCF_UNCONSTRAINABLE)) {
 	state = FETCHWHOLE;
     } else {/* load using constraints */
@@ -289,6 +335,27 @@ fprintf(stderr,"var is in cache\n");
     }
     ASSERT(state != 0);
 
+    if(state == FETCHPART && FLAGSET(dapcomm->controls,NCF_BATCH)
+       && isbatchable(fetchprojection)) {
+	/* Queue the request with its walk projection; the data
+           is not available until the batch is flushed */
+	dcefree((DCEnode*)walkprojection) ; /* reclaim any existing walkprojection */
+	walkprojection = (DCEprojection*)dceclone((DCEnode*)varaprojection);
+        dapshiftprojection(walkprojection);
+	varainfo->varaprojection = walkprojection;
+	walkprojection = NULL;
+	varainfo->fetchprojection = fetchprojection;
+	fetchprojection = NULL;
+	if(dapcomm->cdf.batch == NULL) dapcomm->cdf.batch = nclistnew();
+	nclistpush(dapcomm->cdf.batch,(void*)varainfo);
+	varainfo = NULL;
+	if(nclistlength(dapcomm->cdf.batch) >= dapcomm->cdf.batchlimit) {
+	    ncstat = nc3d_flushbatch(dapcomm);
+	    if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto fail;}
+	}
+	goto fail; /* cleanup */
+    }
+
     switch (state) {
 
     case FETCHWHOLE: {
@@ -313,6 +380,25 @@ fprintf(stderr,"getvarx: FETCHWHOLE: fetchconstraint: %s\n",dumpconstraint(fetch
     case CACHED: {
     } break;
 
+    case CACHEDPART: {
+	DCEprojection* cachedprojection;
+	/* Walk the requested part of the cached data: shift the
+           vara projection and then rebase it onto the slices
+           that were used to fetch the cache node. */
+	cachedprojection = dapcontainingprojection(cachenode->constraint->projections,
+						   fetchprojection);
+	ASSERT(cachedprojection != NULL);
+	dcefree((DCEnode*)walkprojection) ; /* reclaim any existing walkprojection */
+	walkprojection = (DCEprojection*)dceclone((DCEnode*)varaprojection);
+        dapshiftprojection(walkprojection);
+	ncstat = daprebaseprojection(walkprojection,fetchprojection,cachedprojection);
+        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto fail;}
+	varainfo->partial = 1;
+#ifdef DEBUG
+        fprintf(stderr,"getvarx: CACHEDPART: walkprojection: |%s|\n",dumpprojection(walkprojection));
+#endif
+    } break;
+
     case FETCHVAR: { /* Fetch a complete single variable */
         /* Create fetch projection as the merge of the url projections
            and the vara projection */
@@ -336,6 +422,7 @@ fprintf(stderr,"getvarx: FETCHWHOLE: fetchconstraint: %s\n",dumpconstraint(fetch
 	/* and the created fetch projection */
         fetchconstraint->projections = nclistnew();
         nclistpush(fetchconstraint->projections,(void*)fetchprojection);
+	fetchprojection = NULL; /* fetchconstraint takes control of fetchprojection */
 #ifdef DEBUG
 fprintf(stderr,"getvarx: FETCHVAR: fetchconstraint: %s\n",dumpconstraint(fetchconstraint));
 #endif
@@ -348,13 +435,8 @@ fprintf(stderr,"getvarx: FETCHVAR: fetchconstraint: %s\n",dumpconstraint(fetchco
     } break;
 
     case FETCHPART: {
-        /* Create fetch projection as the merge of the url projections
-           and the vara projection */
-        ncstat = daprestrictprojection(dapcomm->oc.dapconstraint->projections,
-				       varaprojection,&fetchprojection);
-	/* elide any sequence and string dimensions (dap servers do not allow such). */
-	ncstat = removepseudodims(fetchprojection);
-        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto fail;}
+	/* The fetch projection was computed above */
+	ASSERT(fetchprojection != NULL);
 
 	/* Shift the varaprojection for simple walk */
 	dcefree((DCEnode*)walkprojection) ; /* reclaim any existing walkprojection */
@@ -365,6 +447,17 @@ fprintf(stderr,"getvarx: FETCHVAR: fetchconstraint: %s\n",dumpconstraint(fetchco
         fprintf(stderr,"getvarx: FETCHPART: fetchprojection: |%s|\n",dumpprojection(fetchprojection));
 #endif
 
+	/* A large request is fetched as several slabs that are
+           in flight at once */
+	{
+	    size_t nslabs = slabcount(dapcomm,cdfvar,fetchprojection);
+	    if(nslabs > 1) {
+		ncstat = fetchslabs(dapcomm,varainfo,vars,fetchprojection,
+				    walkprojection,nslabs);
+		goto fail; /* cleanup */
+	    }
+	}
+
         /* Build the complete constraint to use in the fetch */
         fetchconstraint = (DCEconstraint*)dcecreate(CES_CONSTRAINT);
         /* merged constraint just uses the url constraint selection */
@@ -372,6 +465,7 @@ fprintf(stderr,"getvarx: FETCHVAR: fetchconstraint: %s\n",dumpconstraint(fetchco
 	/* and the created fetch projection */
         fetchconstraint->projections = nclistnew();
         nclistpush(fetchconstraint->projections,(void*)fetchprojection);
+	fetchprojection = NULL; /* fetchconstraint takes control of fetchprojection */
 #ifdef DEBUG
         fprintf(stderr,"getvarx: FETCHPART: fetchconstraint: %s\n",dumpconstraint(fetchconstraint));
 #endif
@@ -420,11 +514,252 @@ fail:
     if(vars != NULL) nclistfree(vars);
     if(varaprojection != NULL) dcefree((DCEnode*)varaprojection);
     if(fetchconstraint != NULL) dcefree((DCEnode*)fetchconstraint);
+    if(fetchprojection != NULL) dcefree((DCEnode*)fetchprojection);
+    if(walkprojection != NULL) dcefree((DCEnode*)walkprojection);
     if(varainfo != NULL) freegetvara(varainfo);
     if(ocstat != OC_NOERR) ncstat = ocerrtoncerr(ocstat);
     return THROW(ncstat);
 }
 
+/* Fetch all the queued (batched) get_vara requests using a
+   single constraint that contains all of their fetch projections,
+   then fill in each request's memory from the new cache node.
+   The requests were accepted when they were queued, so one that
+   cannot be filled in does not stop the rest; the first error is
+   returned to the caller that flushed the batch.
+*/
+NCerror
+nc3d_flushbatch(NCDAPCOMMON* dapcomm)
+{
+    NCerror ncstat = NC_NOERR;
+    int i;
+    NClist* batch = dapcomm->cdf.batch;
+    NClist* vars = NULL;
+    DCEconstraint* fetchconstraint = NULL;
+    NCcachenode* cachenode = NULL;
+
+    if(nclistlength(batch) == 0) return NC_NOERR;
+    dapcomm->cdf.batch = NULL; /* in case we are re-entered */
+
+    /* Build the complete constraint to use in the fetch */
+    fetchconstraint = (DCEconstraint*)dcecreate(CES_CONSTRAINT);
+    fetchconstraint->selections = dceclonelist(dapcomm->oc.dapconstraint->selections);
+    fetchconstraint->projections = nclistnew();
+    vars = nclistnew();
+    for(i=0;i<nclistlength(batch);i++) {
+	Getvara* varainfo = (Getvara*)nclistget(batch,i);
+        nclistpush(fetchconstraint->projections,(void*)varainfo->fetchprojection);
+	varainfo->fetchprojection = NULL; /* fetchconstraint takes control */
+	nclistpush(vars,(void*)varainfo->target);
+    }
+#ifdef DEBUG
+fprintf(stderr,"flushbatch: fetchconstraint: %s\n",dumpconstraint(fetchconstraint));
+#endif
+    ncstat = buildcachenode(dapcomm,fetchconstraint,vars,&cachenode,0);
+    fetchconstraint = NULL; /*buildcachenode takes control of fetchconstraint.*/
+    if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+
+    /* attach DATADDS to (constrained) DDS */
+    unattach(dapcomm->cdf.ddsroot);
+    ncstat = attachsubset(cachenode->datadds,dapcomm->cdf.ddsroot);
+    if(ncstat) goto done;
+
+    for(i=0;i<nclistlength(batch);i++) {
+	Getvara* varainfo = (Getvara*)nclistget(batch,i);
+	CDFnode* xtarget = varainfo->target->attachment;
+	NCerror movestat;
+	if(xtarget == NULL)
+	    movestat = NC_ENODATA;
+	else {
+	    varainfo->cache = cachenode;
+	    varainfo->target = xtarget; /* Switch to datadds tree space*/
+	    movestat = moveto(dapcomm,varainfo,cachenode->datadds,varainfo->memory);
+	}
+	if(movestat != NC_NOERR) {
+	    THROWCHK(movestat);
+	    if(ncstat == NC_NOERR) ncstat = movestat;
+	}
+    }
+
+done:
+    for(i=0;i<nclistlength(batch);i++)
+	freegetvara((Getvara*)nclistget(batch,i));
+    nclistfree(batch);
+    nclistfree(vars);
+    return THROW(ncstat);
+}
+
+/* Drop any queued get_vara requests without fetching them */
+void
+nc3d_discardbatch(NCDAPCOMMON* dapcomm)
+{
+    int i;
+    NClist* batch = dapcomm->cdf.batch;
+    dapcomm->cdf.batch = NULL;
+    for(i=0;i<nclistlength(batch);i++)
+	freegetvara((Getvara*)nclistget(batch,i));
+    nclistfree(batch);
+}
+
+/* Is there a queued get_vara request for this variable? */
+static int
+isbatched(NCDAPCOMMON* dapcomm, CDFnode* var)
+{
+    int i;
+    NClist* batch = dapcomm->cdf.batch;
+    for(i=0;i<nclistlength(batch);i++) {
+	Getvara* varainfo = (Getvara*)nclistget(batch,i);
+	if(varainfo->target == var) return 1;
+    }
+    return 0;
+}
+
+/* Only variables that are not inside a dimensioned structure
+   are batched, since projections of two fields could otherwise
+   ask for different parts of the same structure array */
+static int
+isbatchable(DCEprojection* fetchprojection)
+{
+    int i;
+    NClist* segments = fetchprojection->var->segments;
+    for(i=0;i<nclistlength(segments)-1;i++) {
+	DCEsegment* segment = (DCEsegment*)nclistget(segments,i);
+	if(segment->rank > 0) return 0;
+    }
+    return 1;
+}
+
+/* Into how many slabs of its first dimension should the fetch
+   of a top level variable be split, so that the slabs can be fetched
+   concurrently? Each slab is about the fetch limit or less, unless
+   there would be more slabs than the allowed concurrency. */
+static size_t
+slabcount(NCDAPCOMMON* dapcomm, CDFnode* var, DCEprojection* fetchprojection)
+{
+    int i;
+    size_t nslabs, size;
+    NClist* segments = fetchprojection->var->segments;
+    DCEsegment* segment;
+
+    /* Don't split a fetch whose parts would go out one at a time */
+    if(!dap_canfetchn(dapcomm) || nclistlength(segments) != 1)
+	return 1;
+    /* Strings have a pseudo dimension that the fetch does not */
+    if(var->etype == NC_STRING || var->etype == NC_URL)
+	return 1;
+    segment = (DCEsegment*)nclistget(segments,0);
+    if(segment->rank == 0)
+	return 1;
+    size = nctypesizeof(var->etype);
+    for(i=0;i<segment->rank;i++)
+	size *= segment->slices[i].count;
+    nslabs = (size + dapcomm->cdf.fetchlimit - 1) / dapcomm->cdf.fetchlimit;
+    if(nslabs > dapcomm->cdf.concurrency) nslabs = dapcomm->cdf.concurrency;
+    if(nslabs > segment->slices[0].count) nslabs = segment->slices[0].count;
+    return (nslabs == 0 ? 1 : nslabs);
+}
+
+/* Fetch the request as nslabs concurrent fetches, each of a slab of
+   the first dimension of fetchprojection, and fill in the request's
+   memory from each slab in turn. The slabs are cached only after they
+   have all been walked, so that none of them can be purged early. */
+static NCerror
+fetchslabs(NCDAPCOMMON* dapcomm, Getvara* varainfo, NClist* vars,
+	   DCEprojection* fetchprojection, DCEprojection* walkprojection,
+	   size_t nslabs)
+{
+    NCerror ncstat = NC_NOERR;
+    DCEconstraint** constraints = NULL;
+    NClist** varlists = NULL;
+    NCcachenode** nodes = NULL;
+    DCEprojection* walk;
+    CDFnode* target = varainfo->target;
+    char* memory = (char*)varainfo->memory;
+    DCEsegment* fseg = (DCEsegment*)nclistget(fetchprojection->var->segments,0);
+    DCEsegment* wseg = (DCEsegment*)nclistget(walkprojection->var->segments,0);
+    size_t rowsize = nctypesizeof(varainfo->dsttype);
+    size_t total = fseg->slices[0].count;
+    size_t j,row;
+    int i;
+
+    /* Bytes of memory per index of the first dimension */
+    for(i=1;i<wseg->rank;i++)
+	rowsize *= wseg->slices[i].count;
+
+    constraints = (DCEconstraint**)calloc(nslabs,sizeof(DCEconstraint*));
+    varlists = (NClist**)calloc(nslabs,sizeof(NClist*));
+    nodes = (NCcachenode**)calloc(nslabs,sizeof(NCcachenode*));
+    if(constraints == NULL || varlists == NULL || nodes == NULL)
+	{ncstat = NC_ENOMEM; goto done;}
+    for(row=0,j=0;j<nslabs;j++) {
+	DCEprojection* slab = (DCEprojection*)dceclone((DCEnode*)fetchprojection);
+	DCEslice* slice = ((DCEsegment*)nclistget(slab->var->segments,0))->slices;
+	size_t count = total/nslabs + (j < total%nslabs ? 1 : 0);
+	slice->first = fseg->slices[0].first + row*fseg->slices[0].stride;
+	slice->count = count;
+	slice->last = slice->first + (count-1)*slice->stride;
+	slice->length = (slice->last - slice->first) + 1;
+	row += count;
+        constraints[j] = (DCEconstraint*)dcecreate(CES_CONSTRAINT);
+        constraints[j]->selections = dceclonelist(dapcomm->oc.dapconstraint->selections);
+        constraints[j]->projections = nclistnew();
+        nclistpush(constraints[j]->projections,(void*)slab);
+	varlists[j] = vars;
+#ifdef DEBUG
+        fprintf(stderr,"getvarx: FETCHPART: slab: %s\n",dumpconstraint(constraints[j]));
+#endif
+    }
+
+    ncstat = buildcachenodes(dapcomm,nslabs,constraints,varlists,nodes,0);
+    if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+
+    for(j=0;j<nslabs;j++) {
+	NCcachenode* cachenode = nodes[j];
+	DCEprojection* slab = (DCEprojection*)nclistget(cachenode->constraint->projections,0);
+	size_t count = ((DCEsegment*)nclistget(slab->var->segments,0))->slices[0].count;
+	DCEslice* slice;
+
+	/* attach the slab's DATADDS to (constrained) DDS */
+	unattach(dapcomm->cdf.ddsroot);
+	ncstat = attachsubset(cachenode->datadds,dapcomm->cdf.ddsroot);
+	if(ncstat) goto done;
+	if(target->attachment == NULL)
+	    {THROWCHK(ncstat=NC_ENODATA); goto done;}
+
+	/* Walk all of the slab */
+	walk = (DCEprojection*)dceclone((DCEnode*)walkprojection);
+	slice = ((DCEsegment*)nclistget(walk->var->segments,0))->slices;
+	slice->count = count;
+	slice->length = count;
+	slice->last = count - 1;
+
+	varainfo->cache = cachenode;
+	varainfo->varaprojection = walk;
+	varainfo->target = target->attachment; /* Switch to datadds tree space*/
+	ncstat = moveto(dapcomm,varainfo,cachenode->datadds,memory);
+	varainfo->target = target;
+	varainfo->varaprojection = NULL;
+	dcefree((DCEnode*)walk);
+	walk = NULL;
+	if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+	memory += count*rowsize;
+    }
+
+done:
+    varainfo->cache = NULL;
+    for(j=0;nodes != NULL && j<nslabs;j++) {
+	if(nodes[j] == NULL) continue;
+	if(ncstat == NC_NOERR)
+	    insertcachenode(dapcomm,nodes[j]);
+	else
+	    freenccachenode(dapcomm,nodes[j]);
+    }
+    nullfree(constraints);
+    nullfree(varlists);
+    nullfree(nodes);
+    return THROW(ncstat);
+}
+
 /* Remove any pseudodimensions (sequence and string)*/
 static NCerror
 removepseudodims(DCEprojection* proj)
@@ -763,7 +1098,7 @@ extract(
 {
     OCerror ocstat = OC_NOERR;
     NCerror ncstat = NC_NOERR;
-    size_t count,rank0;
+    size_t rank0;
     Dapodometer* odom = NULL;
     size_t externtypesize;
     size_t interntypesize;
@@ -789,9 +1124,9 @@ fprintf(stderr,"\n");
 
     if(rank0 == 0) {/* scalar */
 	char* mem = (requireconversion?value:memory->next);
-	ASSERT(externtypesize <= sizeof(value));
-	/* Read the whole scalar directly into memory  */
-	ocstat = oc_data_readscalar(conn,currentcontent,externtypesize,mem);
+	ASSERT(interntypesize <= sizeof(value));
+	/* Read the whole scalar, in its own type, directly into memory  */
+	ocstat = oc_data_readscalar(conn,currentcontent,interntypesize,mem);
 	if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto done;}
 	if(requireconversion) {
 	    /* convert the value to external type */
@@ -799,88 +1134,129 @@ fprintf(stderr,"\n");
             if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
         }
         memory->next += (externtypesize);
-    } else if(xgetvar->cache->wholevariable) {/* && rank0 > 0 */
-	/* There are multiple cases, assuming no conversion required.
-           1) client is asking for whole variable
-              => start=0, count=totalsize, stride=1
-	      => read whole thing at one shot
-           2) client is asking for non-strided subset
-              and edges are maximal
-              => start=x, count=y, stride=1
-	      => read whole subset at one shot
-           3) client is asking for strided subset or edges are not maximal
-              => start=x, count=y, stride=s
-	      => we have to use odometer on leading prefix.
-           If conversion required, then read one-by-one
+    } else { /* rank0 > 0 */
+	/* Read the requested elements in runs that are contiguous in
+           the fetched data, copying or converting a whole run at once.
+           The slices before runindex are walked with an odometer; the
+           slice at runindex selects count rows of inner elements each,
+           where inner covers the (whole) slices after runindex.
+           1) the server applied the constraint (neither a whole
+              variable nor a cached part) => everything is one run
+           2) the trailing slices are whole => they are one run, and
+              so is an unstrided slice just before them
+           3) the last slice is strided by at most MAXGATHERSTRIDE
+              => read the span it covers and pick out its elements
+           4) otherwise, one element per run
 	*/
-	int safeindex = dcesafeindex(segment,0,rank0);
-	assert(safeindex >= 0 && safeindex <= rank0);
-
-	if(!requireconversion && safeindex == 0) { /* can read whole thing */
-            size_t internlen;
-	    count = dcesegmentsize(segment,0,rank0); /* how many to read */
-	    internlen = interntypesize*count;
-            /* Read the whole variable directly into memory.*/
-            ocstat = oc_data_readn(conn,currentcontent,NC_coord_zero,count,internlen,memory->next);
-	    /* bump memory pointer */
-	    memory->next += internlen;
-            if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto done;}
-	} else if(!requireconversion && safeindex > 0 && safeindex < rank0) {
-	    size_t internlen;
-	    /* We need to build an odometer for the unsafe prefix of the slices */
-	    odom = dapodom_fromsegment(segment,0,safeindex);
-	    count = dcesegmentsize(segment,safeindex,rank0); /* read in count chunks */
-	    internlen = interntypesize*count;
-	    while(dapodom_more(odom)) {
-	        ocstat = oc_data_readn(conn,currentcontent,odom->index,count,internlen,memory->next);
-	        if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto done;}
-	        memory->next += internlen;
-	        dapodom_next(odom);
+	size_t runindex, first, count, stride, inner;
+	size_t chunk, piece, c, i;
+	size_t start[NC_MAX_VAR_DIMS];
+	char* buf = NULL;
+	int exact = (!xgetvar->cache->wholevariable && !xgetvar->partial);
+
+	if(exact) {
+	    runindex = 0;
+	} else {
+	    runindex = dcesafeindex(segment,0,rank0);
+	    if(runindex > 0) {
+		DCEslice* slice = &segment->slices[runindex-1];
+		if(slice->stride == 1 || slice->count == 1
+		   || (runindex == rank0 && slice->stride <= MAXGATHERSTRIDE))
+		    runindex--;
 	    }
-            dapodom_free(odom);
-        } else {
-	     /* Cover following cases, all of which require reading
-                values one-by-one:
-		1. requireconversion
-		2. !requireconversion but safeindex == rank0 =>no safe indices
-		Note that in case 2, we will do a no-op conversion.
-	     */
-            odom = dapodom_fromsegment(segment,0,rank0);
-	    while(dapodom_more(odom)) {
-	        char value[16]; /* Big enough to hold any numeric value */
-	        ocstat = oc_data_readn(conn,currentcontent,odom->index,1,interntypesize,value);
-	        if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto done;}
-	        ncstat = dapconvert(xnode->etype,xgetvar->dsttype,memory->next,value,1);
-	        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
-	        memory->next += (externtypesize);
-	        dapodom_next(odom);
+	}
+	if(runindex < rank0) {
+	    DCEslice* slice = &segment->slices[runindex];
+	    first = slice->first;
+	    count = slice->count;
+	    stride = (count > 1 ? slice->stride : 1);
+	    inner = dcesegmentsize(segment,runindex+1,rank0);
+	    if(exact) {first = 0; stride = 1;}
+	} else {
+	    first = 0; count = 1; stride = 1; inner = 1;
+	}
+	if(count == 0 || inner == 0) goto cleanup; /* nothing to read */
+	/* Runs that need a buffer are read at most a buffer full
+           of rows at a time; a row longer than the buffer is read
+           a buffer full of elements (piece) at a time.  Only an
+           unstrided row can be that long: a strided one has inner == 1 */
+	chunk = count;
+	piece = inner;
+	if(requireconversion || stride > 1) {
+	    size_t rowsize = inner*stride*interntypesize;
+	    chunk = (rowsize >= EXTRACTBUFSIZE ? 1 : EXTRACTBUFSIZE/rowsize);
+	    if(chunk > count) chunk = count;
+	    if(rowsize > EXTRACTBUFSIZE && stride == 1) {
+		piece = EXTRACTBUFSIZE/interntypesize;
+		if(piece == 0) piece = 1;
+		buf = (char*)malloc(piece*interntypesize);
+	    } else
+		buf = (char*)malloc(((chunk-1)*stride + 1)*inner*interntypesize);
+	    if(buf == NULL) {ncstat = NC_ENOMEM; goto done;}
+	}
+	for(i=runindex+1;i<rank0;i++) start[i] = 0;
+	if(runindex > 0)
+	    odom = dapodom_fromsegment(segment,0,runindex);
+	for(;;) {
+	    if(odom != NULL) {
+		if(!dapodom_more(odom)) break;
+		for(i=0;i<runindex;i++) start[i] = odom->index[i];
 	    }
-            dapodom_free(odom);
-        }
-    } else { /* !xgetvar->cache->wholevariable && rank0 > 0 */
-	/* This is the case where the constraint was applied by the server,
-           so we just read it in, possibly with conversion
-	*/
-	if(requireconversion) {
-	    /* read one-by-one */
-            odom = dapodom_fromsegment(segment,0,rank0);
-	    while(dapodom_more(odom)) {
-	        char value[16]; /* Big enough to hold any numeric value */
-	        ocstat = oc_data_readn(conn,currentcontent,odom->index,1,interntypesize,value);
-	        if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto done;}
-	        ncstat = dapconvert(xnode->etype,xgetvar->dsttype,memory->next,value,1);
-	        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
-	        memory->next += (externtypesize);
-	        dapodom_next(odom);
+	    for(c=0;c<count;c+=chunk) {
+		size_t n = (count - c < chunk ? count - c : chunk);
+		size_t nelems = n*inner;
+		size_t span = ((n-1)*stride + 1)*inner;
+		if(runindex < rank0) start[runindex] = first + c*stride;
+		if(piece < inner) { /* Convert the row a piece at a time */
+		    size_t offset;
+		    for(offset=0;offset<inner;offset+=piece) {
+			size_t m = (inner - offset < piece ? inner - offset : piece);
+			size_t rem = offset;
+			/* Locate the piece within the trailing (whole) slices */
+			for(i=rank0;i-- > runindex+1;) {
+			    start[i] = rem % segment->slices[i].count;
+			    rem /= segment->slices[i].count;
+			}
+			ocstat = oc_data_readn(conn,currentcontent,start,m,
+					       m*interntypesize,buf);
+			if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto cleanup;}
+			ncstat = dapconvert(xnode->etype,xgetvar->dsttype,
+					    memory->next,buf,m);
+			if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto cleanup;}
+			memory->next += m*externtypesize;
+		    }
+		    for(i=runindex+1;i<rank0;i++) start[i] = 0;
+		    continue;
+		}
+		if(buf == NULL) { /* Read the run directly into memory */
+		    ocstat = oc_data_readn(conn,currentcontent,start,nelems,
+					   nelems*interntypesize,memory->next);
+		    if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto cleanup;}
+		} else {
+		    ocstat = oc_data_readn(conn,currentcontent,start,span,
+					   span*interntypesize,buf);
+		    if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto cleanup;}
+		    if(stride > 1) { /* Keep only every stride'th element */
+			for(i=1;i<n;i++)
+			    memcpy(buf+i*interntypesize,
+				   buf+i*stride*interntypesize,interntypesize);
+		    }
+		    if(requireconversion)
+			ncstat = dapconvert(xnode->etype,xgetvar->dsttype,
+					    memory->next,buf,nelems);
+		    else
+			memcpy(memory->next,buf,nelems*interntypesize);
+		    if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto cleanup;}
+		}
+		memory->next += nelems*externtypesize;
 	    }
-            dapodom_free(odom);
-	} else {/* Read straight to memory */
-            size_t internlen;
-	    count = dcesegmentsize(segment,0,rank0); /* how many to read */
-	    internlen = interntypesize*count;
-            ocstat = oc_data_readn(conn,currentcontent,NC_coord_zero,count,internlen,memory->next);
-            if(ocstat != OC_NOERR) {THROWCHK(ocstat); goto done;}
+	    if(odom == NULL) break;
+	    dapodom_next(odom);
 	}
+cleanup:
+	nullfree(buf);
+	dapodom_free(odom);
+	odom = NULL;
     }
 done:
     return THROW(ncstat);
@@ -1194,6 +1570,7 @@ freegetvara(Getvara* vara)
 {
     if(vara == NULL) return;
     dcefree((DCEnode*)vara->varaprojection);
+    dcefree((DCEnode*)vara->fetchprojection);
     nullfree(vara);
 }
 
@@ -19,12 +19,17 @@ and the per-retrieval maximum size
 #define DFALTCACHELIMIT (100*MEGBYTE)
 /* The fetch limit is in terms of bytes */
 #define DFALTFETCHLIMIT (100*KILOBYTE)
+/* Max number of fetches in flight at once */
+#define DFALTCONCURRENCY (4)
 
 /* WARNING: The small limit is in terms of the # of vector elements */
 #define DFALTSMALLLIMIT (4096)
 
-/* Max number of cache nodes */
-#define DFALTCACHECOUNT (100)
+/* Max number of cache nodes; the cache is normally limited by size */
+#define DFALTCACHECOUNT ((size_t)-1)
+
+/* Max number of reads queued when batching */
+#define DFALTBATCHCOUNT (64)
 
 typedef struct Getvara {
     void* memory; /* where result is put*/
@@ -34,6 +39,8 @@ typedef struct Getvara {
     nc_type dsttype;
     CDFnode* target;
     int wholevariable;
+    int partial; /* walk selects part of a constrained cache node */
+    struct DCEprojection* fetchprojection; /* while queued in a batch */
 } Getvara;
 
 #endif /*GETVARA_H*/
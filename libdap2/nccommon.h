@@ -108,7 +108,10 @@ typedef struct NCCDF {
     unsigned int defaultstringlength;
     unsigned int defaultsequencelimit; /* global sequence limit;0=>no limit */
     struct NCcache* cache;
-    size_t fetchlimit;
+    size_t fetchlimit; /* larger fetches are split (see "concurrency") */
+    size_t concurrency; /* max # of fetches in flight at once */
+    NClist* batch; /* Getvara* queued for a single fetch (see "batch") */
+    size_t batchlimit; /* max # of queued reads */
     size_t smallsizelimit; /* what constitutes a small object? */
     size_t totalestimatedsize;
     const char* separator; /* constant; do not free */
@@ -281,7 +284,7 @@ extern NCerror definedimsets(NCDAPCOMMON*,CDFtree*);
 extern NCerror definedimsettrans(NCDAPCOMMON*,CDFtree*);
 
 /* From cache.c */
-extern int iscached(NCDAPCOMMON*, CDFnode* target, NCcachenode** cachenodep);
+extern int iscached(NCDAPCOMMON*, CDFnode* target, DCEprojection* request, NCcachenode** cachenodep);
 extern NCerror prefetchdata(NCDAPCOMMON*);
 extern NCerror markprefetch(NCDAPCOMMON*);
 extern NCerror buildcachenode(NCDAPCOMMON*,
@@ -289,6 +292,13 @@ extern NCerror buildcachenode(NCDAPCOMMON*,
 		NClist* varlist,
 		NCcachenode** cachep,
 		NCFLAGS flags);
+extern NCerror buildcachenodes(NCDAPCOMMON*,
+		size_t n,
+	        DCEconstraint** constraints,
+		NClist** varlists,
+		NCcachenode** cachenodes,
+		NCFLAGS flags);
+extern void insertcachenode(NCDAPCOMMON*, NCcachenode* cachenode);
 extern NCcachenode* createnccachenode(void);
 extern void freenccachenode(NCDAPCOMMON*, NCcachenode* node);
 extern NCcache* createnccache(void);
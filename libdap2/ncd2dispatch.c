@@ -136,6 +136,8 @@ NCD2_inq_var_all,
 
 NCD2_var_par_access,
 
+NCDEFAULT_inq_var_offset,
+
 #ifdef USE_NETCDF4
 NCD2_show_metadata,
 NCD2_inq_unlimdims,
@@ -224,12 +226,30 @@ NCD2__enddef(int ncid, size_t h_minfree, size_t v_align, size_t v_minfree, size_
 static int
 NCD2_sync(int ncid)
 {
-    return (NC_EINVAL);
+    NC* drno;
+    NCDAPCOMMON* dapcomm;
+    int ncstatus = NC_NOERR;
+
+    ncstatus = NC_check_id(ncid, (NC**)&drno);
+    if(ncstatus != NC_NOERR) return THROW(ncstatus);
+    dapcomm = (NCDAPCOMMON*)drno->dispatchdata;
+
+    /* The only thing to sync is any batched reads */
+    if(!FLAGSET(dapcomm->controls,NCF_BATCH))
+        return (NC_EINVAL);
+    return THROW(nc3d_flushbatch(dapcomm));
 }
 
 static int
 NCD2_abort(int ncid)
 {
+    NC* drno;
+    int ncstatus = NC_NOERR;
+
+    ncstatus = NC_check_id(ncid, (NC**)&drno);
+    if(ncstatus != NC_NOERR) return THROW(ncstatus);
+    /* Do not complete any batched reads */
+    nc3d_discardbatch((NCDAPCOMMON*)drno->dispatchdata);
     return NCD2_close(ncid);
 }
 
@@ -603,10 +623,16 @@ NCD2_close(int ncid)
     if(ncstatus != NC_NOERR) return THROW(ncstatus);
     dapcomm = (NCDAPCOMMON*)drno->dispatchdata;
 
+    /* Complete any batched reads */
+    ncstatus = nc3d_flushbatch(dapcomm);
+
     /* We call abort rather than close to avoid
        trying to write anything or try to pad file length
      */
-    ncstatus = nc_abort(getnc3id(drno));
+    if(ncstatus == NC_NOERR)
+        ncstatus = nc_abort(getnc3id(drno));
+    else
+        (void)nc_abort(getnc3id(drno));
 
     /* clean NC* */
     freeNCDAPCOMMON(dapcomm);
@@ -1206,45 +1232,36 @@ applyclientparams(NCDAPCOMMON* nccomm)
     ASSERT(nccomm->oc.url != NULL);
 
     nccomm->cdf.cache->cachelimit = DFALTCACHELIMIT;
-    value = oc_clientparam_get(conn,"cachelimit");
+    value = dapparamvalue(nccomm,"cachelimit");
     limit = getlimitnumber(value);
     if(limit > 0) nccomm->cdf.cache->cachelimit = limit;
 
     nccomm->cdf.fetchlimit = DFALTFETCHLIMIT;
-    value = oc_clientparam_get(conn,"fetchlimit");
+    value = dapparamvalue(nccomm,"fetchlimit");
     limit = getlimitnumber(value);
     if(limit > 0) nccomm->cdf.fetchlimit = limit;
 
-    nccomm->cdf.smallsizelimit = DFALTSMALLLIMIT;
-    value = oc_clientparam_get(conn,"smallsizelimit");
+    /* concurrency=1 => never split a fetch */
+    nccomm->cdf.concurrency = DFALTCONCURRENCY;
+    value = dapparamvalue(nccomm,"concurrency");
     limit = getlimitnumber(value);
-    if(limit > 0) nccomm->cdf.smallsizelimit = limit;
+    if(limit > 0) nccomm->cdf.concurrency = limit;
 
-    nccomm->cdf.cache->cachecount = DFALTCACHECOUNT;
-#ifdef HAVE_GETRLIMIT
-    { struct rlimit rl;
-      if(getrlimit(RLIMIT_NOFILE, &rl) >= 0) {
-	nccomm->cdf.cache->cachecount = (size_t)(rl.rlim_cur / 2);
-      }
-    }
-#endif
-    value = oc_clientparam_get(conn,"cachecount");
+    nccomm->cdf.smallsizelimit = DFALTSMALLLIMIT;
+    value = dapparamvalue(nccomm,"smallsizelimit");
     limit = getlimitnumber(value);
-    if(limit > 0) nccomm->cdf.cache->cachecount = limit;
-    /* Ignore limit if not caching */
-    if(!FLAGSET(nccomm->controls,NCF_CACHE))
-        nccomm->cdf.cache->cachecount = 0;
+    if(limit > 0) nccomm->cdf.smallsizelimit = limit;
 
-    if(oc_clientparam_get(conn,"nolimit") != NULL)
+    if(dapparamvalue(nccomm,"nolimit") != NULL)
 	dfaltseqlim = 0;
-    value = oc_clientparam_get(conn,"limit");
+    value = dapparamvalue(nccomm,"limit");
     if(value != NULL && strlen(value) != 0) {
         if(sscanf(value,"%d",&len) && len > 0) dfaltseqlim = len;
     }
     nccomm->cdf.defaultsequencelimit = dfaltseqlim;
 
     /* allow embedded _ */
-    value = oc_clientparam_get(conn,"stringlength");
+    value = dapparamvalue(nccomm,"stringlength");
     if(value != NULL && strlen(value) != 0) {
         if(sscanf(value,"%d",&len) && len > 0) dfaltstrlen = len;
     }
@@ -1259,7 +1276,7 @@ applyclientparams(NCDAPCOMMON* nccomm)
 	pathstr = makeocpathstring(conn,var->ocnode,".");
 	strncat(tmpname,pathstr,NC_MAX_NAME);
 	nullfree(pathstr);
-	value = oc_clientparam_get(conn,tmpname);
+	value = dapparamvalue(nccomm,tmpname);
         if(value != NULL && strlen(value) != 0) {
             if(sscanf(value,"%d",&len) && len > 0) var->maxstringlength = len;
 	}
@@ -1272,11 +1289,11 @@ applyclientparams(NCDAPCOMMON* nccomm)
 	strcpy(tmpname,"nolimit_");
 	pathstr = makeocpathstring(conn,var->ocnode,".");
 	strncat(tmpname,pathstr,NC_MAX_NAME);
-	if(oc_clientparam_get(conn,tmpname) != NULL)
+	if(dapparamvalue(nccomm,tmpname) != NULL)
 	    var->sequencelimit = 0;
 	strcpy(tmpname,"limit_");
 	strncat(tmpname,pathstr,NC_MAX_NAME);
-	value = oc_clientparam_get(conn,tmpname);
+	value = dapparamvalue(nccomm,tmpname);
         if(value != NULL && strlen(value) != 0) {
             if(sscanf(value,"%d",&len) && len > 0)
 		var->sequencelimit = len;
@@ -1285,19 +1302,47 @@ applyclientparams(NCDAPCOMMON* nccomm)
     }
 
     /* test for the appropriate fetch flags */
-    value = oc_clientparam_get(conn,"fetch");
+    value = dapparamvalue(nccomm,"fetch");
     if(value != NULL && strlen(value) > 0) {
 	if(value[0] == 'd' || value[0] == 'D') {
             SETFLAG(nccomm->controls,NCF_ONDISK);
 	}
     }
 
+    /* The cache is purged by size (cachelimit); the number of
+       cache nodes is only limited by default when fetching to disk,
+       where each node holds an open temporary file. */
+    nccomm->cdf.cache->cachecount = DFALTCACHECOUNT;
+    if(FLAGSET(nccomm->controls,NCF_ONDISK)) {
+#ifdef HAVE_GETRLIMIT
+        struct rlimit rl;
+        if(getrlimit(RLIMIT_NOFILE, &rl) >= 0) {
+	    nccomm->cdf.cache->cachecount = (size_t)(rl.rlim_cur / 2);
+        }
+#endif
+    }
+    value = dapparamvalue(nccomm,"cachecount");
+    limit = getlimitnumber(value);
+    if(limit > 0) nccomm->cdf.cache->cachecount = limit;
+    /* Ignore limit if not caching */
+    if(!FLAGSET(nccomm->controls,NCF_CACHE))
+        nccomm->cdf.cache->cachecount = 0;
+
     /* test for the force-whole-var flag */
-    value = oc_clientparam_get(conn,"wholevar");
+    value = dapparamvalue(nccomm,"wholevar");
     if(value != NULL) {
         SETFLAG(nccomm->controls,NCF_WHOLEVAR);
     }
 
+    /* test for the batch flag; batch=NN limits the queued reads */
+    nccomm->cdf.batchlimit = DFALTBATCHCOUNT;
+    value = dapparamvalue(nccomm,"batch");
+    if(value != NULL) {
+        SETFLAG(nccomm->controls,NCF_BATCH);
+        limit = getlimitnumber(value);
+        if(limit > 0) nccomm->cdf.batchlimit = limit;
+    }
+
     return NC_NOERR;
 }
 
@@ -1741,6 +1786,7 @@ static NCerror
 freeNCDAPCOMMON(NCDAPCOMMON* dapcomm)
 {
     if(dapcomm == NULL) return NC_NOERR;
+    nc3d_discardbatch(dapcomm);
     freenccache(dapcomm,dapcomm->cdf.cache);
     nclistfree(dapcomm->cdf.projectedvars);
     nullfree(dapcomm->cdf.recorddimname);
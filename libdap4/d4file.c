@@ -304,6 +304,7 @@ freeCurl(NCD4curl* curl)
     nullfree(curl->proxy.host);
     nullfree(curl->proxy.userpwd);
     nullfree(curl->creds.userpwd);
+    nchttpcache_clear(&curl->httpcache);
 }
 
 /* Define the set of protocols known to be constrainable */
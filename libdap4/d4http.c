@@ -33,6 +33,31 @@ NCD4_fetchhttpcode(CURL* curl)
     return httpcode;
 }
 
+/* Make the fetches that follow conditional on the resource having
+   been modified since lastmodified; lastmodified < 0 => unconditional */
+int
+NCD4_fetchcondition(CURL* curl, long lastmodified)
+{
+    CURLcode cstat = CURLE_OK;
+    long condition = (lastmodified < 0 ? CURL_TIMECOND_NONE
+                                       : CURL_TIMECOND_IFMODSINCE);
+    cstat = curl_easy_setopt(curl, CURLOPT_TIMECONDITION, condition);
+    if(cstat == CURLE_OK)
+        cstat = curl_easy_setopt(curl, CURLOPT_TIMEVALUE,
+                                 (lastmodified < 0 ? 0L : lastmodified));
+    return THROW(curlerrtoncerr(cstat));
+}
+
+/* Did the last (conditional) fetch find the resource unmodified? */
+int
+NCD4_fetchunmet(CURL* curl)
+{
+    long unmet = 0;
+    if(curl_easy_getinfo(curl,CURLINFO_CONDITION_UNMET,&unmet) != CURLE_OK)
+        unmet = 0;
+    return (unmet != 0 || NCD4_fetchhttpcode(curl) == 304);
+}
+
 int
 NCD4_fetchurl_file(CURL* curl, const char* url, FILE* stream,
                 d4size_t* sizep, long* filetime)
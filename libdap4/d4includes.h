@@ -35,6 +35,7 @@
 #include "ncbytes.h"
 #include "nclist.h"
 #include "ncuri.h"
+#include "nchttpcache.h"
 #include "nclog.h"
 #include "ncdap.h"
 
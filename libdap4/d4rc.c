@@ -23,7 +23,9 @@ static void rcorder(NClist* rc);
 static char* rcreadline(char**);
 static int rcsearch(const char* prefix, const char* rcname, char** pathp);
 static void rctrim(char* text);
+#ifdef D4DEBUG
 static void storedump(char* msg, NClist* triples);
+#endif
 static int rcsetinfocurlflag(NCD4INFO*, const char* flag, const char* value);
 
 /* Define default rc files and aliases, also defines search order*/
@@ -87,17 +89,20 @@ rcorder(NClist* rc)
     if(rc == NULL || len == 0) return;
     for(i=0;i<len;i++) {
 	NCD4triple* ti = nclistget(rc,i);
-	if(ti->host != NULL) continue;
+	if(strlen(ti->host) > 0) continue;
 	for(j=i;j<len;j++) {
 	    NCD4triple* tj = nclistget(rc,j);
-	    if(tj->host != NULL) {/*swap*/
+	    if(strlen(tj->host) > 0) {/*swap*/
 		NCD4triple* t = ti;
 		nclistset(rc,i,tj);		
 		nclistset(rc,j,t);
+		break;
 	    }
 	}
     }
+#ifdef D4DEBUG
     storedump("reorder:",rc);
+#endif
 }
 
 
@@ -120,6 +125,7 @@ rccompile(const char* path)
     if(contents == NULL) contents = strdup("");
     NCD4_rcfree(rc); /* clear out any old data */
     rc = nclistnew();
+    NCD4_globalstate->rc.rc = rc;
     nextline = contents;
     for(;;) {
 	char* line;
@@ -158,7 +164,8 @@ rccompile(const char* path)
 	    }
 	    ncbytesnull(tmp);
 	    triple->host = ncbytesextract(tmp);
-        }
+        } else
+	    triple->host = strdup(""); /* applies to all urls */
         /* split off key and value */
         key=line;
         value = strchr(line, '=');
@@ -465,6 +472,17 @@ NCD4_rcprocess(NCD4INFO* info)
 	} else if(userpwd != NULL)
             rcsetinfocurlflag(info,"HTTP.USERPASSWORD",userpwd);
     }
+    { /* Persistent http response cache */
+	char* dir = NCD4_rclookup("HTTP.CACHE.DIR",url_hostport);
+	if(dir != NULL) {
+	    unsigned long long maxsize = 0;
+	    char* size = NCD4_rclookup("HTTP.CACHE.MAXSIZE",url_hostport);
+	    if(size != NULL)
+		maxsize = strtoull(size,NULL,10);
+	    if(nchttpcache_init(&info->curl->httpcache,dir,maxsize) != NC_NOERR)
+		nclog(NCLOGWARN,"HTTP.CACHE.DIR: %s unusable; not caching",dir);
+	}
+    }
 
     return THROW(ret);
 }
@@ -506,6 +524,7 @@ NCD4_rclookup(char* key, char* hostport)
     return (triple == NULL ? NULL : triple->value);
 }
 
+#ifdef D4DEBUG
 static void
 storedump(char* msg, NClist* triples)
 {
@@ -523,6 +542,7 @@ storedump(char* msg, NClist* triples)
     }
     fflush(stderr);
 }
+#endif
 
 /**
  * Prefix must end in '/'
@@ -9,6 +9,8 @@
 
 /*Forward*/
 static int readpacket(NCD4INFO* state, NCURI*, NCbytes*, NCD4mode, long*);
+static int fetchcached(NCD4INFO*, const char* url, NCbytes*, FILE*, d4size_t*, long*);
+static int fetchresponse(NCD4INFO*, const char* url, NCbytes*, FILE*, d4size_t*, long*);
 static int readfile(const NCURI*, const char* suffix, NCbytes* packet);
 static int readfiletofile(const NCURI*, const char* suffix, FILE* stream, d4size_t*);
 
@@ -53,8 +55,8 @@ NCD4_readDAP(NCD4INFO* state, int flags)
 		return THROW(NC_ENOMEM);
             if (state->debug > 0) 
                 {fprintf(stderr, "fetch url=%s\n", readurl);fflush(stderr);}
-            stat = NCD4_fetchurl_file(state->curl, readurl, state->data.ondiskfile,
-                                   &state->data.datasize, &lastmod);
+            stat = fetchcached(state, readurl, NULL, state->data.ondiskfile,
+                               &state->data.datasize, &lastmod);
             nullfree(readurl);
             if(stat == NC_NOERR)
                 state->data.daplastmodified = lastmod;
@@ -82,7 +84,6 @@ readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, long* las
     int stat = NC_NOERR;
     int fileprotocol = 0;
     const char* suffix = dxxextension(dxx);
-    CURL* curl = state->curl->curl;
 
     fileprotocol = (strcmp(url->protocol,"file")==0);
 
@@ -99,7 +100,7 @@ readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, long* las
 	MEMCHECK(fetchurl);
 	if(state->debug > 0)
             {fprintf(stderr,"fetch url=%s\n",fetchurl); fflush(stderr);}
-        stat = NCD4_fetchurl(curl,fetchurl,packet,lastmodified,&state->curl->creds);
+        stat = fetchcached(state,fetchurl,packet,NULL,NULL,lastmodified);
         nullfree(fetchurl);
 	if(stat) goto fail;
 	if(state->debug > 0)
@@ -115,6 +116,83 @@ fail:
     return THROW(stat);
 }
 
+/* Fetch url into packet or, if packet is NULL, into stream */
+static int
+fetchresponse(NCD4INFO* state, const char* url, NCbytes* packet, FILE* stream,
+              d4size_t* sizep, long* filetime)
+{
+    CURL* curl = state->curl->curl;
+    if(packet != NULL)
+        return NCD4_fetchurl(curl,url,packet,filetime,&state->curl->creds);
+    return NCD4_fetchurl_file(curl,url,stream,sizep,filetime);
+}
+
+/* Fetch url into packet or, if packet is NULL, into stream, going
+   through the persistent http cache (HTTP.CACHE.DIR) if there is one:
+   a cached response is revalidated with a conditional GET and used
+   if the server reports that it has not been modified. */
+static int
+fetchcached(NCD4INFO* state, const char* url, NCbytes* packet, FILE* stream,
+            d4size_t* sizep, long* lastmodified)
+{
+    int stat = NC_NOERR;
+    CURL* curl = state->curl->curl;
+    NChttpcache* cache = (state->curl->httpcache.dir != NULL ? &state->curl->httpcache : NULL);
+    long cachedtime = -1;
+    long filetime = -1;
+    int cached = 0;
+
+    if(cache != NULL && nchttpcache_lookup(cache,url,&cachedtime))
+        cached = (NCD4_fetchcondition(curl,cachedtime) == NC_NOERR);
+    stat = fetchresponse(state,url,packet,stream,sizep,&filetime);
+    if(cached)
+        (void)NCD4_fetchcondition(curl,-1);
+    if(stat != NC_NOERR) goto done;
+
+    if(cached && NCD4_fetchunmet(curl)) {
+        int cstat;
+        if(state->debug > 0)
+            {fprintf(stderr,"fetch from cache: %s\n",url); fflush(stderr);}
+        if(packet != NULL) {
+            cstat = nchttpcache_get(cache,url,packet);
+            if(cstat == NC_NOERR) {
+                size_t len = ncbyteslength(packet);
+                ncbytesappend(packet,'\0');
+                ncbytessetlength(packet,len);
+            }
+        } else {
+            off_t size = 0;
+            cstat = nchttpcache_getfile(cache,url,stream,&size);
+            if(cstat == NC_NOERR && sizep != NULL) *sizep = (d4size_t)size;
+        }
+        if(cstat == NC_NOERR) {
+            filetime = cachedtime;
+            goto havedata;
+        }
+        /* The entry was evicted (possibly by another process) since
+           it was looked up, so fetch the response unconditionally */
+        if(packet != NULL)
+            ncbytesclear(packet);
+        else
+            rewind(stream);
+        filetime = -1;
+        stat = fetchresponse(state,url,packet,stream,sizep,&filetime);
+        if(stat != NC_NOERR) goto done;
+    }
+    if(cache != NULL && filetime >= 0) {
+        /* Failing to cache the response is not an error */
+        if(packet != NULL)
+            (void)nchttpcache_put(cache,url,filetime,ncbytescontents(packet),
+                                  (size_t)ncbyteslength(packet));
+        else
+            (void)nchttpcache_putfile(cache,url,filetime,stream);
+    }
+havedata:
+    if(lastmodified != NULL) *lastmodified = filetime;
+done:
+    return THROW(stat);
+}
+
 static int
 readfiletofile(const NCURI* uri, const char* suffix, FILE* stream, d4size_t* sizep)
 {
@@ -926,6 +926,8 @@ NCD4_inq_var_all,
 
 NCD4_var_par_access,
 
+NCDEFAULT_inq_var_offset,
+
 #ifdef USE_NETCDF4
 NCD4_show_metadata,
 NCD4_inq_unlimdims,
@@ -323,6 +323,7 @@ struct NCD4curl {
     struct credentials {
 	char *userpwd; /*CURLOPT_USERPWD*/
     } creds;
+    NChttpcache httpcache; /* HTTP.CACHE.DIR; dir == NULL => no caching */
 };
 
 /**************************************************/
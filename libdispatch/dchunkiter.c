@@ -0,0 +1,369 @@
+/*! \file
+Functions for iterating over the chunks of a variable.
+
+Copyright 2016 University Corporation for Atmospheric
+Research/Unidata. See COPYRIGHT file for more info.
+*/
+
+#include "ncdispatch.h"
+
+/* Most bytes read at a time when comparing a tile to the fill value.
+ * A tile can be a whole unchunked variable. */
+#define SCAN_BUFSIZE (1 << 20)
+
+/* State of a chunk iterator. */
+struct nc_chunk_iter {
+   int ncid;
+   int varid;
+   int flags;
+   int ndims;
+   int done;                  /* true when there are no more tiles */
+   size_t *dimlens;           /* current length of each dim of the var */
+   size_t *tilesizes;         /* size of a tile along each dim */
+   size_t *index;             /* start of the next tile */
+   int formatx;               /* NC_FORMATX_ of the file */
+   size_t typesize;           /* size of one value in the file */
+   void *fillp;               /* fill value, NULL if it can't be compared */
+   void *buf;                 /* buffer for reading part of a tile to compare */
+};
+
+/* Get the default fill value of an atomic type, or return NC_EBADTYPE
+ * if values of this type can't be compared to a fill value. */
+static int
+default_fill(nc_type xtype, void *fillp)
+{
+   switch (xtype)
+   {
+   case NC_BYTE: *(signed char *)fillp = NC_FILL_BYTE; break;
+   case NC_CHAR: *(char *)fillp = NC_FILL_CHAR; break;
+   case NC_SHORT: *(short *)fillp = NC_FILL_SHORT; break;
+   case NC_INT: *(int *)fillp = NC_FILL_INT; break;
+   case NC_FLOAT: *(float *)fillp = NC_FILL_FLOAT; break;
+   case NC_DOUBLE: *(double *)fillp = NC_FILL_DOUBLE; break;
+   case NC_UBYTE: *(unsigned char *)fillp = NC_FILL_UBYTE; break;
+   case NC_USHORT: *(unsigned short *)fillp = NC_FILL_USHORT; break;
+   case NC_UINT: *(unsigned int *)fillp = NC_FILL_UINT; break;
+   case NC_INT64: *(long long *)fillp = NC_FILL_INT64; break;
+   case NC_UINT64: *(unsigned long long *)fillp = NC_FILL_UINT64; break;
+   default: return NC_EBADTYPE;
+   }
+   return NC_NOERR;
+}
+
+/* Find the fill value of a var, so that tiles can be compared to
+ * it. Only atomic, fixed size types are compared. */
+static int
+get_fill(nc_chunk_iter_t *iterp)
+{
+   nc_type xtype, att_type;
+   size_t att_len;
+   int stat;
+
+   if ((stat = nc_inq_vartype(iterp->ncid, iterp->varid, &xtype)))
+      return stat;
+   if (xtype < NC_BYTE || xtype > NC_UINT64 || xtype == NC_STRING)
+      return NC_NOERR;
+   if ((stat = nc_inq_type(iterp->ncid, xtype, NULL, &iterp->typesize)))
+      return stat;
+   if (!(iterp->fillp = malloc(iterp->typesize)))
+      return NC_ENOMEM;
+
+   /* Use the _FillValue attribute if there is one, otherwise the
+    * default fill value for the type. */
+   stat = nc_inq_att(iterp->ncid, iterp->varid, _FillValue, &att_type, &att_len);
+   if (stat == NC_NOERR && att_type == xtype && att_len == 1)
+      stat = nc_get_att(iterp->ncid, iterp->varid, _FillValue, iterp->fillp);
+   else
+      stat = default_fill(xtype, iterp->fillp);
+   return stat;
+}
+
+/* See whether all nvalues values in buf are the fill value. */
+static int
+all_fill(const nc_chunk_iter_t *iterp, size_t nvalues)
+{
+   const char *p;
+   size_t i;
+
+   for (i = 0, p = iterp->buf; i < nvalues; i++, p += iterp->typesize)
+      if (memcmp(p, iterp->fillp, iterp->typesize))
+	 return 0;
+   return 1;
+}
+
+/* See whether a tile holds anything but the fill value. For netCDF-4
+ * files, this is whether its chunk was ever written, which is known
+ * without reading it; a chunk that was written with only fill values
+ * counts as written. Otherwise the tile is read, in blocks of at most
+ * SCAN_BUFSIZE bytes, and compared to the fill value. */
+static int
+tile_written(nc_chunk_iter_t *iterp, const size_t *start, const size_t *count,
+	     size_t nvalues, int *writtenp)
+{
+   size_t bstart[NC_MAX_VAR_DIMS], bcount[NC_MAX_VAR_DIMS];
+   size_t inner = 1, step;
+   int d, bd;
+   int stat;
+
+   *writtenp = 1;
+
+#ifdef USE_NETCDF4
+   /* netCDF-4 knows which chunks were never written, without reading
+    * them. */
+   if (iterp->formatx == NC_FORMATX_NC4)
+   {
+      stat = NC4_inq_chunk_written(iterp->ncid, iterp->varid, start, writtenp);
+      if (stat != NC_ENOTBUILT)
+	 return stat;
+      *writtenp = 1;
+   }
+#endif
+
+   if (!iterp->fillp)
+      return NC_NOERR;
+
+   if (!iterp->buf && !(iterp->buf = malloc(SCAN_BUFSIZE)))
+      return NC_ENOMEM;
+
+   if (!iterp->ndims)
+   {
+      if ((stat = nc_get_vara(iterp->ncid, iterp->varid, start, count, iterp->buf)))
+	 return stat;
+      *writtenp = !all_fill(iterp, nvalues);
+      return NC_NOERR;
+   }
+
+   /* Read blocks of step indices along dimension bd, the outermost
+    * dimension whose inner dimensions fit in the buffer, going
+    * through the dimensions outside it one index at a time. */
+   for (bd = iterp->ndims - 1; bd > 0; bd--)
+   {
+      if (inner * count[bd] * iterp->typesize > SCAN_BUFSIZE)
+	 break;
+      inner *= count[bd];
+   }
+   step = SCAN_BUFSIZE / (inner * iterp->typesize);
+   if (step == 0)
+      step = 1;
+   for (d = 0; d < iterp->ndims; d++)
+   {
+      bstart[d] = start[d];
+      bcount[d] = d < bd ? 1 : count[d];
+   }
+
+   for (;;)
+   {
+      bcount[bd] = start[bd] + count[bd] - bstart[bd];
+      if (bcount[bd] > step)
+	 bcount[bd] = step;
+      if ((stat = nc_get_vara(iterp->ncid, iterp->varid, bstart, bcount, iterp->buf)))
+	 return stat;
+      if (!all_fill(iterp, bcount[bd] * inner))
+	 return NC_NOERR;
+
+      /* Move to the next block, dimension bd fastest. */
+      bstart[bd] += bcount[bd];
+      for (d = bd; d > 0 && bstart[d] == start[d] + count[d]; d--)
+      {
+	 bstart[d] = start[d];
+	 bstart[d - 1]++;
+      }
+      if (bstart[0] == start[0] + count[0])
+	 break;
+   }
+   *writtenp = 0;
+   return NC_NOERR;
+}
+
+/** \ingroup variables
+Get an iterator over the chunks of a variable.
+
+The iterator returns (start, count) tiles, one per chunk, in the
+order the chunks are indexed on disk: along the chunk grid, with the
+last dimension varying fastest. Tiles at the edges of the variable are
+clipped to its shape. Reading a tile reads whole chunks, and no two
+tiles share a chunk, so tiles can be handed out to separate workers.
+
+Variables that are not chunked are treated as having a single chunk,
+except record variables in classic format files, where each record
+is a tile.
+
+\param ncid NetCDF or group ID, from a previous call to nc_open(),
+nc_create(), nc_def_grp(), or associated inquiry functions such as
+nc_inq_ncid().
+
+\param varid Variable ID
+
+\param flags ::NC_CHUNK_ITER_SKIP_FILL to skip chunks that hold only
+the fill value. For netCDF-4 files, chunks that were never written
+are skipped without being read; a chunk that was written, even with
+only fill values, is not skipped. For other files, and for netCDF-4
+files when the HDF5 library can't report which chunks were written,
+each tile is read and compared to the fill value, a block at a time,
+so chunks holding only fill values are skipped whether or not they
+were written. Tiles of types other than atomic fixed size types are
+never skipped.
+
+\param iterpp Pointer to location for the returned iterator, which
+must be released with nc_free_chunk_iter().
+
+\returns ::NC_NOERR No error.
+\returns ::NC_EBADID Bad ncid.
+\returns ::NC_ENOTVAR Invalid variable ID.
+\returns ::NC_EINVAL Invalid flags.
+\returns ::NC_ENOMEM Out of memory.
+*/
+int
+nc_get_chunk_iter(int ncid, int varid, int flags, nc_chunk_iter_t **iterpp)
+{
+   nc_chunk_iter_t *iterp;
+   int dimids[NC_MAX_VAR_DIMS];
+   int storage, unlimid, d;
+   int stat;
+
+   if (!iterpp || (flags & ~NC_CHUNK_ITER_SKIP_FILL))
+      return NC_EINVAL;
+
+   if (!(iterp = calloc(1, sizeof(nc_chunk_iter_t))))
+      return NC_ENOMEM;
+   iterp->ncid = ncid;
+   iterp->varid = varid;
+   iterp->flags = flags;
+
+   if ((stat = nc_inq_format_extended(ncid, &iterp->formatx, NULL)))
+      goto done;
+   if ((stat = nc_inq_var(ncid, varid, NULL, NULL, &iterp->ndims, dimids, NULL)))
+      goto done;
+
+   if (iterp->ndims)
+   {
+      if (!(iterp->dimlens = malloc(iterp->ndims * sizeof(size_t))) ||
+	  !(iterp->tilesizes = malloc(iterp->ndims * sizeof(size_t))) ||
+	  !(iterp->index = calloc(iterp->ndims, sizeof(size_t))))
+      {
+	 stat = NC_ENOMEM;
+	 goto done;
+      }
+      for (d = 0; d < iterp->ndims; d++)
+      {
+	 if ((stat = nc_inq_dimlen(ncid, dimids[d], &iterp->dimlens[d])))
+	    goto done;
+	 if (!iterp->dimlens[d])
+	    iterp->done = 1;
+      }
+
+      if ((stat = nc_inq_var_chunking(ncid, varid, &storage, iterp->tilesizes)))
+	 goto done;
+      if (storage != NC_CHUNKED)
+      {
+	 /* One tile for the whole var, or one per record. */
+	 for (d = 0; d < iterp->ndims; d++)
+	    iterp->tilesizes[d] = iterp->dimlens[d];
+	 if (iterp->formatx != NC_FORMATX_NC4)
+	 {
+	    if ((stat = nc_inq_unlimdim(ncid, &unlimid)))
+	       goto done;
+	    if (unlimid != -1 && dimids[0] == unlimid)
+	       iterp->tilesizes[0] = 1;
+	 }
+      }
+   }
+
+   if (flags & NC_CHUNK_ITER_SKIP_FILL)
+      stat = get_fill(iterp);
+
+done:
+   if (stat)
+      nc_free_chunk_iter(iterp);
+   else
+      *iterpp = iterp;
+   return stat;
+}
+
+/** \ingroup variables
+Get the next tile from a chunk iterator.
+
+\param iterp Iterator from nc_get_chunk_iter().
+
+\param startp Start indices of the tile will be copied here, one
+per dimension of the variable.
+
+\param countp Counts of the tile will be copied here, one per
+dimension of the variable.
+
+\param nvaluesp Number of values in the tile will be copied here. It
+is zero when there are no more tiles.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_EINVAL Bad iterator.
+*/
+int
+nc_next_chunk_iter(nc_chunk_iter_t *iterp, size_t *startp, size_t *countp,
+		   size_t *nvaluesp)
+{
+   size_t nvalues;
+   int written;
+   int d, stat;
+
+   if (!iterp || !nvaluesp || (iterp->ndims && (!startp || !countp)))
+      return NC_EINVAL;
+
+   while (!iterp->done)
+   {
+      nvalues = 1;
+      for (d = 0; d < iterp->ndims; d++)
+      {
+	 startp[d] = iterp->index[d];
+	 countp[d] = iterp->tilesizes[d];
+	 if (startp[d] + countp[d] > iterp->dimlens[d])
+	    countp[d] = iterp->dimlens[d] - startp[d];
+	 nvalues *= countp[d];
+      }
+
+      /* Move to the next tile, last dimension fastest. */
+      for (d = iterp->ndims - 1; d >= 0; d--)
+      {
+	 iterp->index[d] += iterp->tilesizes[d];
+	 if (iterp->index[d] < iterp->dimlens[d])
+	    break;
+	 iterp->index[d] = 0;
+      }
+      if (d < 0)
+	 iterp->done = 1;
+
+      if (iterp->flags & NC_CHUNK_ITER_SKIP_FILL)
+      {
+	 if ((stat = tile_written(iterp, startp, countp, nvalues, &written)))
+	    return stat;
+	 if (!written)
+	    continue;
+      }
+
+      *nvaluesp = nvalues;
+      return NC_NOERR;
+   }
+
+   *nvaluesp = 0;
+   return NC_NOERR;
+}
+
+/** \ingroup variables
+Release a chunk iterator.
+
+\param iterp Iterator from nc_get_chunk_iter().
+
+\returns ::NC_NOERR No error.
+*/
+int
+nc_free_chunk_iter(nc_chunk_iter_t *iterp)
+{
+   if (!iterp)
+      return NC_NOERR;
+   free(iterp->dimlens);
+   free(iterp->tilesizes);
+   free(iterp->index);
+   free(iterp->fillp);
+   free(iterp->buf);
+   free(iterp);
+   return NC_NOERR;
+}
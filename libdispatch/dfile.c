@@ -125,9 +125,8 @@ static int NC_check_file_type(const char *path, int flags, void *parameters,
 {
    char magic[MAGIC_NUMBER_LEN];
    int status = NC_NOERR;
-   int diskless = ((flags & NC_DISKLESS) == NC_DISKLESS);
    int use_parallel = ((flags & NC_MPIIO) == NC_MPIIO);
-   int inmemory = (diskless && ((flags & NC_INMEMORY) == NC_INMEMORY));
+   int inmemory = ((flags & NC_INMEMORY) == NC_INMEMORY);
 
    *model = 0;
 
@@ -775,6 +774,122 @@ nc_open_mem(const char* path, int mode, size_t size, void* memory, int* ncidp)
 #endif
 }
 
+/** \ingroup datasets
+Create a netCDF-4 file in memory.
+
+The file is never written to the filesystem. Its final image is
+handed back by nc_close_memio(), and may be sent elsewhere, or opened
+again with nc_open_mem().
+
+\param path Must be non-null, but otherwise only used to set the dataset name.
+
+\param mode the mode flags; must include NC_NETCDF4, and may include
+NC_CLASSIC_MODEL. NC_INMEMORY is added.
+
+\param initialsize How many bytes the image grows by at a time; 0
+for the default. Setting it near the expected size of the file
+avoids copying the image as it grows.
+
+\param ncidp Pointer to location where returned netCDF ID is to be
+stored.
+
+\returns ::NC_NOERR No error.
+
+\returns ::NC_EINVAL Invalid mode flags.
+
+\returns ::NC_EDISKLESS diskless io is not enabled.
+
+\returns ::NC_ENOTBUILT netCDF-4 is not enabled.
+
+<h1>Examples</h1>
+
+Here is an example that creates a file in memory, and gets its image.
+
+@code
+#include <netcdf.h>
+#include <netcdf_mem.h>
+   ...
+int status = NC_NOERR;
+int ncid;
+NC_memio image;
+   ...
+status = nc_create_mem("foo.nc", NC_NETCDF4, 0, &ncid);
+if (status != NC_NOERR) handle_error(status);
+   ...
+status = nc_close_memio(ncid, &image);
+if (status != NC_NOERR) handle_error(status);
+   ...
+free(image.memory);
+@endcode
+*/
+int
+nc_create_mem(const char* path, int mode, size_t initialsize, int* ncidp)
+{
+#if defined(USE_DISKLESS) && defined(USE_NETCDF4)
+    if(path == NULL)
+	return NC_EINVAL;
+    if(!(mode & NC_NETCDF4) || (mode & (NC_MPIIO|NC_MPIPOSIX|NC_MMAP|NC_DISKLESS)))
+	return NC_EINVAL;
+    mode |= NC_INMEMORY;
+    return NC_create(path, mode, initialsize, 0, NULL, 0, NULL, ncidp);
+#elif defined(USE_DISKLESS)
+    return NC_ENOTBUILT;
+#else
+    return NC_EDISKLESS;
+#endif
+}
+
+/** \ingroup datasets
+Close an in-memory file, and hand back its final image.
+
+Like nc_close(), any changes are written first. The file must have
+been created with nc_create_mem() or opened with nc_open_mem().
+
+\param ncid NetCDF ID, from nc_create_mem() or nc_open_mem().
+
+\param memio The size of the image, and a pointer to it, are copied
+here. The caller must free the memory. If NULL, this is just
+nc_close().
+
+\returns ::NC_NOERR No error.
+
+\returns ::NC_EBADID Invalid id passed.
+
+\returns ::NC_EDISKLESS The file is not in memory.
+
+\returns ::NC_ENOTNC4 Not a netCDF-4 file.
+*/
+int
+nc_close_memio(int ncid, NC_memio* memio)
+{
+#ifdef USE_NETCDF4
+   NC* ncp;
+   int stat;
+
+   if(memio == NULL)
+       return nc_close(ncid);
+   if((stat = NC_check_id(ncid, &ncp)))
+       return stat;
+   if(ncp->dispatch != NC4_dispatch_table)
+       return NC_ENOTNC4;
+
+#ifdef USE_REFCOUNT
+   /* The image can't be taken away while the file is still open elsewhere. */
+   if(ncp->refcount > 1)
+       return NC_EINVAL;
+#endif
+   stat = NC4_close_memio(ncid, memio);
+   /* NC_EDISKLESS leaves the file open, as it was not in memory. */
+   if(stat == NC_EDISKLESS)
+       return stat;
+   del_from_NCList(ncp);
+   free_NC(ncp);
+   return stat;
+#else
+   return NC_ENOTNC4;
+#endif
+}
+
 /**
 \internal
 
@@ -0,0 +1,427 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* The persistent http response cache; see nchttpcache.h */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#endif
+#include "netcdf.h"
+#include "nclog.h"
+#include "nchttpcache.h"
+
+#define HASHLEN 16 /* hex digits in an entry name */
+#define URLSUFFIX ".url"
+#define DATSUFFIX ".dat"
+
+typedef struct Entry {
+    char name[HASHLEN+1];
+    time_t used;
+    off_t size;
+} Entry;
+
+/*Forward*/
+static char* entrypath(NChttpcache*, const char* url, const char* suffix);
+static int readheader(const char* path, const char* url, long* lastmodifiedp);
+static int writeheader(const char* path, const char* url, long lastmodified);
+static FILE* opentemp(const char* path, char** tmpp);
+static int commit(char* tmp, const char* path);
+static int copystream(FILE* src, FILE* dst, off_t* sizep);
+static void evict(NChttpcache*, const char* keep);
+
+int
+nchttpcache_init(NChttpcache* cache, const char* dir, unsigned long long maxsize)
+{
+    int stat;
+    memset((void*)cache,0,sizeof(NChttpcache));
+#ifdef _WIN32
+    stat = _mkdir(dir);
+#else
+    stat = mkdir(dir,S_IRUSR | S_IWUSR | S_IXUSR);
+#endif
+    if(stat != 0 && errno != EEXIST) {
+	nclog(NCLOGERR,"Cannot create http cache directory: %s",dir);
+	return NC_EPERM;
+    }
+    errno = 0;
+    cache->dir = strdup(dir);
+    if(cache->dir == NULL) return NC_ENOMEM;
+    cache->maxsize = (maxsize > 0 ? maxsize : NCHTTPCACHE_MAXSIZE);
+    return NC_NOERR;
+}
+
+void
+nchttpcache_clear(NChttpcache* cache)
+{
+    if(cache == NULL) return;
+    if(cache->dir != NULL) free(cache->dir);
+    cache->dir = NULL;
+}
+
+int
+nchttpcache_lookup(NChttpcache* cache, const char* url, long* lastmodifiedp)
+{
+    char* path;
+    int found;
+    if(cache == NULL || cache->dir == NULL) return 0;
+    path = entrypath(cache,url,URLSUFFIX);
+    if(path == NULL) return 0;
+    found = readheader(path,url,lastmodifiedp);
+    free(path);
+    return found;
+}
+
+int
+nchttpcache_get(NChttpcache* cache, const char* url, NCbytes* buf)
+{
+    int stat = NC_NOERR;
+    char* path = NULL;
+    FILE* f = NULL;
+    long lastmodified;
+    off_t size;
+    unsigned long len = ncbyteslength(buf);
+
+    if(!nchttpcache_lookup(cache,url,&lastmodified))
+	return NC_ENOTFOUND;
+    if((path = entrypath(cache,url,DATSUFFIX)) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((f = fopen(path,"rb")) == NULL)
+	{stat = NC_ENOTFOUND; goto done;}
+    if(fseek(f,0,SEEK_END) < 0 || (size = (off_t)ftell(f)) < 0)
+	{stat = NC_EIO; goto done;}
+    rewind(f);
+    /* Leave room for the null that callers add */
+    if(!ncbytessetalloc(buf,len+(unsigned long)size+1))
+	{stat = NC_ENOMEM; goto done;}
+    if(fread(ncbytescontents(buf)+len,1,(size_t)size,f) != (size_t)size)
+	{stat = NC_EIO; goto done;}
+    ncbytessetlength(buf,len+(unsigned long)size);
+    free(path);
+    /* Rewriting the header marks the entry as just used */
+    if((path = entrypath(cache,url,URLSUFFIX)) != NULL)
+	(void)writeheader(path,url,lastmodified);
+done:
+    if(f != NULL) fclose(f);
+    if(path != NULL) free(path);
+    return stat;
+}
+
+int
+nchttpcache_getfile(NChttpcache* cache, const char* url, FILE* stream, off_t* sizep)
+{
+    int stat = NC_NOERR;
+    char* path = NULL;
+    FILE* f = NULL;
+    long lastmodified;
+
+    if(!nchttpcache_lookup(cache,url,&lastmodified))
+	return NC_ENOTFOUND;
+    if((path = entrypath(cache,url,DATSUFFIX)) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((f = fopen(path,"rb")) == NULL)
+	{stat = NC_ENOTFOUND; goto done;}
+    rewind(stream);
+    if((stat = copystream(f,stream,sizep)) != NC_NOERR)
+	goto done;
+    free(path);
+    if((path = entrypath(cache,url,URLSUFFIX)) != NULL)
+	(void)writeheader(path,url,lastmodified);
+done:
+    if(f != NULL) fclose(f);
+    if(path != NULL) free(path);
+    return stat;
+}
+
+int
+nchttpcache_put(NChttpcache* cache, const char* url, long lastmodified,
+		const char* data, size_t len)
+{
+    int stat = NC_NOERR;
+    char* path = NULL;
+    char* tmp = NULL;
+    FILE* f = NULL;
+
+    if(cache == NULL || cache->dir == NULL || lastmodified < 0)
+	return NC_NOERR; /* nothing to revalidate against */
+    if(len > cache->maxsize)
+	return NC_NOERR;
+    if((path = entrypath(cache,url,DATSUFFIX)) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((f = opentemp(path,&tmp)) == NULL)
+	{stat = NC_EIO; goto done;}
+    if(len > 0 && fwrite(data,1,len,f) != len)
+	{stat = NC_EIO; goto done;}
+    if(fclose(f) != 0)
+	{f = NULL; stat = NC_EIO; goto done;}
+    f = NULL;
+    if((stat = commit(tmp,path)) != NC_NOERR)
+	goto done;
+    tmp = NULL;
+    free(path);
+    if((path = entrypath(cache,url,URLSUFFIX)) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((stat = writeheader(path,url,lastmodified)) != NC_NOERR)
+	goto done;
+    evict(cache,path);
+done:
+    if(f != NULL) fclose(f);
+    if(tmp != NULL) {remove(tmp); free(tmp);}
+    if(path != NULL) free(path);
+    if(stat != NC_NOERR)
+	nclog(NCLOGWARN,"Cannot cache response for %s",url);
+    return stat;
+}
+
+int
+nchttpcache_putfile(NChttpcache* cache, const char* url, long lastmodified,
+		    FILE* stream)
+{
+    int stat = NC_NOERR;
+    char* path = NULL;
+    char* tmp = NULL;
+    FILE* f = NULL;
+    off_t size = 0;
+
+    if(cache == NULL || cache->dir == NULL || lastmodified < 0)
+	return NC_NOERR;
+    if((path = entrypath(cache,url,DATSUFFIX)) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((f = opentemp(path,&tmp)) == NULL)
+	{stat = NC_EIO; goto done;}
+    rewind(stream);
+    if((stat = copystream(stream,f,&size)) != NC_NOERR)
+	goto done;
+    if(fclose(f) != 0)
+	{f = NULL; stat = NC_EIO; goto done;}
+    f = NULL;
+    if((unsigned long long)size > cache->maxsize)
+	goto done; /* tmp is removed below */
+    if((stat = commit(tmp,path)) != NC_NOERR)
+	goto done;
+    tmp = NULL;
+    free(path);
+    if((path = entrypath(cache,url,URLSUFFIX)) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((stat = writeheader(path,url,lastmodified)) != NC_NOERR)
+	goto done;
+    evict(cache,path);
+done:
+    if(f != NULL) fclose(f);
+    if(tmp != NULL) {remove(tmp); free(tmp);}
+    if(path != NULL) free(path);
+    if(stat != NC_NOERR)
+	nclog(NCLOGWARN,"Cannot cache response for %s",url);
+    return stat;
+}
+
+/**************************************************/
+/* Utilities */
+
+/* Return the path of url's entry file with the given suffix; the
+   entry is named by the 64-bit FNV-1a hash of the url */
+static char*
+entrypath(NChttpcache* cache, const char* url, const char* suffix)
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    const unsigned char* p;
+    size_t len;
+    char* path;
+
+    for(p=(const unsigned char*)url;*p;p++) {
+	hash ^= *p;
+	hash *= 1099511628211ULL;
+    }
+    len = strlen(cache->dir) + 1 + HASHLEN + strlen(suffix) + 1;
+    if((path = (char*)malloc(len)) == NULL)
+	return NULL;
+    snprintf(path,len,"%s/%016llx%s",cache->dir,hash,suffix);
+    return path;
+}
+
+/* The header is the Last-Modified time and the url, one per line */
+static int
+readheader(const char* path, const char* url, long* lastmodifiedp)
+{
+    FILE* f;
+    long lastmodified;
+    size_t len = strlen(url);
+    char* line;
+    int found = 0;
+
+    if((f = fopen(path,"r")) == NULL)
+	return 0;
+    if((line = (char*)malloc(len+2)) == NULL)
+	{fclose(f); return 0;}
+    if(fscanf(f,"%ld\n",&lastmodified) == 1
+       && fgets(line,(int)len+2,f) != NULL
+       && strncmp(line,url,len) == 0
+       && line[len] == '\n') {
+	found = 1;
+	if(lastmodifiedp) *lastmodifiedp = lastmodified;
+    }
+    free(line);
+    fclose(f);
+    return found;
+}
+
+static int
+writeheader(const char* path, const char* url, long lastmodified)
+{
+    char* tmp = NULL;
+    FILE* f;
+    if((f = opentemp(path,&tmp)) == NULL)
+	return NC_EIO;
+    fprintf(f,"%ld\n%s\n",lastmodified,url);
+    if(fclose(f) != 0) {
+	remove(tmp);
+	free(tmp);
+	return NC_EIO;
+    }
+    return commit(tmp,path);
+}
+
+/* Open a temporary file (unique to this process) next to path */
+static FILE*
+opentemp(const char* path, char** tmpp)
+{
+    size_t len = strlen(path) + 32;
+    char* tmp;
+    FILE* f;
+#ifdef _WIN32
+    int pid = _getpid();
+#else
+    pid_t pid = getpid();
+#endif
+    if((tmp = (char*)malloc(len)) == NULL)
+	return NULL;
+    snprintf(tmp,len,"%s.%ld",path,(long)pid);
+    if((f = fopen(tmp,"wb")) == NULL) {
+	free(tmp);
+	return NULL;
+    }
+    *tmpp = tmp;
+    return f;
+}
+
+/* Move tmp into place as path, and free tmp */
+static int
+commit(char* tmp, const char* path)
+{
+    int stat = NC_NOERR;
+    if(rename(tmp,path) != 0) {
+	/* Some platforms will not rename over an existing file */
+	remove(path);
+	if(rename(tmp,path) != 0) {
+	    remove(tmp);
+	    stat = NC_EIO;
+	}
+    }
+    free(tmp);
+    return stat;
+}
+
+static int
+copystream(FILE* src, FILE* dst, off_t* sizep)
+{
+    char buf[65536];
+    size_t count;
+    off_t size = 0;
+    while((count = fread(buf,1,sizeof(buf),src)) > 0) {
+	if(fwrite(buf,1,count,dst) != count)
+	    return NC_EIO;
+	size += (off_t)count;
+    }
+    if(ferror(src))
+	return NC_EIO;
+    if(fflush(dst) != 0)
+	return NC_EIO;
+    if(sizep) *sizep = size;
+    return NC_NOERR;
+}
+
+static int
+entrycompare(const void* a, const void* b)
+{
+    time_t ta = ((const Entry*)a)->used;
+    time_t tb = ((const Entry*)b)->used;
+    return (ta < tb ? -1 : (ta > tb ? 1 : 0));
+}
+
+/* Remove least recently used entries until the bodies in the cache
+   total no more than cache->maxsize; the entry whose header is keep,
+   just stored, is never removed (mtimes may only have a resolution
+   of seconds, so it need not sort last) */
+static void
+evict(NChttpcache* cache, const char* keep)
+{
+#ifdef HAVE_DIRENT_H
+    DIR* dir;
+    struct dirent* de;
+    Entry* entries = NULL;
+    size_t nentries = 0, nalloc = 0, i;
+    unsigned long long total = 0;
+    size_t pathlen = strlen(cache->dir) + 1 + HASHLEN + 4 + 1;
+    char* path = (char*)malloc(pathlen);
+
+    if(path == NULL) return;
+    if((dir = opendir(cache->dir)) == NULL) {free(path); return;}
+    while((de = readdir(dir)) != NULL) {
+	struct stat st;
+	Entry* e;
+	if(strlen(de->d_name) != HASHLEN + strlen(URLSUFFIX)
+	   || strcmp(de->d_name+HASHLEN,URLSUFFIX) != 0)
+	    continue;
+	if(nentries == nalloc) {
+	    Entry* newentries;
+	    nalloc = (nalloc == 0 ? 64 : 2*nalloc);
+	    newentries = (Entry*)realloc(entries,nalloc*sizeof(Entry));
+	    if(newentries == NULL) goto done;
+	    entries = newentries;
+	}
+	e = &entries[nentries];
+	memcpy(e->name,de->d_name,HASHLEN);
+	e->name[HASHLEN] = '\0';
+	snprintf(path,pathlen,"%s/%s%s",cache->dir,e->name,URLSUFFIX);
+	if(stat(path,&st) != 0) continue;
+	e->used = st.st_mtime;
+	if(strcmp(path,keep) == 0)
+	    e->used = (time_t)-1; /* sorts first; skipped below */
+	snprintf(path,pathlen,"%s/%s%s",cache->dir,e->name,DATSUFFIX);
+	e->size = (stat(path,&st) == 0 ? st.st_size : 0);
+	total += (unsigned long long)e->size;
+	nentries++;
+    }
+    if(total <= cache->maxsize) goto done;
+    qsort(entries,nentries,sizeof(Entry),entrycompare);
+    for(i=0;i<nentries && total > cache->maxsize;i++) {
+	if(entries[i].used == (time_t)-1) continue;
+	/* Remove the header first so the entry vanishes as a whole */
+	snprintf(path,pathlen,"%s/%s%s",cache->dir,entries[i].name,URLSUFFIX);
+	remove(path);
+	snprintf(path,pathlen,"%s/%s%s",cache->dir,entries[i].name,DATSUFFIX);
+	remove(path);
+	total -= (unsigned long long)entries[i].size;
+    }
+done:
+    closedir(dir);
+    if(entries != NULL) free(entries);
+    free(path);
+#endif
+}
@@ -243,6 +243,51 @@ nc_inq_varnatts(int ncid, int varid, int *nattsp)
 		     nattsp);
 }
 
+/** \ingroup variables
+Learn where the data of a variable starts in a classic format file.
+
+Two files in which all variables have the same offsets and record
+strides hold their data at the same places, so the data can be copied
+between them as bytes.
+
+\param ncid NetCDF ID, from a previous call to nc_open() or
+nc_create().
+
+\param varid Variable ID
+
+\param offsetp Pointer where the offset in the file of the first
+value of the variable will be stored. \ref ignored_if_null.
+
+\param recstridep Pointer where the distance in bytes from each record
+of a record variable to the next will be stored, or 0 for a fixed size
+variable. \ref ignored_if_null.
+
+\returns ::NC_NOERR No error.
+\returns ::NC_EBADID Bad ncid.
+\returns ::NC_ENOTVAR Invalid variable ID.
+\returns ::NC_EINDEFINE Offsets aren't known until define mode ends.
+\returns ::NC_ENOTNC3 Not a netCDF classic, 64-bit offset or CDF5 file.
+ */
+int
+nc_inq_var_offset(int ncid, int varid, long long *offsetp,
+		  long long *recstridep)
+{
+   NC* ncp;
+   int stat = NC_check_id(ncid,&ncp);
+   if(stat != NC_NOERR) return stat;
+   TRACE(nc_inq_var_offset);
+   return ncp->dispatch->inq_var_offset(ncid, varid, offsetp, recstridep);
+}
+
+/* Dispatch layers that don't store variables at fixed offsets in a
+   classic format file */
+int
+NCDEFAULT_inq_var_offset(int ncid, int varid, long long *offsetp,
+			 long long *recstridep)
+{
+   return NC_ENOTNC3;
+}
+
 #ifdef USE_NETCDF4
 /** \ingroup variables
 Learn the storage and deflate settings for a variable.
@@ -127,6 +127,8 @@ NC3_inq_var_all,
 
 NC3_var_par_access,
 
+NC3_inq_var_offset,
+
 #ifdef USE_NETCDF4
 NC3_show_metadata,
 NC3_inq_unlimdims,
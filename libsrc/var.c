@@ -6,6 +6,7 @@
 
 #include "config.h"
 #include "nc3internal.h"
+#include "ncdispatch.h"
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -717,6 +718,45 @@ NC3_inq_var(int ncid,
 	return NC_NOERR;
 }
 
+
+/*
+ * Get the offset in the file of the first value of a variable, and
+ * for record variables the distance from each record of the
+ * variable to the next (0 for fixed size variables).  Two files in
+ * which all variables have the same offsets and strides hold their
+ * data at the same places, so the data can be copied between them
+ * as bytes.
+ */
+int
+NC3_inq_var_offset(int ncid, int varid, long long *offsetp,
+	long long *recstridep)
+{
+	int status;
+	NC *nc;
+	NC3_INFO* ncp;
+	NC_var *varp;
+
+	status = NC_check_id(ncid, &nc);
+	if(status != NC_NOERR)
+		return status;
+	ncp = NC3_DATA(nc);
+
+	/* offsets aren't settled until define mode ends */
+	if(NC_indef(ncp))
+		return NC_EINDEFINE;
+
+	varp = elem_NC_vararray(&ncp->vars, (size_t)varid);
+	if(varp == NULL)
+		return NC_ENOTVAR;
+
+	if(offsetp != NULL)
+		*offsetp = (long long) varp->begin;
+	if(recstridep != NULL)
+		*recstridep = IS_RECVAR(varp) ? (long long) ncp->recsize : 0;
+
+	return NC_NOERR;
+}
+
 int
 NC3_rename_var(int ncid, int varid, const char *unewname)
 {
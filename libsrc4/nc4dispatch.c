@@ -58,6 +58,8 @@ NC4_inq_var_all,
 
 NC4_var_par_access,
 
+NCDEFAULT_inq_var_offset,
+
 NC4_show_metadata,
 NC4_inq_unlimdims,
 
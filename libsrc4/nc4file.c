@@ -29,6 +29,7 @@ extern int nc4_vararray_add(NC_GRP_INFO_T *grp,
 #ifdef USE_DISKLESS
 #include <hdf5_hl.h>
 #endif
+#include "netcdf_mem.h"
 
 /* When we have open objects at file close, should
    we log them or print to stdout. Default is to log
@@ -116,7 +117,15 @@ att_read_var_callbk(hid_t loc_id, const char *att_name, const H5A_info_t *ainfo,
 /* Define the illegal mode flags */
 static const int ILLEGAL_OPEN_FLAGS = (NC_MMAP|NC_64BIT_OFFSET);
 
+#ifdef USE_DISKLESS
+static const int ILLEGAL_CREATE_FLAGS = (NC_NOWRITE|NC_MMAP|NC_64BIT_OFFSET|NC_CDF5);
+#else
 static const int ILLEGAL_CREATE_FLAGS = (NC_NOWRITE|NC_MMAP|NC_INMEMORY|NC_64BIT_OFFSET|NC_CDF5);
+#endif
+
+/* How much the image of a file created in memory grows by, unless
+ * an initial size was given. */
+#define INMEMORY_INCREMENT (64 * 1024)
 
 extern void reportopenobjects(int log, hid_t);
 
@@ -148,7 +157,7 @@ typedef struct NC4_rec_read_metadata_ud
 /* Forward */
 static int NC4_enddef(int ncid);
 static int nc4_rec_read_metadata(NC_GRP_INFO_T *grp);
-static int close_netcdf4_file(NC_HDF5_FILE_INFO_T *h5, int abort);
+static int close_netcdf4_file(NC_HDF5_FILE_INFO_T *h5, int abort, NC_memio *memio);
 
 /* Define the names of attributes to ignore
  * added by the HDF5 dimension scale; these
@@ -192,6 +201,17 @@ size_t nc4_chunk_cache_size = CHUNK_CACHE_SIZE;
 size_t nc4_chunk_cache_nelems = CHUNK_CACHE_NELEMS;
 float nc4_chunk_cache_preemption = CHUNK_CACHE_PREEMPTION;
 
+/* This is the total number of bytes of chunk cache to be shared out
+ * among all the open variables of all open netCDF-4 files, according
+ * to how often they are used. Zero means each variable keeps its own
+ * chunk cache size. */
+size_t nc4_chunk_cache_budget = 0;
+
+/* This is the default factor by which datasets are grown along their
+ * unlimited dimensions when a write goes past the current extent. A
+ * value of 1 or less turns pre-extension off. */
+float nc4_extent_growth = 1.0f;
+
 /* For performance, fill this array only the first time, and keep it
  * in global memory for each further use. */
 #define NUM_TYPES 12
@@ -263,6 +283,53 @@ nc_get_chunk_cache_ints(int *sizep, int *nelemsp, int *preemptionp)
    return NC_NOERR;
 }
 
+/* Set the chunk cache budget. Instead of each variable having a chunk
+ * cache of fixed size, this many bytes are shared out among the open
+ * chunked variables of all open netCDF-4 files, in proportion to how
+ * often each has been read or written lately. Variables which have
+ * not been used lately lose their chunk caches. A budget of zero
+ * turns this off; caches that were already shared out keep their
+ * current size. */
+int
+nc_set_chunk_cache_budget(size_t budget)
+{
+   nc4_chunk_cache_budget = budget;
+   return NC_NOERR;
+}
+
+/* Get the chunk cache budget. */
+int
+nc_get_chunk_cache_budget(size_t *budgetp)
+{
+   if (budgetp)
+      *budgetp = nc4_chunk_cache_budget;
+   return NC_NOERR;
+}
+
+/* Set the growth factor for unlimited dimensions. When a write goes
+ * past the current HDF5 extent of a dataset, the extent is grown to
+ * at least factor times its current length, so that appending one
+ * record at a time does not call H5Dset_extent for every record. The
+ * extra space is trimmed when the file is synced or closed. Only
+ * affects variables defined or opened *after* it is called. */
+int
+nc_set_extent_growth(float factor)
+{
+   if (factor < 1)
+      return NC_EINVAL;
+   nc4_extent_growth = factor;
+   return NC_NOERR;
+}
+
+/* Get the growth factor for unlimited dimensions. */
+int
+nc_get_extent_growth(float *factorp)
+{
+   if (factorp)
+      *factorp = nc4_extent_growth;
+   return NC_NOERR;
+}
+
 /* This will return the length of a netcdf data type in bytes. */
 int
 nc4typelen(nc_type type)
@@ -370,8 +437,8 @@ nc_check_for_hdf(const char *path, int flags, void* parameters, int *hdf_file)
 /* Create a HDF5/netcdf-4 file. */
 
 static int
-nc4_create_file(const char *path, int cmode, MPI_Comm comm, MPI_Info info,
-                NC *nc)
+nc4_create_file(const char *path, int cmode, size_t initialsz, MPI_Comm comm,
+                MPI_Info info, NC *nc)
 {
    hid_t fcpl_id, fapl_id = -1;
    unsigned flags;
@@ -387,7 +454,7 @@ nc4_create_file(const char *path, int cmode, MPI_Comm comm, MPI_Info info,
 
    assert(nc);
 
-   if(cmode & NC_DISKLESS)
+   if(cmode & (NC_DISKLESS|NC_INMEMORY))
        flags = H5F_ACC_TRUNC;
    else if(cmode & NC_NOCLOBBER)
        flags = H5F_ACC_EXCL;
@@ -398,8 +465,10 @@ nc4_create_file(const char *path, int cmode, MPI_Comm comm, MPI_Info info,
    assert(nc && path);
 
    /* If this file already exists, and NC_NOCLOBBER is specified,
-      return an error. */
-   if (cmode & NC_DISKLESS) {
+      return an error. A file created in memory is never written to
+      disk. */
+   if (cmode & NC_INMEMORY) {
+   } else if (cmode & NC_DISKLESS) {
 #ifndef USE_PARALLEL4
 	if(cmode & NC_WRITE)
 	    persist = 1;
@@ -476,7 +545,10 @@ nc4_create_file(const char *path, int cmode, MPI_Comm comm, MPI_Info info,
       }
    }
 #else /* only set cache for non-parallel... */
-   if(cmode & NC_DISKLESS) {
+   if(cmode & NC_INMEMORY) {
+	 if (H5Pset_fapl_core(fapl_id, initialsz ? initialsz : INMEMORY_INCREMENT, 0))
+	    BAIL(NC_EDISKLESS);
+   } else if(cmode & NC_DISKLESS) {
 	 if (H5Pset_fapl_core(fapl_id, 4096, persist))
 	    BAIL(NC_EDISKLESS);
    }
@@ -555,7 +627,7 @@ exit: /*failure exit*/
 #endif
    if (fapl_id != H5P_DEFAULT) H5Pclose(fapl_id);
    if(!nc4_info) return retval;
-   close_netcdf4_file(nc4_info,1); /* treat like abort */
+   close_netcdf4_file(nc4_info, 1, NULL); /* treat like abort */
    return retval;
 }
 
@@ -608,8 +680,8 @@ NC4_create(const char* path, int cmode, size_t initialsz, int basepe,
    if((cmode & (NC_MPIIO|NC_MPIPOSIX)) == (NC_MPIIO|NC_MPIPOSIX))
       return NC_EINVAL;
 
-   /* Currently no parallel diskless io */
-   if((cmode & (NC_MPIIO | NC_MPIPOSIX)) && (cmode & NC_DISKLESS))
+   /* Currently no parallel diskless or in-memory io */
+   if((cmode & (NC_MPIIO | NC_MPIPOSIX)) && (cmode & (NC_DISKLESS|NC_INMEMORY)))
       return NC_EINVAL;
 
 #ifndef USE_PARALLEL_POSIX
@@ -636,7 +708,7 @@ NC4_create(const char* path, int cmode, size_t initialsz, int basepe,
    LOG((2, "cmode after applying default format: 0x%x", cmode));
 
    nc_file->int_ncid = nc_file->ext_ncid;
-   res = nc4_create_file(nc_file->path, cmode, comm, info, nc_file);
+   res = nc4_create_file(nc_file->path, cmode, initialsz, comm, info, nc_file);
 
    return res;
 }
@@ -2376,7 +2448,7 @@ exit:
 #endif
    if (fapl_id != H5P_DEFAULT) H5Pclose(fapl_id);
    if (!nc4_info) return retval;
-   close_netcdf4_file(nc4_info,1); /*  treat like abort*/
+   close_netcdf4_file(nc4_info, 1, NULL); /*  treat like abort*/
    return retval;
 }
 
@@ -3028,6 +3100,8 @@ sync_netcdf4_file(NC_HDF5_FILE_INFO_T *h5)
 	 return retval;
       if ((retval = nc4_rec_write_metadata(h5->root_grp, bad_coord_order)))
 	 return retval;
+      if ((retval = nc4_rec_trim_extents(h5->root_grp)))
+	 return retval;
    }
 
    if (H5Fflush(h5->hdfid, H5F_SCOPE_GLOBAL) < 0)
@@ -3063,11 +3137,36 @@ NC4_sync(int ncid)
    return sync_netcdf4_file(nc4_info);
 }
 
+#ifdef USE_DISKLESS
+/* Copy the image of an open HDF5 file into memory allocated here. */
+static int
+get_file_image(hid_t hdfid, NC_memio *memio)
+{
+   ssize_t size;
+
+   if (H5Fflush(hdfid, H5F_SCOPE_GLOBAL) < 0)
+      return NC_EHDFERR;
+   if ((size = H5Fget_file_image(hdfid, NULL, 0)) < 0)
+      return NC_EHDFERR;
+   if (!(memio->memory = malloc((size_t)size)))
+      return NC_ENOMEM;
+   if (H5Fget_file_image(hdfid, memio->memory, (size_t)size) < 0)
+   {
+      free(memio->memory);
+      memio->memory = NULL;
+      return NC_EHDFERR;
+   }
+   memio->size = (size_t)size;
+   return NC_NOERR;
+}
+#endif /* USE_DISKLESS */
+
 /* This function will free all allocated metadata memory, and close
    the HDF5 file. The group that is passed in must be the root group
-   of the file. */
+   of the file. If memio is not NULL, the image of the file is
+   copied into it before it is closed. */
 static int
-close_netcdf4_file(NC_HDF5_FILE_INFO_T *h5, int abort)
+close_netcdf4_file(NC_HDF5_FILE_INFO_T *h5, int abort, NC_memio *memio)
 {
    int retval = NC_NOERR;
 
@@ -3089,6 +3188,13 @@ close_netcdf4_file(NC_HDF5_FILE_INFO_T *h5, int abort)
    if ((retval = nc4_rec_grp_del(&h5->root_grp, h5->root_grp)))
 	goto exit;
 
+   /* Copy out the image of an in-memory file while it is still
+    * open. Close it even if that fails. */
+#ifdef USE_DISKLESS
+   if (memio && !abort)
+      retval = get_file_image(h5->hdfid, memio);
+#endif
+
    /* Close hdf file. */
 #ifdef USE_HDF4
    if (h5->hdf4)
@@ -3171,8 +3277,10 @@ NC4_abort(int ncid)
 
    assert(nc4_info);
 
-   /* If we're in define mode, but not redefing the file, delete it. */
-   if (nc4_info->flags & NC_INDEF && !nc4_info->redef)
+   /* If we're in define mode, but not redefing the file, delete
+    * it. A file created in memory has nothing on disk to delete. */
+   if (nc4_info->flags & NC_INDEF && !nc4_info->redef &&
+       !(nc4_info->cmode & NC_INMEMORY))
    {
       delete_file++;
       strncpy(path, nc->path,NC_MAX_NAME);
@@ -3180,7 +3288,7 @@ NC4_abort(int ncid)
 
    /* Free any resources the netcdf-4 library has for this file's
     * metadata. */
-   if ((retval = close_netcdf4_file(nc4_info, 1)))
+   if ((retval = close_netcdf4_file(nc4_info, 1, NULL)))
       return retval;
 
    /* Delete the file, if we should. */
@@ -3194,6 +3302,15 @@ NC4_abort(int ncid)
 /* Close the netcdf file, writing any changes first. */
 int
 NC4_close(int ncid)
+{
+   return NC4_close_memio(ncid, NULL);
+}
+
+/* Close the netcdf file, writing any changes first. If memio is not
+ * NULL, the file must be in memory, and its final image is handed
+ * back in memio. The caller must free it. */
+int
+NC4_close_memio(int ncid, NC_memio *memio)
 {
    NC_GRP_INFO_T *grp;
    NC *nc;
@@ -3212,9 +3329,25 @@ NC4_close(int ncid)
    if (grp->parent)
       return NC_EBADGRPID;
 
+   if (memio)
+   {
+      if (!(h5->cmode & NC_INMEMORY))
+         return NC_EDISKLESS;
+      memio->size = 0;
+      memio->memory = NULL;
+   }
+
    /* Call the nc4 close. */
-   if ((retval = close_netcdf4_file(grp->nc4_info, 0)))
+   if ((retval = close_netcdf4_file(grp->nc4_info, 0, memio)))
+   {
+      if (memio && memio->memory)
+      {
+         free(memio->memory);
+         memio->memory = NULL;
+         memio->size = 0;
+      }
       return retval;
+   }
 
    return NC_NOERR;
 }
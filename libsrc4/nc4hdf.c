@@ -562,6 +562,7 @@ nc4_put_vara(NC *nc, int ncid, int varid, const size_t *startp,
   char *name_to_use;
   int need_to_extend = 0;
   int extend_possible = 0;
+  int grow_extent = 0;
   int retval = NC_NOERR, range_error = 0, i, d2;
   void *bufr = NULL;
 #ifndef HDF5_CONVERT
@@ -640,6 +641,10 @@ nc4_put_vara(NC *nc, int ncid, int varid, const size_t *startp,
         }
     }
 
+  if (!h5->parallel)
+    if ((retval = nc4_chunk_cache_access(var, start, count)))
+      BAIL(retval);
+
   /* Now you would think that no one would be crazy enough to write
      a scalar dataspace with one of the array function calls, but you
      would be wrong. So let's check to see if the dataset is
@@ -744,6 +749,16 @@ nc4_put_vara(NC *nc, int ncid, int varid, const size_t *startp,
                 {
                   xtend_size[d2] = (long long unsigned)(start[d2] + count[d2]);
                   need_to_extend++;
+
+                  /* Grow the extent geometrically if asked to, so
+                   * that appending records one at a time does not
+                   * extend the dataset on every write. */
+                  if (var->extent_growth > 1 && !h5->parallel &&
+                      (double)fdims[d2] * var->extent_growth > (double)xtend_size[d2])
+                    {
+                      xtend_size[d2] = (long long unsigned)((double)fdims[d2] * var->extent_growth);
+                      grow_extent++;
+                    }
                 }
               else
                 xtend_size[d2] = (long long unsigned)fdims[d2];
@@ -788,6 +803,16 @@ nc4_put_vara(NC *nc, int ncid, int varid, const size_t *startp,
                 BAIL(NC_EMPI);
             }
 #endif /* USE_PARALLEL4 */
+          /* The first time the extent gets ahead of the data,
+           * remember the lengths the user has actually written. */
+          if (grow_extent && !var->logical_dims)
+            {
+              if (!(var->logical_dims = malloc(var->ndims * sizeof(hsize_t))))
+                BAIL(NC_ENOMEM);
+              for (d2 = 0; d2 < var->ndims; d2++)
+                var->logical_dims[d2] = fdims[d2];
+            }
+
           /* Convert xtend_size back to hsize_t for use with H5Dset_extent */
           for (d2 = 0; d2 < var->ndims; d2++)
             fdims[d2] = (hsize_t)xtend_size[d2];
@@ -830,6 +855,13 @@ nc4_put_vara(NC *nc, int ncid, int varid, const size_t *startp,
   if (!var->written_to)
     var->written_to = NC_TRUE;
 
+  /* Keep track of the length of the data, if the extent of the
+   * dataset may be longer. */
+  if (var->logical_dims)
+    for (d2 = 0; d2 < var->ndims; d2++)
+      if (start[d2] + count[d2] > var->logical_dims[d2])
+        var->logical_dims[d2] = start[d2] + count[d2];
+
   /* For strict netcdf-3 rules, ignore erange errors between UBYTE
    * and BYTE types. */
   if ((h5->cmode & NC_CLASSIC_MODEL) &&
@@ -946,6 +978,13 @@ nc4_get_vara(NC *nc, int ncid, int varid, const size_t *startp,
   if (H5Sget_simple_extent_dims(file_spaceid, fdims, fmaxdims) < 0)
     BAIL(NC_EHDFERR);
 
+  /* If the extent of the dataset was grown ahead of the data, only
+   * the data that was actually written is visible. */
+  if (var->logical_dims)
+    for (d2 = 0; d2 < var->ndims; d2++)
+      if (fdims[d2] > var->logical_dims[d2])
+        fdims[d2] = var->logical_dims[d2];
+
 #ifdef LOGGING
   log_dim_info(var, fdims, fmaxdims, start, count);
 #endif
@@ -1006,6 +1045,10 @@ nc4_get_vara(NC *nc, int ncid, int varid, const size_t *startp,
     if (count[d2] == 0)
       no_read++;
 
+  if (!no_read && !h5->parallel)
+    if ((retval = nc4_chunk_cache_access(var, start, count)))
+      BAIL(retval);
+
   /* Later on, we will need to know the size of this type in the
    * file. */
   assert(var->type_info->size);
@@ -1834,6 +1877,182 @@ nc4_adjust_var_cache(NC_GRP_INFO_T *grp, NC_VAR_INFO_T * var)
   return NC_NOERR;
 }
 
+/* How many reads and writes, over all open files, between each
+ * sharing out of the chunk cache budget. */
+#define CACHE_BUDGET_PERIOD 256
+
+/* Vars which have been used less than this lately are cold, and lose
+ * their chunk cache when the budget is shared out. */
+#define CACHE_COLD_HEAT 0.5
+
+/* Only reopen a dataset to resize its chunk cache if the size
+ * changes by more than this factor. Reopening flushes the cache. */
+#define CACHE_RESIZE_FACTOR 2
+
+extern size_t nc4_chunk_cache_budget;
+static unsigned long cache_budget_ticks = 0;
+
+/* How many bytes in one chunk of a var? */
+static size_t
+chunk_bytes(NC_VAR_INFO_T *var)
+{
+  size_t bytes = var->type_info->size ? var->type_info->size : sizeof(char *);
+  int d;
+
+  for (d = 0; d < var->ndims; d++)
+    bytes *= var->chunksizes[d];
+  return bytes;
+}
+
+/* Share out the chunk cache budget among the chunked vars of a group
+ * and its subgroups. On the first pass, just add up the heat of the
+ * hot vars. On the second pass, give each hot var its share of the
+ * budget, take the cache away from cold vars, and let the heat
+ * decay. */
+static int
+share_grp_cache_budget(NC_GRP_INFO_T *grp, int pass, double *total_heat)
+{
+  NC_GRP_INFO_T *child_grp;
+  NC_VAR_INFO_T *var;
+  size_t size;
+  int i, retval;
+
+  for (i = 0; i < grp->vars.nelems; i++)
+    {
+      var = grp->vars.value[i];
+      if (!var || var->contiguous || !var->ndims || !var->chunksizes ||
+          !var->hdf_datasetid || var->hdf5_name)
+        continue;
+
+      if (pass == 0)
+        {
+          if (var->cache_heat >= CACHE_COLD_HEAT)
+            *total_heat += var->cache_heat;
+          continue;
+        }
+
+      /* A cache that can't hold a single chunk is no use. */
+      size = 0;
+      if (var->cache_heat >= CACHE_COLD_HEAT && *total_heat > 0)
+        size = (size_t)(nc4_chunk_cache_budget * (var->cache_heat / *total_heat));
+      if (size < chunk_bytes(var))
+        size = 0;
+      var->cache_heat /= 2;
+
+      if (size == var->chunk_cache_size)
+        continue;
+      if (size && var->chunk_cache_size &&
+          size < var->chunk_cache_size * CACHE_RESIZE_FACTOR &&
+          size * CACHE_RESIZE_FACTOR > var->chunk_cache_size)
+        continue;
+
+      LOG((3, "%s: var %s chunk cache %d -> %d bytes", __func__, var->name,
+           var->chunk_cache_size, size));
+      var->chunk_cache_size = size;
+      if ((retval = nc4_reopen_dataset(grp, var)))
+        return retval;
+    }
+
+  for (child_grp = grp->children; child_grp; child_grp = child_grp->l.next)
+    if ((retval = share_grp_cache_budget(child_grp, pass, total_heat)))
+      return retval;
+
+  return NC_NOERR;
+}
+
+/* Share out the chunk cache budget among all the open netCDF-4
+ * files. */
+static int
+share_chunk_cache_budget(void)
+{
+  NC *nc;
+  NC_HDF5_FILE_INFO_T *h5;
+  double total_heat = 0;
+  int pass, i, n, retval;
+
+  for (pass = 0; pass < 2; pass++)
+    for (i = 0, n = count_NCList(); n > 0 && iterate_NCList(i, &nc) == NC_NOERR; i++)
+      {
+        if (!nc)
+          continue;
+        n--;
+        if (nc->dispatch != NC4_dispatch_table)
+          continue;
+        h5 = NC4_DATA(nc);
+        if (!h5 || !h5->root_grp || h5->parallel)
+          continue;
+#ifdef USE_HDF4
+        if (h5->hdf4)
+          continue;
+#endif
+        if ((retval = share_grp_cache_budget(h5->root_grp, pass, &total_heat)))
+          return retval;
+      }
+
+  return NC_NOERR;
+}
+
+/* Keep track of a read or write of a chunked var. HDF5 does not say
+ * how well its chunk cache is doing, so estimate it: the chunks this
+ * access has in common with the last one are probably still in the
+ * cache, if the last one fit in it. If there is a chunk cache budget,
+ * now and then share it out again among all the open vars. */
+int
+nc4_chunk_cache_access(NC_VAR_INFO_T *var, const hsize_t *start,
+                       const hsize_t *count)
+{
+  size_t nchunks = 1, noverlap = 1, prev_nchunks = 1;
+  size_t first, last, lo, hi;
+  int had_prev = 1;
+  int d;
+
+  if (var->contiguous || !var->ndims || !var->chunksizes)
+    return NC_NOERR;
+  for (d = 0; d < var->ndims; d++)
+    if (!count[d] || !var->chunksizes[d])
+      return NC_NOERR;
+
+  if (!var->last_chunk_box)
+    {
+      if (!(var->last_chunk_box = malloc(2 * var->ndims * sizeof(size_t))))
+        return NC_ENOMEM;
+      had_prev = 0;
+    }
+
+  /* Find the box of chunks touched, and its overlap with the last. */
+  for (d = 0; d < var->ndims; d++)
+    {
+      first = start[d] / var->chunksizes[d];
+      last = (start[d] + count[d] - 1) / var->chunksizes[d];
+      nchunks *= last - first + 1;
+      if (had_prev)
+        {
+          lo = var->last_chunk_box[2 * d];
+          hi = var->last_chunk_box[2 * d + 1];
+          prev_nchunks *= hi - lo + 1;
+          if (lo < first)
+            lo = first;
+          if (hi > last)
+            hi = last;
+          noverlap *= lo <= hi ? hi - lo + 1 : 0;
+        }
+      var->last_chunk_box[2 * d] = first;
+      var->last_chunk_box[2 * d + 1] = last;
+    }
+  if (!had_prev || prev_nchunks * chunk_bytes(var) > var->chunk_cache_size)
+    noverlap = 0;
+
+  var->cache_accesses++;
+  var->cache_hits += noverlap;
+  var->cache_misses += nchunks - noverlap;
+  var->cache_heat += 1;
+
+  if (nc4_chunk_cache_budget && ++cache_budget_ticks % CACHE_BUDGET_PERIOD == 0)
+    return share_chunk_cache_budget();
+
+  return NC_NOERR;
+}
+
 /* Create a HDF5 defined type from a NC_TYPE_INFO_T struct, and commit
  * it to the file. */
 static int
@@ -2357,6 +2576,40 @@ write_var(NC_VAR_INFO_T *var, NC_GRP_INFO_T *grp, nc_bool_t write_dimid)
   return retval;
 }
 
+/* Make sure the extent of a dataset is at least as long as
+ * new_size in every dimension, without ever shrinking it. */
+static int
+grow_extent_to(NC_VAR_INFO_T *var, hsize_t *new_size)
+{
+  hid_t spaceid;
+  hsize_t fdims[NC_MAX_VAR_DIMS];
+  int need_to_extend = 0;
+  int d;
+
+  if ((spaceid = H5Dget_space(var->hdf_datasetid)) < 0)
+    return NC_EHDFERR;
+  if (H5Sget_simple_extent_dims(spaceid, fdims, NULL) < 0)
+    {
+      H5Sclose(spaceid);
+      return NC_EHDFERR;
+    }
+  if (H5Sclose(spaceid) < 0)
+    return NC_EHDFERR;
+
+  for (d = 0; d < var->ndims; d++)
+    {
+      if (new_size[d] > fdims[d])
+        need_to_extend++;
+      else
+        new_size[d] = fdims[d];
+    }
+
+  if (need_to_extend && H5Dset_extent(var->hdf_datasetid, new_size) < 0)
+    return NC_EHDFERR;
+
+  return NC_NOERR;
+}
+
 static int
 write_dim(NC_DIM_INFO_T *dim, NC_GRP_INFO_T *grp, nc_bool_t write_dimid)
 {
@@ -2468,7 +2721,20 @@ write_dim(NC_DIM_INFO_T *dim, NC_GRP_INFO_T *grp, nc_bool_t write_dimid)
 	      assert(v1->dim[d1] && v1->dim[d1]->dimid == v1->dimids[d1]);
 	      new_size[d1] = v1->dim[d1]->len;
             }
-          if (H5Dset_extent(v1->hdf_datasetid, new_size) < 0) {
+
+          /* If the coordinate variable's extent was grown ahead of
+           * its data, just lengthen the data. The extent will be
+           * trimmed back when the file is synced. */
+          if (v1->logical_dims)
+            {
+              for (d1 = 0; d1 < v1->ndims; d1++)
+                v1->logical_dims[d1] = new_size[d1];
+              if ((retval = grow_extent_to(v1, new_size))) {
+                free(new_size);
+                BAIL(retval);
+              }
+            }
+          else if (H5Dset_extent(v1->hdf_datasetid, new_size) < 0) {
             free(new_size);
             BAIL(NC_EHDFERR);
           }
@@ -2665,6 +2931,40 @@ nc4_rec_write_groups_types(NC_GRP_INFO_T *grp)
   return NC_NOERR;
 }
 
+/* Recursively trim the extents of datasets that were grown ahead of
+ * their data back to the length of the data, so that other readers
+ * of the file never see the extra space. */
+int
+nc4_rec_trim_extents(NC_GRP_INFO_T *grp)
+{
+  NC_GRP_INFO_T *child_grp;
+  NC_VAR_INFO_T *var;
+  int retval;
+  int i;
+
+  assert(grp && grp->name);
+  LOG((3, "%s: grp->name %s", __func__, grp->name));
+
+  for (i = 0; i < grp->vars.nelems; i++)
+    {
+      var = grp->vars.value[i];
+      if (!var || !var->logical_dims)
+        continue;
+      LOG((4, "%s: trimming extent of var %s", __func__, var->name));
+      if (var->hdf_datasetid &&
+          H5Dset_extent(var->hdf_datasetid, var->logical_dims) < 0)
+        return NC_EHDFERR;
+      free(var->logical_dims);
+      var->logical_dims = NULL;
+    }
+
+  for (child_grp = grp->children; child_grp; child_grp = child_grp->l.next)
+    if ((retval = nc4_rec_trim_extents(child_grp)))
+      return retval;
+
+  return NC_NOERR;
+}
+
 /*! Copy data from one buffer to another, performing appropriate data conversion.
 
   This function will copy data from one buffer to another, in
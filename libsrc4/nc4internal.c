@@ -39,6 +39,7 @@ h5catch(void* ignored)
 extern size_t nc4_chunk_cache_size;
 extern size_t nc4_chunk_cache_nelems;
 extern float nc4_chunk_cache_preemption;
+extern float nc4_extent_growth;
 
 /* This is to track opened HDF5 objects to make sure they are
  * closed. */
@@ -165,6 +166,10 @@ find_var_dim_max_length(NC_GRP_INFO_T *grp, int varid, int dimid, size_t *maxlen
 	 BAIL(NC_EHDFERR);
        LOG((5, "find_var_dim_max_length: varid %d len %d max: %d",
 	    varid, (int)h5dimlen[0], (int)h5dimlenmax[0]));
+       /* If the extent was pre-grown, only report what was written. */
+       if (var->logical_dims)
+	 for (d=0; d<dataset_ndims; d++)
+	   h5dimlen[d] = var->logical_dims[d];
        for (d=0; d<dataset_ndims; d++) {
 	 if (var->dimids[d] == dimid) {
 	   *maxlen = *maxlen > h5dimlen[d] ? *maxlen : h5dimlen[d];
@@ -681,6 +686,7 @@ nc4_var_add(NC_VAR_INFO_T **var)
    new_var->chunk_cache_size = nc4_chunk_cache_size;
    new_var->chunk_cache_nelems = nc4_chunk_cache_nelems;
    new_var->chunk_cache_preemption = nc4_chunk_cache_preemption;
+   new_var->extent_growth = nc4_extent_growth;
 
    /* Set the var pointer, if one was given */
    if (var)
@@ -1040,6 +1046,12 @@ nc4_var_del(NC_VAR_INFO_T *var)
    if (var->dim)
      {free(var->dim); var->dim = NULL;}
 
+   if (var->logical_dims)
+     {free(var->logical_dims); var->logical_dims = NULL;}
+
+   if (var->last_chunk_box)
+     {free(var->last_chunk_box); var->last_chunk_box = NULL;}
+
    /* Delete any fill value allocation. This must be done before the
     * type_info is freed. */
    if (var->fill_value)
@@ -197,6 +197,128 @@ nc_get_var_chunk_cache_ints(int ncid, int varid, int *sizep,
    return NC_NOERR;
 }
 
+/* Get statistics about the chunk cache of a var: how many times it
+ * has been read or written, and how many of the chunks touched were
+ * probably found in the chunk cache, or had to be read from the
+ * file. HDF5 does not report this, so it is estimated from the chunks
+ * touched by consecutive accesses, and the size of the cache. */
+int
+nc_inq_var_chunk_cache_stats(int ncid, int varid, unsigned long long *accessesp,
+                             unsigned long long *hitsp, unsigned long long *missesp)
+{
+   NC *nc;
+   NC_GRP_INFO_T *grp;
+   NC_HDF5_FILE_INFO_T *h5;
+   NC_VAR_INFO_T *var;
+   int retval;
+
+   /* Find info for this file and group, and set pointer to each. */
+   if ((retval = nc4_find_nc_grp_h5(ncid, &nc, &grp, &h5)))
+      return retval;
+   if (!h5)
+      return NC_ENOTNC4;
+   assert(nc && grp && h5);
+
+   /* Find the var. */
+   if (varid < 0 || varid >= grp->vars.nelems)
+     return NC_ENOTVAR;
+   var = grp->vars.value[varid];
+   if (!var) return NC_ENOTVAR;
+   assert(var->varid == varid);
+
+   if (accessesp)
+      *accessesp = var->cache_accesses;
+   if (hitsp)
+      *hitsp = var->cache_hits;
+   if (missesp)
+      *missesp = var->cache_misses;
+
+   return NC_NOERR;
+}
+
+/* Find out whether the chunk of a var containing startp has ever
+ * been written, without reading it. Chunks that were never written
+ * take no space in the file. Used by nc_next_chunk_iter(). */
+int
+NC4_inq_chunk_written(int ncid, int varid, const size_t *startp, int *writtenp)
+{
+   NC *nc;
+   NC_GRP_INFO_T *grp;
+   NC_HDF5_FILE_INFO_T *h5;
+   NC_VAR_INFO_T *var;
+#ifdef HDF5_HAS_CHUNK_INFO
+   hsize_t offset[NC_MAX_VAR_DIMS], fdims[NC_MAX_VAR_DIMS];
+   hsize_t chunk_bytes;
+   haddr_t chunk_addr;
+   unsigned filter_mask;
+   hid_t datasetid, spaceid;
+   int d;
+#endif
+   int retval;
+
+   assert(writtenp);
+
+   /* Find info for this file and group, and set pointer to each. */
+   if ((retval = nc4_find_nc_grp_h5(ncid, &nc, &grp, &h5)))
+      return retval;
+   if (!h5)
+      return NC_ENOTNC4;
+   assert(nc && grp && h5);
+
+   /* Find the var. */
+   if (varid < 0 || varid >= grp->vars.nelems)
+     return NC_ENOTVAR;
+   var = grp->vars.value[varid];
+   if (!var) return NC_ENOTVAR;
+   assert(var->varid == varid);
+
+   /* Only chunked vars have chunks that may not be there. */
+   *writtenp = NC_TRUE;
+   if (var->contiguous || !var->ndims)
+      return NC_NOERR;
+
+   /* Nothing has been written to a var that isn't in the file yet. */
+   if (!var->created)
+   {
+      *writtenp = NC_FALSE;
+      return NC_NOERR;
+   }
+
+#ifdef HDF5_HAS_CHUNK_INFO
+   if ((retval = nc4_open_var_grp2(grp, varid, &datasetid)))
+      return retval;
+
+   /* Chunks beyond the extent of the dataset have not been written. */
+   if ((spaceid = H5Dget_space(datasetid)) < 0)
+      return NC_EHDFERR;
+   if (H5Sget_simple_extent_dims(spaceid, fdims, NULL) < 0)
+   {
+      H5Sclose(spaceid);
+      return NC_EHDFERR;
+   }
+   if (H5Sclose(spaceid) < 0)
+      return NC_EHDFERR;
+
+   for (d = 0; d < var->ndims; d++)
+   {
+      if (startp[d] >= fdims[d])
+      {
+	 *writtenp = NC_FALSE;
+	 return NC_NOERR;
+      }
+      offset[d] = startp[d] - startp[d] % var->chunksizes[d];
+   }
+
+   if (H5Dget_chunk_info_by_coord(datasetid, offset, &filter_mask, &chunk_addr,
+                                  &chunk_bytes) < 0)
+      return NC_EHDFERR;
+   *writtenp = chunk_addr != HADDR_UNDEF;
+   return NC_NOERR;
+#else
+   return NC_ENOTBUILT;
+#endif
+}
+
 /* Check a set of chunksizes to see if they specify a chunk that is too big. */
 static int
 check_chunksizes(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var, const size_t *chunksizes)
@@ -1133,6 +1255,256 @@ nc_def_var_chunking_ints(int ncid, int varid, int contiguous, int *chunksizesp)
    return retval;
 }
 
+/* When choosing chunks from access patterns, unlimited dimensions
+ * are assumed to grow to at least this many records. */
+#define ACCESS_NOMINAL_RECS 1024
+
+/* How many times to go round the dimensions looking for better
+ * chunk lengths. */
+#define ACCESS_MAX_ROUNDS 16
+
+/* The cost of visiting a chunk, over and above reading its bytes, as
+ * a number of bytes. This keeps the chunks from getting tiny. */
+#define ACCESS_CHUNK_OVERHEAD 4096
+
+/* Estimate the cost of reading the slabs in counts (nslabs of them,
+ * each of ndims lengths) with the given chunking. The cost of each
+ * slab is the number of bytes that must be read and decompressed
+ * (plus a fixed overhead per chunk), relative to the size of the slab
+ * itself, so that small and large reads weigh the same. */
+static double
+access_cost(int ndims, size_t nslabs, const size_t *counts,
+            const size_t *maxlen, const size_t *chunksizes, size_t type_size)
+{
+   double cost = 0, nchunks, chunk_bytes = (double)type_size;
+   double slab_bytes;
+   size_t s;
+   int d;
+
+   for (d = 0; d < ndims; d++)
+      chunk_bytes *= (double)chunksizes[d];
+
+   for (s = 0; s < nslabs; s++)
+   {
+      const size_t *count = &counts[s * ndims];
+
+      /* A read of a whole dimension crosses all of its chunks. On
+       * average, a shorter read that starts at a random place
+       * crosses 1 + (count - 1)/chunksize chunks. */
+      nchunks = 1;
+      slab_bytes = (double)type_size;
+      for (d = 0; d < ndims; d++)
+      {
+         if (count[d] >= maxlen[d])
+            nchunks *= (double)((maxlen[d] + chunksizes[d] - 1) / chunksizes[d]);
+         else
+            nchunks *= 1 + (double)(count[d] - 1) / (double)chunksizes[d];
+         slab_bytes *= (double)count[d];
+      }
+      cost += nchunks * (chunk_bytes + ACCESS_CHUNK_OVERHEAD) / slab_bytes;
+   }
+
+   return cost;
+}
+
+/* Find chunk sizes that suit the access patterns described by
+ * pattern (NC_ACCESS_* flags) and by nslabs typical slab counts,
+ * keeping each chunk within the default chunk size and the var's
+ * chunk cache. */
+static int
+nc4_find_access_chunksizes(NC_VAR_INFO_T *var, int pattern, size_t nslabs,
+                           const size_t *slabcounts, size_t *chunksizes)
+{
+   size_t *counts, *maxlen;
+   size_t type_size, max_chunk_bytes, chunk_bytes;
+   size_t nall = nslabs, s, save, p2;
+   double cost, try_cost;
+   int d, t, round, time_d = 0;
+   int ndims = var->ndims;
+
+   if (var->type_info->nc_type_class == NC_STRING ||
+       var->type_info->nc_type_class == NC_VLEN)
+      type_size = sizeof(char *);
+   else
+      type_size = var->type_info->size;
+
+   /* Chunks may not be bigger than the default chunk size, and
+    * should fit in the chunk cache. */
+   max_chunk_bytes = DEFAULT_CHUNK_SIZE;
+   if (var->chunk_cache_size && var->chunk_cache_size < max_chunk_bytes)
+      max_chunk_bytes = var->chunk_cache_size;
+
+   if (pattern & NC_ACCESS_TIMESERIES)
+      nall++;
+   if (pattern & NC_ACCESS_SLICE)
+      nall++;
+   if (!(counts = malloc(nall * ndims * sizeof(size_t))))
+      return NC_ENOMEM;
+   if (!(maxlen = malloc(ndims * sizeof(size_t))))
+   {
+      free(counts);
+      return NC_ENOMEM;
+   }
+
+   /* How long may a chunk be along each dimension? Unlimited
+    * dimensions with no records yet are expected to grow. */
+   for (d = 0; d < ndims; d++)
+   {
+      maxlen[d] = var->dim[d]->len;
+      if (var->dim[d]->unlimited && !maxlen[d])
+         maxlen[d] = ACCESS_NOMINAL_RECS;
+   }
+   for (d = ndims - 1; d >= 0; d--)
+      if (var->dim[d]->unlimited)
+         time_d = d;
+
+   /* Turn the patterns into slab counts. A time series reads the
+    * whole record dimension (or the first one if there is none) at a
+    * single point; a slice reads one point of every other dimension,
+    * and all of the last two. */
+   memcpy(counts, slabcounts, nslabs * ndims * sizeof(size_t));
+   for (s = 0; s < nslabs; s++)
+      for (d = 0; d < ndims; d++)
+      {
+         if (counts[s * ndims + d] < 1)
+         {
+            free(maxlen);
+            free(counts);
+            return NC_EINVAL;
+         }
+         if (counts[s * ndims + d] > maxlen[d])
+            maxlen[d] = counts[s * ndims + d];
+      }
+   s = nslabs;
+   if (pattern & NC_ACCESS_TIMESERIES)
+   {
+      for (d = 0; d < ndims; d++)
+         counts[s * ndims + d] = (d == time_d) ? maxlen[d] : 1;
+      s++;
+   }
+   if (pattern & NC_ACCESS_SLICE)
+   {
+      for (d = 0; d < ndims; d++)
+         counts[s * ndims + d] = (d >= ndims - 2) ? maxlen[d] : 1;
+      s++;
+   }
+
+   /* Starting from single values, go round the dimensions, each time
+    * picking the length along that dimension that makes the expected
+    * reads cheapest, until nothing changes. The lengths tried are the
+    * powers of two, and the whole dimension divided by powers of
+    * two. */
+   chunk_bytes = type_size;
+   for (d = 0; d < ndims; d++)
+      chunksizes[d] = 1;
+   cost = access_cost(ndims, nall, counts, maxlen, chunksizes, type_size);
+   for (round = 0; round < ACCESS_MAX_ROUNDS; round++)
+   {
+      int changed = 0;
+
+      for (d = 0; d < ndims; d++)
+      {
+         size_t len, best_len = chunksizes[d];
+
+         save = chunksizes[d];
+         for (p2 = 1; p2 <= maxlen[d]; p2 *= 2)
+         {
+            for (t = 0; t < 2; t++)
+            {
+               len = t ? (maxlen[d] + p2 - 1) / p2 : p2;
+               if (len == save || chunk_bytes / save * len > max_chunk_bytes)
+                  continue;
+               chunksizes[d] = len;
+               try_cost = access_cost(ndims, nall, counts, maxlen, chunksizes, type_size);
+               if (try_cost < cost)
+               {
+                  cost = try_cost;
+                  best_len = len;
+               }
+            }
+         }
+         chunksizes[d] = best_len;
+         if (best_len != save)
+         {
+            chunk_bytes = chunk_bytes / save * best_len;
+            changed++;
+         }
+      }
+      if (!changed)
+         break;
+   }
+
+   /* A chunk may not be longer than its dimension, if the dimension
+    * has a length yet. */
+   for (d = 0; d < ndims; d++)
+   {
+      if (var->dim[d]->len && chunksizes[d] > var->dim[d]->len)
+         chunksizes[d] = var->dim[d]->len;
+      LOG((4, "%s: name %s dim %d chunksize %ld", __func__, var->name, d,
+           chunksizes[d]));
+   }
+
+   free(maxlen);
+   free(counts);
+   return NC_NOERR;
+}
+
+/* Choose the chunking of a variable to suit the way it will be
+ * read. The pattern is a combination of NC_ACCESS_* flags, and may be
+ * supplemented with nslabs typical reads, each given as ndims counts
+ * in slabcountsp. This must be called after nc_def_var and before
+ * nc_enddef, and any later call to nc_def_var_chunking() wins. */
+int
+nc_def_var_access(int ncid, int varid, int pattern, size_t nslabs,
+                  const size_t *slabcountsp)
+{
+   NC *nc;
+   NC_GRP_INFO_T *grp;
+   NC_VAR_INFO_T *var;
+   NC_HDF5_FILE_INFO_T *h5;
+   size_t *cs = NULL;
+   int contiguous = NC_CHUNKED;
+   int retval;
+
+   LOG((2, "%s: ncid 0x%x varid %d pattern %d nslabs %d", __func__, ncid,
+        varid, pattern, nslabs));
+
+   /* Find this ncid's file info. */
+   if ((retval = nc4_find_nc_grp_h5(ncid, &nc, &grp, &h5)))
+      return retval;
+   if (!h5)
+      return NC_ENOTNC4;
+   assert(nc);
+
+#ifdef USE_HDF4
+   if(h5->hdf4)
+	return NC_NOERR;
+#endif
+
+   if ((retval = nc4_find_g_var_nc(nc, ncid, varid, &grp, &var)))
+      return retval;
+   if (pattern & ~(NC_ACCESS_TIMESERIES | NC_ACCESS_SLICE))
+      return NC_EINVAL;
+   if (nslabs && !slabcountsp)
+      return NC_EINVAL;
+   if (var->created)
+      return NC_ELATEDEF;
+
+   /* Scalars are never chunked, and without a pattern there is
+    * nothing to go on. */
+   if (!var->ndims || (!pattern && !nslabs))
+      return NC_NOERR;
+
+   if (!(cs = malloc(var->ndims * sizeof(size_t))))
+      return NC_ENOMEM;
+   if (!(retval = nc4_find_access_chunksizes(var, pattern, nslabs,
+                                             slabcountsp, cs)))
+      retval = nc_def_var_extra(ncid, varid, NULL, NULL, NULL, NULL,
+                                &contiguous, cs, NULL, NULL, NULL);
+   free(cs);
+   return retval;
+}
+
 /* Define fill value behavior for a variable. This must be done after
    nc_def_var and before nc_enddef. */
 int
@@ -1545,6 +1545,8 @@ NCP_inq_var_all,
 
 NCP_var_par_access,
 
+NCDEFAULT_inq_var_offset,
+
 #ifdef USE_NETCDF4
 NCP_show_metadata,
 NCP_inq_unlimdims,
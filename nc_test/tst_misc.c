@@ -61,6 +61,33 @@ main(int argc, char **argv)
    }
 
    SUMMARIZE_ERR;
+#ifndef TEST_PNETCDF
+   printf("*** Testing offsets of variables in a classic file...");
+   {
+      int ncid, dimids[2], varid[3];
+      long long offset, offset1, stride;
+
+      if (nc_create(FILE_NAME, NC_CLOBBER, &ncid)) ERR;
+      if (nc_def_dim(ncid, "t", NC_UNLIMITED, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, "x", 3, &dimids[1])) ERR;
+      if (nc_def_var(ncid, "a", NC_INT, 1, &dimids[1], &varid[0])) ERR;
+      if (nc_def_var(ncid, "b", NC_INT, 1, &dimids[1], &varid[1])) ERR;
+      if (nc_def_var(ncid, "r", NC_SHORT, 2, dimids, &varid[2])) ERR;
+      /* not known until the end of define mode */
+      if (nc_inq_var_offset(ncid, varid[0], &offset, &stride) != NC_EINDEFINE) ERR;
+      if (nc_enddef(ncid)) ERR;
+      if (nc_inq_var_offset(ncid, varid[0], &offset1, &stride)) ERR;
+      if (offset1 <= 0 || stride != 0) ERR;
+      if (nc_inq_var_offset(ncid, varid[1], &offset, NULL)) ERR;
+      if (offset != offset1 + 3 * sizeof(int)) ERR;
+      /* the only record variable's records aren't padded */
+      if (nc_inq_var_offset(ncid, varid[2], &offset, &stride)) ERR;
+      if (offset != offset1 + 6 * sizeof(int) || stride != 3 * sizeof(short)) ERR;
+      if (nc_inq_var_offset(ncid, 3, &offset, &stride) != NC_ENOTVAR) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+#endif
 #ifdef TEST_PNETCDF
    MPI_Finalize();
 #endif
@@ -0,0 +1,105 @@
+/* This is part of the netCDF package.
+   Copyright 2016 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the chunk cache budget, set with nc_set_chunk_cache_budget(),
+   which is shared out among the open vars according to how much they
+   are used, and the chunk cache statistics of each var.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+
+#define FILE_NAME "tst_cache_budget.nc"
+#define NDIMS 2
+#define NVARS 6
+#define NY 64
+#define NX 256
+#define CHUNK_Y 16
+#define NREADS 1000
+#define BUDGET (64 * 1024 * 1024)
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing chunk cache budget.\n");
+   printf("*** testing chunk cache statistics and budget...");
+   {
+      int ncid, dimids[NDIMS], varids[NVARS], contig_varid;
+      size_t chunksizes[NDIMS] = {CHUNK_Y, NX};
+      size_t index[NDIMS] = {0, 0};
+      size_t budget_in, size_in, nelems_in;
+      unsigned long long accesses, hits, misses;
+      float preemption_in, data[NY][NX], val;
+      char name[NC_MAX_NAME + 1];
+      int v, r, y, x;
+
+      if (nc_set_chunk_cache_budget(BUDGET)) ERR;
+      if (nc_get_chunk_cache_budget(&budget_in)) ERR;
+      if (budget_in != BUDGET) ERR;
+
+      for (y = 0; y < NY; y++)
+         for (x = 0; x < NX; x++)
+            data[y][x] = y * NX + x;
+
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         sprintf(name, "var_%d", v);
+         if (nc_def_var(ncid, name, NC_FLOAT, NDIMS, dimids, &varids[v])) ERR;
+         if (nc_def_var_chunking(ncid, varids[v], NC_CHUNKED, chunksizes)) ERR;
+      }
+      if (nc_def_var(ncid, "contig", NC_FLOAT, NDIMS, dimids, &contig_varid)) ERR;
+      if (nc_def_var_chunking(ncid, contig_varid, NC_CONTIGUOUS, NULL)) ERR;
+      if (nc_enddef(ncid)) ERR;
+
+      /* Write each var in one go, touching all its chunks. */
+      for (v = 0; v < NVARS; v++)
+         if (nc_put_var_float(ncid, varids[v], &data[0][0])) ERR;
+      if (nc_put_var_float(ncid, contig_varid, &data[0][0])) ERR;
+
+      /* Read the same value of the first var over and over. */
+      for (r = 0; r < NREADS; r++)
+      {
+         if (nc_get_var1_float(ncid, varids[0], index, &val)) ERR;
+         if (val != 0) ERR;
+      }
+
+      /* Every read after the write found its chunk in the cache. */
+      if (nc_inq_var_chunk_cache_stats(ncid, varids[0], &accesses, &hits, &misses)) ERR;
+      if (accesses != NREADS + 1 || hits != NREADS || misses != NY / CHUNK_Y) ERR;
+      if (nc_inq_var_chunk_cache_stats(ncid, varids[1], &accesses, &hits, &misses)) ERR;
+      if (accesses != 1 || hits != 0 || misses != NY / CHUNK_Y) ERR;
+      if (nc_inq_var_chunk_cache_stats(ncid, contig_varid, &accesses, &hits, &misses)) ERR;
+      if (accesses || hits || misses) ERR;
+      if (nc_inq_var_chunk_cache_stats(ncid, NVARS + 1, &accesses, &hits, &misses) != NC_ENOTVAR) ERR;
+
+      /* The busy var has most of the budget, the others have gone
+       * cold and lost their caches. */
+      if (nc_get_var_chunk_cache(ncid, varids[0], &size_in, &nelems_in, &preemption_in)) ERR;
+      if (size_in < BUDGET / 2) ERR;
+      for (v = 1; v < NVARS; v++)
+      {
+         if (nc_get_var_chunk_cache(ncid, varids[v], &size_in, &nelems_in, &preemption_in)) ERR;
+         if (size_in) ERR;
+      }
+
+      /* The cold vars can still be read. */
+      for (v = 1; v < NVARS; v++)
+      {
+         index[0] = NY - 1;
+         index[1] = NX - 1;
+         if (nc_get_var1_float(ncid, varids[v], index, &val)) ERR;
+         if (val != data[NY - 1][NX - 1]) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+
+      /* Turn off the budget. */
+      if (nc_set_chunk_cache_budget(0)) ERR;
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
@@ -0,0 +1,204 @@
+/* This is part of the netCDF package.
+   Copyright 2016 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the chunk iterator, nc_get_chunk_iter() and friends.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+
+#define FILE_NAME "tst_chunk_iter.nc"
+#define CLASSIC_FILE_NAME "tst_chunk_iter_classic.nc"
+#define NDIMS 2
+#define NY 10
+#define NX 12
+#define CHUNK_Y 4
+#define CHUNK_X 5
+#define NUM_TILES 9
+#define NUM_RECS 3
+#define BIG_Y 600
+#define BIG_X 1000
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing chunk iterator.\n");
+   printf("*** testing tiles of a chunked var...");
+   {
+      int ncid, dimids[NDIMS], varid, contig_varid, scalar_varid;
+      size_t chunksizes[NDIMS] = {CHUNK_Y, CHUNK_X};
+      size_t start[NDIMS], count[NDIMS], nvalues, total;
+      size_t expected_count[NUM_TILES][NDIMS] = {{4, 5}, {4, 5}, {4, 2},
+                                                 {4, 5}, {4, 5}, {4, 2},
+                                                 {2, 5}, {2, 5}, {2, 2}};
+      nc_chunk_iter_t *iterp;
+      float data[CHUNK_Y][CHUNK_X];
+      int y, x, t;
+
+      for (y = 0; y < CHUNK_Y; y++)
+         for (x = 0; x < CHUNK_X; x++)
+            data[y][x] = y * CHUNK_X + x;
+
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+      if (nc_def_var(ncid, "chunked", NC_FLOAT, NDIMS, dimids, &varid)) ERR;
+      if (nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunksizes)) ERR;
+      if (nc_def_var(ncid, "contig", NC_FLOAT, NDIMS, dimids, &contig_varid)) ERR;
+      if (nc_def_var_chunking(ncid, contig_varid, NC_CONTIGUOUS, NULL)) ERR;
+      if (nc_def_var(ncid, "scalar", NC_INT, 0, NULL, &scalar_varid)) ERR;
+      if (nc_get_chunk_iter(ncid, varid, 0x10, &iterp) != NC_EINVAL) ERR;
+      if (nc_enddef(ncid)) ERR;
+
+      /* Write the first and the last chunk only. */
+      start[0] = 0;
+      start[1] = 0;
+      count[0] = CHUNK_Y;
+      count[1] = CHUNK_X;
+      if (nc_put_vara_float(ncid, varid, start, count, &data[0][0])) ERR;
+      start[0] = 2 * CHUNK_Y;
+      start[1] = 2 * CHUNK_X;
+      count[0] = NY - start[0];
+      count[1] = NX - start[1];
+      if (nc_put_vara_float(ncid, varid, start, count, &data[0][0])) ERR;
+      if (nc_close(ncid)) ERR;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+
+      /* All the tiles, in order, covering the var. */
+      if (nc_get_chunk_iter(ncid, varid, 0, &iterp)) ERR;
+      for (t = 0, total = 0; ; t++)
+      {
+         if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+         if (!nvalues)
+            break;
+         if (t >= NUM_TILES) ERR;
+         if (start[0] != (t / 3) * CHUNK_Y || start[1] != (t % 3) * CHUNK_X) ERR;
+         if (count[0] != expected_count[t][0] || count[1] != expected_count[t][1]) ERR;
+         if (nvalues != count[0] * count[1]) ERR;
+         total += nvalues;
+      }
+      if (t != NUM_TILES || total != NY * NX) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      /* Only the chunks that were written. */
+      if (nc_get_chunk_iter(ncid, varid, NC_CHUNK_ITER_SKIP_FILL, &iterp)) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues != CHUNK_Y * CHUNK_X || start[0] || start[1]) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues != 4 || start[0] != 2 * CHUNK_Y || start[1] != 2 * CHUNK_X) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      /* A contiguous var is one tile. */
+      if (nc_get_chunk_iter(ncid, contig_varid, 0, &iterp)) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues != NY * NX || start[0] || start[1] || count[0] != NY || count[1] != NX) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      /* So is a scalar. */
+      if (nc_get_chunk_iter(ncid, scalar_varid, 0, &iterp)) ERR;
+      if (nc_next_chunk_iter(iterp, NULL, NULL, &nvalues)) ERR;
+      if (nvalues != 1) ERR;
+      if (nc_next_chunk_iter(iterp, NULL, NULL, &nvalues)) ERR;
+      if (nvalues) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   printf("*** testing tiles of a classic record var...");
+   {
+      int ncid, dimids[NDIMS], varid;
+      size_t start[NDIMS] = {0, 0}, count[NDIMS] = {1, NX}, nvalues;
+      nc_chunk_iter_t *iterp;
+      int data[NX];
+      int x, r;
+
+      for (x = 0; x < NX; x++)
+         data[x] = x;
+
+      if (nc_create(CLASSIC_FILE_NAME, NC_CLOBBER, &ncid)) ERR;
+      if (nc_def_dim(ncid, "time", NC_UNLIMITED, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+      if (nc_def_var(ncid, "rec", NC_INT, NDIMS, dimids, &varid)) ERR;
+      if (nc_enddef(ncid)) ERR;
+
+      /* Skip the middle record, so it is filled. */
+      if (nc_put_vara_int(ncid, varid, start, count, data)) ERR;
+      start[0] = NUM_RECS - 1;
+      if (nc_put_vara_int(ncid, varid, start, count, data)) ERR;
+      if (nc_close(ncid)) ERR;
+
+      if (nc_open(CLASSIC_FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+
+      /* One tile per record. */
+      if (nc_get_chunk_iter(ncid, varid, 0, &iterp)) ERR;
+      for (r = 0; ; r++)
+      {
+         if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+         if (!nvalues)
+            break;
+         if (start[0] != r || start[1] || count[0] != 1 || count[1] != NX) ERR;
+      }
+      if (r != NUM_RECS) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      /* The filled record is skipped. */
+      if (nc_get_chunk_iter(ncid, varid, NC_CHUNK_ITER_SKIP_FILL, &iterp)) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues != NX || start[0] != 0) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues != NX || start[0] != NUM_RECS - 1) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   printf("*** testing a classic var bigger than the scan buffer...");
+   {
+      int ncid, dimids[NDIMS], varid, empty_varid;
+      size_t start[NDIMS] = {BIG_Y - 1, BIG_X - 1}, count[NDIMS], nvalues;
+      nc_chunk_iter_t *iterp;
+      int last = 42;
+
+      if (nc_create(CLASSIC_FILE_NAME, NC_CLOBBER|NC_64BIT_OFFSET, &ncid)) ERR;
+      if (nc_def_dim(ncid, "y", BIG_Y, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, "x", BIG_X, &dimids[1])) ERR;
+      if (nc_def_var(ncid, "big", NC_INT, NDIMS, dimids, &varid)) ERR;
+      if (nc_def_var(ncid, "empty", NC_INT, NDIMS, dimids, &empty_varid)) ERR;
+      if (nc_enddef(ncid)) ERR;
+
+      /* Only the very last value isn't the fill value. */
+      if (nc_put_var1_int(ncid, varid, start, &last)) ERR;
+      if (nc_close(ncid)) ERR;
+
+      if (nc_open(CLASSIC_FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+
+      /* The whole var is one tile, which is found to be written. */
+      if (nc_get_chunk_iter(ncid, varid, NC_CHUNK_ITER_SKIP_FILL, &iterp)) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues != BIG_Y * BIG_X || start[0] || start[1]) ERR;
+      if (count[0] != BIG_Y || count[1] != BIG_X) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      /* A var holding only fill values is skipped. */
+      if (nc_get_chunk_iter(ncid, empty_varid, NC_CHUNK_ITER_SKIP_FILL, &iterp)) ERR;
+      if (nc_next_chunk_iter(iterp, start, count, &nvalues)) ERR;
+      if (nvalues) ERR;
+      if (nc_free_chunk_iter(iterp)) ERR;
+
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
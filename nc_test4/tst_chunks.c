@@ -6,6 +6,7 @@
    $Id: tst_chunks.c,v 1.3 2010/01/21 16:00:18 ed Exp $
 */
 
+#include <config.h>
 #include <nc_tests.h>
 #include "err_macros.h"
 
@@ -287,5 +288,63 @@ main(int argc, char **argv)
       if (nc_abort(ncid)) ERR;
    }
    SUMMARIZE_ERR;
+   printf("**** testing chunk sizes chosen from access patterns...");
+   {
+#define NDIMS_ACC 3
+#define T_LEN 100
+#define Y_LEN 180
+#define X_LEN 360
+#define NUM_ACC_VARS 4
+      int ncid, dimids[NDIMS_ACC], varid[NUM_ACC_VARS];
+      size_t chunks[NDIMS_ACC], slab[NDIMS_ACC] = {1, 10, 20};
+      int contig;
+
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, "time", T_LEN, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, "y", Y_LEN, &dimids[1])) ERR;
+      if (nc_def_dim(ncid, "x", X_LEN, &dimids[2])) ERR;
+      if (nc_def_var(ncid, "ts", NC_FLOAT, NDIMS_ACC, dimids, &varid[0])) ERR;
+      if (nc_def_var(ncid, "slice", NC_FLOAT, NDIMS_ACC, dimids, &varid[1])) ERR;
+      if (nc_def_var(ncid, "both", NC_FLOAT, NDIMS_ACC, dimids, &varid[2])) ERR;
+      if (nc_def_var(ncid, "slab", NC_FLOAT, NDIMS_ACC, dimids, &varid[3])) ERR;
+
+      /* Bad patterns. */
+      if (nc_def_var_access(ncid, varid[0], 0x100, 0, NULL) != NC_EINVAL) ERR;
+      if (nc_def_var_access(ncid, varid[0], 0, 1, NULL) != NC_EINVAL) ERR;
+
+      if (nc_def_var_access(ncid, varid[0], NC_ACCESS_TIMESERIES, 0, NULL)) ERR;
+      if (nc_def_var_access(ncid, varid[1], NC_ACCESS_SLICE, 0, NULL)) ERR;
+      if (nc_def_var_access(ncid, varid[2], NC_ACCESS_TIMESERIES|NC_ACCESS_SLICE,
+                            0, NULL)) ERR;
+      if (nc_def_var_access(ncid, varid[3], 0, 1, slab)) ERR;
+
+      /* A time series is read fastest from long, thin chunks. */
+      if (nc_inq_var_chunking(ncid, varid[0], &contig, chunks)) ERR;
+      if (contig || chunks[0] != T_LEN || chunks[1] != 1 || chunks[2] != 1) ERR;
+
+      /* A slice is read fastest from one slice per chunk. */
+      if (nc_inq_var_chunking(ncid, varid[1], &contig, chunks)) ERR;
+      if (contig || chunks[0] != 1 || chunks[1] != Y_LEN || chunks[2] != X_LEN) ERR;
+
+      /* Both patterns lead to something in between. */
+      if (nc_inq_var_chunking(ncid, varid[2], &contig, chunks)) ERR;
+      if (contig || chunks[0] == 1 || chunks[0] == T_LEN || chunks[1] == Y_LEN) ERR;
+
+      /* A slab should be covered by few chunks, none of them huge. */
+      if (nc_inq_var_chunking(ncid, varid[3], &contig, chunks)) ERR;
+      if (contig || chunks[1] < slab[1] || chunks[2] < slab[2]) ERR;
+      if (chunks[0] * chunks[1] * chunks[2] * sizeof(float) > DEFAULT_CHUNK_SIZE) ERR;
+
+      if (nc_enddef(ncid)) ERR;
+      if (nc_def_var_access(ncid, varid[0], NC_ACCESS_SLICE, 0, NULL) != NC_ELATEDEF) ERR;
+      if (nc_close(ncid)) ERR;
+
+      /* The chunking sticks. */
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (nc_inq_var_chunking(ncid, varid[0], &contig, chunks)) ERR;
+      if (contig || chunks[0] != T_LEN || chunks[1] != 1 || chunks[2] != 1) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
    FINAL_RESULTS;
 }
@@ -0,0 +1,88 @@
+/* This is part of the netCDF package.
+   Copyright 2016 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test creating netCDF-4 files in memory with nc_create_mem(), and
+   getting their images with nc_close_memio().
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <netcdf_mem.h>
+#include <unistd.h>
+
+#define FILE_NAME "tst_create_mem.nc"
+#define DIM_NAME "x"
+#define DIM_LEN 1000
+#define VAR_NAME "data"
+#define ATT_NAME "title"
+#define ATT_VALUE "made in memory"
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing netCDF-4 files created in memory.\n");
+   printf("*** testing bad arguments...");
+   {
+      int ncid;
+      NC_memio image;
+
+      if (nc_create_mem(NULL, NC_NETCDF4, 0, &ncid) != NC_EINVAL) ERR;
+      if (nc_create_mem(FILE_NAME, 0, 0, &ncid) != NC_EINVAL) ERR;
+      if (nc_create_mem(FILE_NAME, NC_NETCDF4|NC_DISKLESS, 0, &ncid) != NC_EINVAL) ERR;
+
+      /* Only in-memory files have an image to hand back. */
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_close_memio(ncid, &image) != NC_EDISKLESS) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   printf("*** testing create in memory and reopen of the image...");
+   {
+      int ncid, dimid, varid, varid_in;
+      int data[DIM_LEN], data_in[DIM_LEN];
+      char att_in[sizeof(ATT_VALUE)];
+      NC_memio image;
+      int i;
+
+      for (i = 0; i < DIM_LEN; i++)
+         data[i] = i * 3;
+
+      /* Nothing must be written to disk. */
+      unlink(FILE_NAME);
+      if (nc_create_mem(FILE_NAME, NC_NETCDF4, 0, &ncid)) ERR;
+      if (nc_def_dim(ncid, DIM_NAME, DIM_LEN, &dimid)) ERR;
+      if (nc_def_var(ncid, VAR_NAME, NC_INT, 1, &dimid, &varid)) ERR;
+      if (nc_put_att_text(ncid, NC_GLOBAL, ATT_NAME, strlen(ATT_VALUE) + 1, ATT_VALUE)) ERR;
+      if (nc_enddef(ncid)) ERR;
+      if (nc_put_var_int(ncid, varid, data)) ERR;
+      if (nc_close_memio(ncid, &image)) ERR;
+      if (!image.memory || image.size < DIM_LEN * sizeof(int)) ERR;
+      if (access(FILE_NAME, F_OK) == 0) ERR;
+
+      /* The image is a netCDF-4 file. */
+      if (memcmp((char *)image.memory + 1, "HDF", 3)) ERR;
+      if (nc_open_mem(FILE_NAME, NC_NOWRITE, image.size, image.memory, &ncid)) ERR;
+      if (nc_inq_varid(ncid, VAR_NAME, &varid_in)) ERR;
+      if (nc_get_var_int(ncid, varid_in, data_in)) ERR;
+      for (i = 0; i < DIM_LEN; i++)
+         if (data_in[i] != data[i]) ERR;
+      if (nc_get_att_text(ncid, NC_GLOBAL, ATT_NAME, att_in)) ERR;
+      if (strcmp(att_in, ATT_VALUE)) ERR;
+      if (nc_close(ncid)) ERR;
+      free(image.memory);
+   }
+   SUMMARIZE_ERR;
+   printf("*** testing abort of a file created in memory...");
+   {
+      int ncid, dimid;
+
+      if (nc_create_mem(FILE_NAME, NC_NETCDF4|NC_CLASSIC_MODEL, 4096, &ncid)) ERR;
+      if (nc_def_dim(ncid, DIM_NAME, DIM_LEN, &dimid)) ERR;
+      if (nc_abort(ncid)) ERR;
+      if (access(FILE_NAME, F_OK) == 0) ERR;
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
@@ -0,0 +1,133 @@
+/* This is part of the netCDF package.
+   Copyright 2016 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test geometric pre-extension of unlimited dimensions, set with
+   nc_set_extent_growth(). The user must only ever see the records
+   that were written, and the HDF5 extent must be trimmed back to
+   that length when the file is closed.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <hdf5.h>
+
+#define FILE_NAME "tst_grow_unlim.nc"
+#define TIME_NAME "time"
+#define LON_NAME "lon"
+#define LON_LEN 3
+#define TEMP_NAME "temp"
+#define PRES_NAME "pres"
+#define NDIMS 2
+#define NUM_RECS 37
+#define GROWTH 2.0f
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing pre-extension of unlimited dimensions.\n");
+   printf("*** testing appending records with extent growth...");
+   {
+      int ncid, dimids[NDIMS], timeid, tempid, presid;
+      float temp[LON_LEN], temp_in[NUM_RECS][LON_LEN];
+      int pres_in[NUM_RECS];
+      float growth_in;
+      size_t start[NDIMS] = {0, 0}, count[NDIMS] = {1, LON_LEN};
+      size_t len_in, time_start[1];
+      double time_val;
+      int r, l;
+
+      if (nc_set_extent_growth(0.5f) != NC_EINVAL) ERR;
+      if (nc_set_extent_growth(GROWTH)) ERR;
+      if (nc_get_extent_growth(&growth_in)) ERR;
+      if (growth_in != GROWTH) ERR;
+
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, TIME_NAME, NC_UNLIMITED, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, LON_NAME, LON_LEN, &dimids[1])) ERR;
+      if (nc_def_var(ncid, TIME_NAME, NC_DOUBLE, 1, dimids, &timeid)) ERR;
+      if (nc_def_var(ncid, TEMP_NAME, NC_FLOAT, NDIMS, dimids, &tempid)) ERR;
+      if (nc_def_var(ncid, PRES_NAME, NC_INT, 1, dimids, &presid)) ERR;
+      if (nc_enddef(ncid)) ERR;
+
+      /* Append records one at a time. Only write pres every other
+       * record, so it lags behind the other vars. */
+      for (r = 0; r < NUM_RECS; r++)
+      {
+         start[0] = time_start[0] = r;
+         time_val = r * 0.5;
+         for (l = 0; l < LON_LEN; l++)
+            temp[l] = r * 10 + l;
+         if (nc_put_var1_double(ncid, timeid, time_start, &time_val)) ERR;
+         if (nc_put_vara_float(ncid, tempid, start, count, temp)) ERR;
+         if (r % 2 == 0 && nc_put_var1_int(ncid, presid, time_start, &r)) ERR;
+
+         /* The length of the unlimited dim is what was written. */
+         if (nc_inq_dimlen(ncid, dimids[0], &len_in)) ERR;
+         if (len_in != r + 1) ERR;
+      }
+
+      /* Reading past the end must fail, even though the extent of
+       * the dataset may be longer. */
+      start[0] = NUM_RECS;
+      if (nc_get_vara_float(ncid, tempid, start, count, temp) != NC_EINVALCOORDS) ERR;
+
+      /* Check the data before closing. */
+      for (r = 0; r < NUM_RECS; r++)
+      {
+         start[0] = r;
+         if (nc_get_vara_float(ncid, tempid, start, count, temp_in[r])) ERR;
+         for (l = 0; l < LON_LEN; l++)
+            if (temp_in[r][l] != r * 10 + l) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+
+      /* Reopen and check the lengths and the data. */
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (nc_inq_dimlen(ncid, dimids[0], &len_in)) ERR;
+      if (len_in != NUM_RECS) ERR;
+      if (nc_get_var_float(ncid, tempid, &temp_in[0][0])) ERR;
+      for (r = 0; r < NUM_RECS; r++)
+         for (l = 0; l < LON_LEN; l++)
+            if (temp_in[r][l] != r * 10 + l) ERR;
+      if (nc_get_var_int(ncid, presid, pres_in)) ERR;
+      for (r = 0; r < NUM_RECS; r += 2)
+         if (pres_in[r] != r) ERR;
+      if (nc_close(ncid)) ERR;
+
+      /* Restore the default. */
+      if (nc_set_extent_growth(1.0f)) ERR;
+   }
+   SUMMARIZE_ERR;
+   printf("*** checking that the HDF5 extents were trimmed...");
+   {
+      hid_t fileid, datasetid, spaceid;
+      hsize_t dims[NDIMS], maxdims[NDIMS];
+
+      if ((fileid = H5Fopen(FILE_NAME, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0) ERR;
+
+      if ((datasetid = H5Dopen2(fileid, TEMP_NAME, H5P_DEFAULT)) < 0) ERR;
+      if ((spaceid = H5Dget_space(datasetid)) < 0) ERR;
+      if (H5Sget_simple_extent_dims(spaceid, dims, maxdims) != NDIMS) ERR;
+      if (dims[0] != NUM_RECS || dims[1] != LON_LEN) ERR;
+      if (H5Sclose(spaceid) < 0 || H5Dclose(datasetid) < 0) ERR;
+
+      /* The lagging var is only as long as what was written to it. */
+      if ((datasetid = H5Dopen2(fileid, PRES_NAME, H5P_DEFAULT)) < 0) ERR;
+      if ((spaceid = H5Dget_space(datasetid)) < 0) ERR;
+      if (H5Sget_simple_extent_dims(spaceid, dims, maxdims) != 1) ERR;
+      if (dims[0] != NUM_RECS) ERR;
+      if (H5Sclose(spaceid) < 0 || H5Dclose(datasetid) < 0) ERR;
+
+      if ((datasetid = H5Dopen2(fileid, TIME_NAME, H5P_DEFAULT)) < 0) ERR;
+      if ((spaceid = H5Dget_space(datasetid)) < 0) ERR;
+      if (H5Sget_simple_extent_dims(spaceid, dims, maxdims) != 1) ERR;
+      if (dims[0] != NUM_RECS) ERR;
+      if (H5Sclose(spaceid) < 0 || H5Dclose(datasetid) < 0) ERR;
+
+      if (H5Fclose(fileid) < 0) ERR;
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
@@ -0,0 +1,189 @@
+/*
+Check that DAP2 reads queued with the [batch] client parameter are
+filled in with the same values as unbatched reads, and only when the
+queue is flushed: when a queued variable is read again, when the batch
+limit is reached, and by nc_sync() and nc_close().  nc_abort() must
+drop the queue without filling anything in.
+
+Usage: test_batch <DAP2 url>
+
+The url should name a dataset from a server that accepts constraints,
+with at least two numeric variables whose first dimension is longer
+than one; the first half of each along that dimension is read.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "netcdf.h"
+
+#define MAXVARS 3
+#define MAXVALUES 100000
+#define UNFILLED 0xa5
+
+static int failures = 0;
+
+static int nvars = 0;
+static char names[MAXVARS][NC_MAX_NAME+1];
+static size_t starts[MAXVARS][NC_MAX_VAR_DIMS];
+static size_t counts[MAXVARS][NC_MAX_VAR_DIMS];
+static size_t nvalues[MAXVARS];
+static double* expected[MAXVARS];
+static double* bufs[MAXVARS+1];
+
+#define CHECK(expr) check((expr),#expr,__LINE__)
+
+static void
+check(int stat, const char* expr, int line)
+{
+    if(stat == NC_NOERR) return;
+    fprintf(stderr,"*** FAIL: %s at line %d: %s\n",expr,line,nc_strerror(stat));
+    exit(1);
+}
+
+/* Pick the variables to read and the part of each to read */
+static void
+selectvars(int ncid)
+{
+    int n, varid;
+    CHECK(nc_inq_nvars(ncid,&n));
+    for(varid=0;varid<n && nvars<MAXVARS;varid++) {
+	int rank, i, dimids[NC_MAX_VAR_DIMS];
+	nc_type type;
+	size_t len, count = 1;
+	CHECK(nc_inq_var(ncid,varid,names[nvars],&type,&rank,dimids,NULL));
+	if(type == NC_CHAR || type == NC_STRING || type > NC_MAX_ATOMIC_TYPE || rank == 0)
+	    continue;
+	for(i=0;i<rank;i++) {
+	    CHECK(nc_inq_dimlen(ncid,dimids[i],&len));
+	    starts[nvars][i] = 0;
+	    counts[nvars][i] = (i == 0 ? len / 2 : len);
+	    count *= counts[nvars][i];
+	}
+	if(count == 0 || count > MAXVALUES) continue;
+	nvalues[nvars++] = count;
+    }
+}
+
+static void
+readvar(int ncid, int i, double* buf)
+{
+    int varid;
+    CHECK(nc_inq_varid(ncid,names[i],&varid));
+    memset(buf,UNFILLED,nvalues[i]*sizeof(double));
+    CHECK(nc_get_vara_double(ncid,varid,starts[i],counts[i],buf));
+}
+
+static int
+isfilled(int i, const double* buf)
+{
+    size_t k;
+    const unsigned char* p = (const unsigned char*)buf;
+    for(k=0;k<nvalues[i]*sizeof(double);k++)
+	if(p[k] != UNFILLED) return 1;
+    return 0;
+}
+
+/* After event, buffer buf of variable i should hold the right values,
+   or be untouched if filled is 0 */
+static void
+expect(const char* event, int i, const double* buf, int filled)
+{
+    if(!filled) {
+	if(isfilled(i,buf)) {
+	    fprintf(stderr,"*** FAIL: %s: read of %s was not queued\n",event,names[i]);
+	    failures++;
+	}
+    } else if(memcmp(buf,expected[i],nvalues[i]*sizeof(double)) != 0) {
+	fprintf(stderr,"*** FAIL: %s: %s does not have the values of an unbatched read\n",
+		event,names[i]);
+	failures++;
+    }
+}
+
+int
+main(int argc, char** argv)
+{
+    int ncid, i;
+    char* url;
+
+    if(argc != 2) {
+	fprintf(stderr,"usage: test_batch <DAP2 url>\n");
+	exit(1);
+    }
+    url = (char*)malloc(strlen(argv[1]) + 64);
+    printf("*** Test: batched reads of %s\n",argv[1]);
+
+    /* What unbatched reads get */
+    CHECK(nc_open(argv[1],NC_NOWRITE,&ncid));
+    selectvars(ncid);
+    if(nvars < 2) {
+	fprintf(stderr,"*** FAIL: %s needs two variables to read in a batch\n",argv[1]);
+	exit(1);
+    }
+    for(i=0;i<nvars;i++) {
+	expected[i] = (double*)malloc(nvalues[i]*sizeof(double));
+	bufs[i] = (double*)malloc(nvalues[i]*sizeof(double));
+	readvar(ncid,i,expected[i]);
+    }
+    bufs[nvars] = (double*)malloc(nvalues[0]*sizeof(double));
+    CHECK(nc_close(ncid));
+
+    sprintf(url,"[batch][noprefetch]%s",argv[1]);
+
+    /* Reading a queued variable again flushes the queue */
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    readvar(ncid,0,bufs[0]);
+    expect("queue",0,bufs[0],0);
+    readvar(ncid,0,bufs[nvars]);
+    expect("read again",0,bufs[0],1);
+    CHECK(nc_sync(ncid));
+    expect("read again and sync",0,bufs[nvars],1);
+    CHECK(nc_close(ncid));
+
+    /* nc_sync() flushes the queue */
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    for(i=0;i<nvars;i++) {
+	readvar(ncid,i,bufs[i]);
+	expect("queue",i,bufs[i],0);
+    }
+    CHECK(nc_sync(ncid));
+    for(i=0;i<nvars;i++)
+	expect("sync",i,bufs[i],1);
+    CHECK(nc_close(ncid));
+
+    /* nc_close() flushes the queue */
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    for(i=0;i<nvars;i++)
+	readvar(ncid,i,bufs[i]);
+    CHECK(nc_close(ncid));
+    for(i=0;i<nvars;i++)
+	expect("close",i,bufs[i],1);
+
+    /* nc_abort() drops the queue */
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    for(i=0;i<nvars;i++)
+	readvar(ncid,i,bufs[i]);
+    CHECK(nc_abort(ncid));
+    for(i=0;i<nvars;i++)
+	expect("abort",i,bufs[i],0);
+
+    /* Queueing the batch limit flushes the queue */
+    sprintf(url,"[batch=2][noprefetch]%s",argv[1]);
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    readvar(ncid,0,bufs[0]);
+    expect("queue",0,bufs[0],0);
+    readvar(ncid,1,bufs[1]);
+    expect("batch limit",0,bufs[0],1);
+    expect("batch limit",1,bufs[1],1);
+    CHECK(nc_close(ncid));
+
+    for(i=0;i<=nvars;i++) {
+	if(i < nvars) free(expected[i]);
+	free(bufs[i]);
+    }
+    free(url);
+    if(failures > 0) exit(1);
+    printf("*** PASS\n");
+    return 0;
+}
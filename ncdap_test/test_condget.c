@@ -0,0 +1,297 @@
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "netcdf.h"
+
+/* Test that the persistent http response cache (HTTP.CACHE.DIR) is
+   revalidated with a conditional GET: a loopback server answers every
+   request that carries If-Modified-Since with 304 Not Modified, so a
+   second open must be served from the cache.  Then the cached data
+   (but not the entries' headers) are removed, as if another process
+   had evicted them after they were looked up; the third open must
+   fetch them again unconditionally. */
+
+#define STRINGIFY(x) #x
+#define TOSTRING(x) STRINGIFY(x)
+
+#define CACHEDIR "tst_condget.d"
+#define RCFILE "tst_condget.rc"
+#define LOGFILE "tst_condget.log"
+#define LASTMODIFIED "Sat, 01 Jan 2000 00:00:00 GMT"
+#define MAXVALUES 1024
+
+static int fail = 0;
+
+/* Map the path of a request to a test file by its suffix */
+static void
+testfile(const char* path, char* file, size_t size)
+{
+    const char* dir = "";
+    const char* suffix = strrchr(path,'.');
+    if(suffix == NULL) suffix = "";
+    if(strcmp(suffix,".dds") == 0 || strcmp(suffix,".das") == 0
+       || strcmp(suffix,".dods") == 0)
+	dir = "ncdap_test/testdata3";
+    else if(strcmp(suffix,".dmr") == 0)
+	dir = "dap4_test/dmrtestfiles";
+    else if(strcmp(suffix,".dap") == 0)
+	dir = "dap4_test/daptestfiles";
+    snprintf(file,size,"%s/%s%s",TOSTRING(TOPSRCDIR),dir,path);
+}
+
+/* Answer one request on connection fd, and log its status and path */
+static void
+answer(int fd, FILE* log)
+{
+    char request[8192];
+    char path[1024];
+    char file[2048];
+    char header[512];
+    size_t len = 0;
+    ssize_t n;
+    char* q;
+    FILE* f;
+
+    /* read up to the end of the request headers */
+    while(len < sizeof(request)-1) {
+	if((n = read(fd,request+len,sizeof(request)-1-len)) <= 0) break;
+	len += (size_t)n;
+	request[len] = '\0';
+	if(strstr(request,"\r\n\r\n") != NULL) break;
+    }
+    request[len] = '\0';
+    if(sscanf(request,"GET %1023s",path) != 1) return;
+    if((q = strchr(path,'?')) != NULL) *q = '\0';
+    if(strstr(request,"If-Modified-Since:") != NULL) {
+	snprintf(header,sizeof(header),
+		 "HTTP/1.1 304 Not Modified\r\nConnection: close\r\n\r\n");
+	(void)write(fd,header,strlen(header));
+	fprintf(log,"304 %s\n",path);
+    } else if(testfile(path,file,sizeof(file)), (f = fopen(file,"rb")) != NULL) {
+	char buf[8192];
+	long size;
+	fseek(f,0,SEEK_END);
+	size = ftell(f);
+	rewind(f);
+	snprintf(header,sizeof(header),
+		 "HTTP/1.1 200 OK\r\nContent-Length: %ld\r\n"
+		 "Last-Modified: %s\r\nConnection: close\r\n\r\n",
+		 size,LASTMODIFIED);
+	(void)write(fd,header,strlen(header));
+	while((len = fread(buf,1,sizeof(buf),f)) > 0)
+	    (void)write(fd,buf,len);
+	fclose(f);
+	fprintf(log,"200 %s\n",path);
+    } else {
+	snprintf(header,sizeof(header),
+		 "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n"
+		 "Connection: close\r\n\r\n");
+	(void)write(fd,header,strlen(header));
+	fprintf(log,"404 %s\n",path);
+    }
+    fflush(log);
+}
+
+/* Start a server on a loopback port in a child process */
+static pid_t
+startserver(int* portp)
+{
+    struct sockaddr_in addr;
+    socklen_t addrlen = sizeof(addr);
+    int sock, on = 1;
+    pid_t pid;
+    FILE* log;
+
+    if((sock = socket(AF_INET,SOCK_STREAM,0)) < 0) return -1;
+    (void)setsockopt(sock,SOL_SOCKET,SO_REUSEADDR,&on,sizeof(on));
+    memset(&addr,0,sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    if(bind(sock,(struct sockaddr*)&addr,sizeof(addr)) < 0
+       || listen(sock,16) < 0
+       || getsockname(sock,(struct sockaddr*)&addr,&addrlen) < 0) {
+	close(sock);
+	return -1;
+    }
+    *portp = ntohs(addr.sin_port);
+    /* create the log before any request can be made */
+    if((log = fopen(LOGFILE,"w")) == NULL) {
+	close(sock);
+	return -1;
+    }
+    if((pid = fork()) == 0) {
+	for(;;) {
+	    int fd = accept(sock,NULL,NULL);
+	    if(fd < 0) continue;
+	    answer(fd,log);
+	    close(fd);
+	}
+    }
+    fclose(log);
+    close(sock);
+    return pid;
+}
+
+/* Count the responses logged since offset that were fetched (200) and
+   not modified (304), and move offset past them */
+static void
+tally(long* offsetp, int* nfetchedp, int* nunmodifiedp)
+{
+    FILE* log = fopen(LOGFILE,"r");
+    char line[1100];
+    *nfetchedp = *nunmodifiedp = 0;
+    if(log == NULL) return;
+    fseek(log,*offsetp,SEEK_SET);
+    while(fgets(line,sizeof(line),log) != NULL) {
+	switch (atoi(line)) {
+	case 200: (*nfetchedp)++; break;
+	case 304: (*nunmodifiedp)++; break;
+	default: break;
+	}
+    }
+    *offsetp = ftell(log);
+    fclose(log);
+}
+
+/* Remove the cached data, or with all set, the whole entries */
+static void
+cleancache(int all)
+{
+    DIR* dir;
+    struct dirent* de;
+    char path[1024];
+    if((dir = opendir(CACHEDIR)) == NULL) return;
+    while((de = readdir(dir)) != NULL) {
+	const char* suffix = strrchr(de->d_name,'.');
+	if(de->d_name[0] == '.') continue;
+	if(!all && (suffix == NULL || strcmp(suffix,".url") == 0)) continue;
+	snprintf(path,sizeof(path),"%s/%s",CACHEDIR,de->d_name);
+	remove(path);
+    }
+    closedir(dir);
+}
+
+/* Open url and read variable name as doubles */
+static int
+readvar(const char* url, const char* name, double* values, size_t* np)
+{
+    int stat, ncid, varid, ndims, i;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t len, n = 1;
+
+    if((stat = nc_open(url,NC_NOWRITE,&ncid))) return stat;
+    if((stat = nc_inq_varid(ncid,name,&varid))) goto done;
+    if((stat = nc_inq_varndims(ncid,varid,&ndims))) goto done;
+    if((stat = nc_inq_vardimid(ncid,varid,dimids))) goto done;
+    for(i=0;i<ndims;i++) {
+	if((stat = nc_inq_dimlen(ncid,dimids[i],&len))) goto done;
+	n *= len;
+    }
+    if(n > MAXVALUES) {stat = NC_EINVAL; goto done;}
+    stat = nc_get_var_double(ncid,varid,values);
+    *np = n;
+done:
+    (void)nc_close(ncid);
+    return stat;
+}
+
+/* Read variable name from url three times: from the server, from the
+   cache, and from the server again after the cached data are gone */
+static void
+testprotocol(const char* url, const char* name)
+{
+    static long offset = 0;
+    double values[MAXVALUES], again[MAXVALUES];
+    size_t n = 0, nagain = 0;
+    int stat, nfetched, nunmodified, ncached;
+    int pass;
+
+    printf("*** Testing conditional GET of %s\n",url);
+    cleancache(1);
+    tally(&offset,&nfetched,&nunmodified);
+
+    if((stat = readvar(url,name,values,&n))) {
+	fprintf(stderr,"*** FAIL: %s: %s\n",url,nc_strerror(stat));
+	fail = 1;
+	return;
+    }
+    /* A response needed twice in one open is already revalidated the
+       second time, so only count the fetches */
+    tally(&offset,&ncached,&nunmodified);
+    if(ncached == 0) {
+	fprintf(stderr,"*** FAIL: first open: nothing fetched\n");
+	fail = 1;
+    }
+
+    for(pass=1;pass<=2;pass++) {
+	/* The second time, the entries are there but their data aren't */
+	if(pass == 2) cleancache(0);
+	if((stat = readvar(url,name,again,&nagain))) {
+	    fprintf(stderr,"*** FAIL: %s open %d: %s\n",url,pass+1,nc_strerror(stat));
+	    fail = 1;
+	    return;
+	}
+	if(nagain != n || memcmp(values,again,n*sizeof(double)) != 0) {
+	    fprintf(stderr,"*** FAIL: open %d: values differ\n",pass+1);
+	    fail = 1;
+	}
+	tally(&offset,&nfetched,&nunmodified);
+	if(pass == 1 && (nfetched != 0 || nunmodified < ncached)) {
+	    fprintf(stderr,"*** FAIL: second open: %d fetched, %d not modified\n",
+		    nfetched,nunmodified);
+	    fail = 1;
+	}
+	/* each evicted response is revalidated, then fetched again */
+	if(pass == 2 && (nfetched != ncached || nunmodified < ncached)) {
+	    fprintf(stderr,"*** FAIL: third open: %d fetched, %d not modified, expected %d\n",
+		    nfetched,nunmodified,ncached);
+	    fail = 1;
+	}
+    }
+}
+
+int
+main(int argc, char** argv)
+{
+    int port;
+    pid_t server;
+    char url[1024];
+    FILE* rc;
+
+    if((rc = fopen(RCFILE,"w")) == NULL) {
+	fprintf(stderr,"*** FAIL: cannot write %s\n",RCFILE);
+	exit(1);
+    }
+    fprintf(rc,"HTTP.CACHE.DIR=%s\n",CACHEDIR);
+    fclose(rc);
+    setenv("DAPRCFILE",RCFILE,1);
+
+    if((server = startserver(&port)) < 0) {
+	fprintf(stderr,"*** FAIL: cannot start a loopback server\n");
+	exit(1);
+    }
+
+    snprintf(url,sizeof(url),"http://127.0.0.1:%d/test.03",port);
+    testprotocol(url,"i32");
+#ifdef ENABLE_DAP4
+    snprintf(url,sizeof(url),"dap4://127.0.0.1:%d/test_atomic_array.nc",port);
+    testprotocol(url,"vu8");
+#endif
+
+    kill(server,SIGTERM);
+    waitpid(server,NULL,0);
+    cleancache(1);
+    if(fail) exit(1);
+    printf("*** PASS\n");
+    return 0;
+}
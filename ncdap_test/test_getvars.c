@@ -0,0 +1,216 @@
+/*
+Compare strided and type converting reads of every numeric variable
+of a DAP2 dataset with the same reads of a netCDF copy of it.
+
+Usage: test_getvars <DAP2 url> <DAP2 url with client parameters>
+
+The copy, test_getvars.nc, is made from whole variable reads of the
+first url, in each variable's own type. The reads compared are those
+of the second url, which may carry client parameters such as [cache]
+or [wholevar]; see tst_fetch.sh.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "netcdf.h"
+
+#define COPY_NAME "test_getvars.nc"
+#define NSELECTIONS 6
+
+static const nc_type memtypes[] = {NC_DOUBLE, NC_FLOAT, NC_INT64, NC_INT, NC_SHORT};
+#define NMEMTYPES (sizeof(memtypes)/sizeof(nc_type))
+
+static int failures = 0;
+
+static int
+getvars(int ncid, int varid, nc_type memtype, const size_t* start,
+        const size_t* count, const ptrdiff_t* stride, void* buf)
+{
+    switch (memtype) {
+    case NC_DOUBLE: return nc_get_vars_double(ncid,varid,start,count,stride,buf);
+    case NC_FLOAT: return nc_get_vars_float(ncid,varid,start,count,stride,buf);
+    case NC_INT64: return nc_get_vars_longlong(ncid,varid,start,count,stride,buf);
+    case NC_INT: return nc_get_vars_int(ncid,varid,start,count,stride,buf);
+    case NC_SHORT: return nc_get_vars_short(ncid,varid,start,count,stride,buf);
+    default: break;
+    }
+    return NC_EBADTYPE;
+}
+
+/* Set up selection sel of a variable with the given shape: the whole
+   variable, an offset block, every other value, and every third value
+   of the outer dimensions with the innermost one whole. The last two
+   lie inside the offset block, which has been read (and possibly
+   cached) before them: a block offset by one more, and every other
+   value of the block. */
+static void
+selection(int sel, int rank, const size_t* shape, size_t* start,
+          size_t* count, ptrdiff_t* stride)
+{
+    int i;
+    for(i=0;i<rank;i++) {
+	start[i] = 0;
+	stride[i] = 1;
+	switch (sel) {
+	case 1:
+	    start[i] = shape[i] / 3;
+	    break;
+	case 2:
+	    start[i] = (shape[i] > 1 ? 1 : 0);
+	    stride[i] = 2;
+	    break;
+	case 3:
+	    if(i < rank - 1) stride[i] = 3;
+	    break;
+	case 4:
+	    start[i] = shape[i] / 3 + (shape[i] > 3 ? 1 : 0);
+	    break;
+	case 5:
+	    start[i] = shape[i] / 3;
+	    stride[i] = 2;
+	    break;
+	}
+	count[i] = (shape[i] - start[i] + (size_t)stride[i] - 1) / (size_t)stride[i];
+    }
+}
+
+/* Compare reads of one variable in every selection and memory type */
+static int
+compare(int ncid, int varid, int dapid, int dapvarid, const char* name)
+{
+    int stat = NC_NOERR;
+    int rank, i, sel;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t shape[NC_MAX_VAR_DIMS], start[NC_MAX_VAR_DIMS], count[NC_MAX_VAR_DIMS];
+    ptrdiff_t stride[NC_MAX_VAR_DIMS];
+    size_t nvalues = 1, m;
+    char *buf = NULL, *dapbuf = NULL;
+
+    if((stat = nc_inq_var(ncid,varid,NULL,NULL,&rank,dimids,NULL))) goto done;
+    for(i=0;i<rank;i++) {
+	if((stat = nc_inq_dimlen(ncid,dimids[i],&shape[i]))) goto done;
+	nvalues *= shape[i];
+    }
+    if(nvalues == 0) goto done;
+    buf = (char*)malloc(nvalues * sizeof(double));
+    dapbuf = (char*)malloc(nvalues * sizeof(double));
+    if(buf == NULL || dapbuf == NULL) {stat = NC_ENOMEM; goto done;}
+
+    for(sel=0;sel<NSELECTIONS;sel++) {
+	selection(sel,rank,shape,start,count,stride);
+	for(m=0;m<NMEMTYPES;m++) {
+	    size_t size, n = 1;
+	    int err, daperr;
+	    if((stat = nc_inq_type(ncid,memtypes[m],NULL,&size))) goto done;
+	    for(i=0;i<rank;i++) n *= count[i];
+	    memset(buf,0,nvalues * sizeof(double));
+	    memset(dapbuf,0,nvalues * sizeof(double));
+	    err = getvars(ncid,varid,memtypes[m],start,count,stride,buf);
+	    daperr = getvars(dapid,dapvarid,memtypes[m],start,count,stride,dapbuf);
+	    /* DAP2 conversions never report values out of range */
+	    if(err == NC_ERANGE)
+		continue;
+	    if(err != daperr) {
+		fprintf(stderr,"*** FAIL: %s selection %d type %d: %s, expected %s\n",
+			name,sel,memtypes[m],nc_strerror(daperr),nc_strerror(err));
+		failures++;
+	    } else if(err == NC_NOERR && memcmp(buf,dapbuf,n * size) != 0) {
+		fprintf(stderr,"*** FAIL: %s selection %d type %d: values differ\n",
+			name,sel,memtypes[m]);
+		failures++;
+	    }
+	}
+    }
+
+done:
+    if(buf) free(buf);
+    if(dapbuf) free(dapbuf);
+    return stat;
+}
+
+/* Copy the numeric variables of dataset dapid into a new netCDF file */
+static int
+copy(int dapid, int* ncidp)
+{
+    int stat = NC_NOERR;
+    int ncid, nvars, varid, rank, i;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t len, nvalues;
+    void* buf;
+
+    if((stat = nc_create(COPY_NAME,NC_CLOBBER,&ncid))) return stat;
+    if((stat = nc_inq_nvars(dapid,&nvars))) return stat;
+    for(varid=0;varid<nvars;varid++) {
+	char name[NC_MAX_NAME+1];
+	int newid, newdims[NC_MAX_VAR_DIMS];
+	nc_type type;
+	if((stat = nc_inq_var(dapid,varid,name,&type,&rank,dimids,NULL))) return stat;
+	if(type == NC_CHAR || type == NC_STRING) continue;
+	for(i=0;i<rank;i++) {
+	    char dimname[NC_MAX_NAME+1];
+	    if((stat = nc_inq_dim(dapid,dimids[i],dimname,&len))) return stat;
+	    if(nc_inq_dimid(ncid,dimname,&newdims[i]) != NC_NOERR
+	       && (stat = nc_def_dim(ncid,dimname,len,&newdims[i]))) return stat;
+	}
+	if((stat = nc_def_var(ncid,name,type,rank,newdims,&newid))) return stat;
+    }
+    if((stat = nc_enddef(ncid))) return stat;
+    for(varid=0;varid<nvars;varid++) {
+	char name[NC_MAX_NAME+1];
+	nc_type type;
+	size_t size;
+	int newid;
+	if((stat = nc_inq_var(dapid,varid,name,&type,&rank,dimids,NULL))) return stat;
+	if(type == NC_CHAR || type == NC_STRING) continue;
+	if((stat = nc_inq_type(dapid,type,NULL,&size))) return stat;
+	for(nvalues=1,i=0;i<rank;i++) {
+	    if((stat = nc_inq_dimlen(dapid,dimids[i],&len))) return stat;
+	    nvalues *= len;
+	}
+	if(nvalues == 0) continue;
+	if((buf = malloc(nvalues * size)) == NULL) return NC_ENOMEM;
+	if((stat = nc_get_var(dapid,varid,buf)) == NC_NOERR
+	   && (stat = nc_inq_varid(ncid,name,&newid)) == NC_NOERR)
+	    stat = nc_put_var(ncid,newid,buf);
+	free(buf);
+	if(stat) return stat;
+    }
+    *ncidp = ncid;
+    return stat;
+}
+
+int
+main(int argc, char** argv)
+{
+    int stat = NC_NOERR;
+    int refid, ncid, dapid, nvars, varid, dapvarid;
+
+    if(argc != 3) {
+	fprintf(stderr,"usage: test_getvars <DAP2 url> <DAP2 url with client parameters>\n");
+	exit(1);
+    }
+    printf("*** Test: strided and converting reads of %s\n",argv[2]);
+    if((stat = nc_open(argv[1],NC_NOWRITE,&refid))) goto done;
+    if((stat = copy(refid,&ncid))) goto done;
+    if((stat = nc_close(refid))) goto done;
+    if((stat = nc_open(argv[2],NC_NOWRITE,&dapid))) goto done;
+    if((stat = nc_inq_nvars(ncid,&nvars))) goto done;
+    for(varid=0;varid<nvars;varid++) {
+	char name[NC_MAX_NAME+1];
+	if((stat = nc_inq_varname(ncid,varid,name))) goto done;
+	if((stat = nc_inq_varid(dapid,name,&dapvarid))) goto done;
+	if((stat = compare(ncid,varid,dapid,dapvarid,name))) goto done;
+    }
+    if((stat = nc_close(dapid))) goto done;
+    if((stat = nc_close(ncid))) goto done;
+
+done:
+    if(stat != NC_NOERR) {
+	fprintf(stderr,"*** FAIL: %s\n",nc_strerror(stat));
+	exit(1);
+    }
+    if(failures > 0) exit(1);
+    printf("*** PASS\n");
+    return 0;
+}
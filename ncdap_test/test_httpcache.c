@@ -0,0 +1,174 @@
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+#endif
+#include "netcdf.h"
+#include "nchttpcache.h"
+
+/* Test the persistent http response cache (HTTP.CACHE.DIR) without a
+   server: entries are stored, looked up by url (constraint included),
+   read back into memory and into files, and evicted least recently
+   used first once the cache exceeds its size limit. */
+
+#define CACHEDIR "tst_httpcache.d"
+
+#define URL "http://localhost/dts/test.03.dods?i32"
+#define URL2 "http://localhost/dts/test.03.dods?f64"
+#define BODY "Dataset {Int32 i32[1];} test;\nData:\n\0\0\0\1\0\0\0\1\0\0\0\7"
+#define BODYLEN (sizeof(BODY)-1)
+
+#define CHECK(expr) check(expr,#expr,__LINE__)
+
+static int fail = 0;
+
+static void
+check(int ok, const char* expr, int line)
+{
+    if(ok) return;
+    fprintf(stderr,"*** FAIL: %s at line %d\n",expr,line);
+    fail = 1;
+}
+
+/* Remove any entries left by an earlier run */
+static void
+cleancache(void)
+{
+#ifdef HAVE_DIRENT_H
+    DIR* dir;
+    struct dirent* de;
+    char path[1024];
+    if((dir = opendir(CACHEDIR)) == NULL) return;
+    while((de = readdir(dir)) != NULL) {
+	if(de->d_name[0] == '.') continue;
+	snprintf(path,sizeof(path),"%s/%s",CACHEDIR,de->d_name);
+	remove(path);
+    }
+    closedir(dir);
+#endif
+}
+
+#ifdef HAVE_DIRENT_H
+/* Make every entry look AGE seconds less recently used than it is,
+   rather than waiting for mtimes, which may only have a resolution of
+   seconds, to move on */
+#define AGE 10
+static void
+ageentries(void)
+{
+    DIR* dir;
+    struct dirent* de;
+    struct stat st;
+    struct utimbuf times;
+    char path[1024];
+    if((dir = opendir(CACHEDIR)) == NULL) return;
+    while((de = readdir(dir)) != NULL) {
+	if(de->d_name[0] == '.') continue;
+	snprintf(path,sizeof(path),"%s/%s",CACHEDIR,de->d_name);
+	if(stat(path,&st) != 0) continue;
+	times.actime = st.st_atime - AGE;
+	times.modtime = st.st_mtime - AGE;
+	CHECK(utime(path,&times) == 0);
+    }
+    closedir(dir);
+}
+#endif
+
+/* Is url cached with the body BODY? */
+static int
+cachedbody(NChttpcache* cache, const char* url)
+{
+    NCbytes* buf = ncbytesnew();
+    int ok = (nchttpcache_get(cache,url,buf) == NC_NOERR
+	      && ncbyteslength(buf) == BODYLEN
+	      && memcmp(ncbytescontents(buf),BODY,BODYLEN) == 0);
+    ncbytesfree(buf);
+    return ok;
+}
+
+int
+main()
+{
+    NChttpcache cache;
+    long lastmodified = -1;
+    char url[256];
+    FILE* f;
+    off_t size = 0;
+    char text[BODYLEN];
+    int i;
+
+    printf("*** Testing the http response cache\n");
+    CHECK(nchttpcache_init(&cache,CACHEDIR,0) == NC_NOERR);
+    cleancache();
+    CHECK(cache.maxsize == NCHTTPCACHE_MAXSIZE);
+
+    printf("*** storing and reading back a response...\n");
+    CHECK(!nchttpcache_lookup(&cache,URL,&lastmodified));
+    CHECK(nchttpcache_put(&cache,URL,1000,BODY,BODYLEN) == NC_NOERR);
+    CHECK(nchttpcache_lookup(&cache,URL,&lastmodified));
+    CHECK(lastmodified == 1000);
+    CHECK(cachedbody(&cache,URL));
+    /* The constraint is part of the key */
+    CHECK(!nchttpcache_lookup(&cache,URL2,&lastmodified));
+    CHECK(nchttpcache_get(&cache,URL2,NULL) == NC_ENOTFOUND);
+
+    printf("*** reading a response into a file and back...\n");
+    CHECK((f = tmpfile()) != NULL);
+    fputs("junk that must be overwritten",f);
+    CHECK(nchttpcache_getfile(&cache,URL,f,&size) == NC_NOERR);
+    CHECK(size == BODYLEN);
+    rewind(f);
+    CHECK(fread(text,1,BODYLEN,f) == BODYLEN && memcmp(text,BODY,BODYLEN) == 0);
+    CHECK(nchttpcache_putfile(&cache,URL2,2000,f) == NC_NOERR);
+    fclose(f);
+    CHECK(nchttpcache_lookup(&cache,URL2,&lastmodified));
+    CHECK(lastmodified == 2000);
+    CHECK(cachedbody(&cache,URL2));
+
+    printf("*** replacing a response...\n");
+    CHECK(nchttpcache_put(&cache,URL,3000,BODY,BODYLEN) == NC_NOERR);
+    CHECK(nchttpcache_lookup(&cache,URL,&lastmodified));
+    CHECK(lastmodified == 3000);
+
+    printf("*** ignoring a response with no Last-Modified time...\n");
+    CHECK(nchttpcache_put(&cache,URL "&x",-1,BODY,BODYLEN) == NC_NOERR);
+    CHECK(!nchttpcache_lookup(&cache,URL "&x",NULL));
+    nchttpcache_clear(&cache);
+
+#ifdef HAVE_DIRENT_H
+    printf("*** evicting the least recently used responses...\n");
+    /* Room for three responses */
+    CHECK(nchttpcache_init(&cache,CACHEDIR,3*BODYLEN) == NC_NOERR);
+    cleancache();
+    for(i=0;i<3;i++) {
+	snprintf(url,sizeof(url),"%s&%d",URL,i);
+	CHECK(nchttpcache_put(&cache,url,1000,BODY,BODYLEN) == NC_NOERR);
+	ageentries();
+    }
+    /* Use the oldest, leaving &1 least recently used */
+    CHECK(cachedbody(&cache,URL "&0"));
+    ageentries();
+    CHECK(nchttpcache_put(&cache,URL "&3",1000,BODY,BODYLEN) == NC_NOERR);
+    CHECK(nchttpcache_lookup(&cache,URL "&0",NULL));
+    CHECK(!nchttpcache_lookup(&cache,URL "&1",NULL));
+    CHECK(nchttpcache_lookup(&cache,URL "&2",NULL));
+    CHECK(nchttpcache_lookup(&cache,URL "&3",NULL));
+    /* A response bigger than the whole cache is not kept */
+    {
+	char* big = (char*)calloc(4*BODYLEN,1);
+	CHECK(nchttpcache_put(&cache,URL "&big",1000,big,4*BODYLEN) == NC_NOERR);
+	CHECK(!nchttpcache_lookup(&cache,URL "&big",NULL));
+	CHECK(nchttpcache_lookup(&cache,URL "&3",NULL));
+	free(big);
+    }
+    cleancache();
+    nchttpcache_clear(&cache);
+#endif
+
+    printf("*** %s\n",(fail ? "FAIL" : "PASS"));
+    return fail;
+}
@@ -0,0 +1,122 @@
+/*
+Check that DAP2 reads that lie inside an earlier, cached read of part
+of a variable are taken from the cache with the right values.
+
+Usage: test_partcache <DAP2 url> <variable> [<client parameters>]
+
+A block in the middle of the variable is read with [cache] and
+[noprefetch], then a block offset by one inside it and every other
+value of it.  Then "cached reads done" is written to stderr, and the
+same reads are made, each in a dataset of its own, to compare with.  With
+[log][show=fetch] among the parameters, the fetches logged before
+that line show whether the later reads needed a DataDDS of their own;
+see tst_remotefetch.sh.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "netcdf.h"
+
+#define NREADS 3
+
+#define CHECK(expr) check((expr),#expr,__LINE__)
+
+static void
+check(int stat, const char* expr, int line)
+{
+    if(stat == NC_NOERR) return;
+    fprintf(stderr,"*** FAIL: %s at line %d: %s\n",expr,line,nc_strerror(stat));
+    exit(1);
+}
+
+/* Make the reads of a variable of the given shape: a block from a
+   quarter of the way along each dimension to three quarters of the
+   way, a block offset by one inside it, and every other value of it */
+static void
+reads(int rank, const size_t* shape, size_t start[NREADS][NC_MAX_VAR_DIMS],
+      size_t count[NREADS][NC_MAX_VAR_DIMS], ptrdiff_t stride[NREADS][NC_MAX_VAR_DIMS])
+{
+    int i;
+    for(i=0;i<rank;i++) {
+	start[0][i] = shape[i] / 4;
+	count[0][i] = (shape[i] + 1) / 2;
+	stride[0][i] = 1;
+	start[1][i] = start[0][i] + (count[0][i] > 1 ? 1 : 0);
+	count[1][i] = count[0][i] - (start[1][i] - start[0][i]);
+	stride[1][i] = 1;
+	start[2][i] = start[0][i];
+	count[2][i] = (count[0][i] + 1) / 2;
+	stride[2][i] = 2;
+    }
+}
+
+/* Open url, and make the reads of variable name into values; with
+   reopen set, open url again for each read */
+static void
+readall(const char* url, const char* name, double* values[NREADS], size_t nvalues[NREADS],
+	int reopen)
+{
+    int ncid, varid, rank, i, r;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t shape[NC_MAX_VAR_DIMS];
+    size_t start[NREADS][NC_MAX_VAR_DIMS], count[NREADS][NC_MAX_VAR_DIMS];
+    ptrdiff_t stride[NREADS][NC_MAX_VAR_DIMS];
+
+    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+    CHECK(nc_inq_varid(ncid,name,&varid));
+    CHECK(nc_inq_var(ncid,varid,NULL,NULL,&rank,dimids,NULL));
+    for(i=0;i<rank;i++)
+	CHECK(nc_inq_dimlen(ncid,dimids[i],&shape[i]));
+    reads(rank,shape,start,count,stride);
+    for(r=0;r<NREADS;r++) {
+	if(reopen && r > 0) {
+	    CHECK(nc_close(ncid));
+	    CHECK(nc_open(url,NC_NOWRITE,&ncid));
+	    CHECK(nc_inq_varid(ncid,name,&varid));
+	}
+	nvalues[r] = 1;
+	for(i=0;i<rank;i++)
+	    nvalues[r] *= count[r][i];
+	values[r] = (double*)malloc(nvalues[r]*sizeof(double));
+	CHECK(nc_get_vars_double(ncid,varid,start[r],count[r],stride[r],values[r]));
+    }
+    CHECK(nc_close(ncid));
+}
+
+int
+main(int argc, char** argv)
+{
+    const char* params = (argc > 3 ? argv[3] : "");
+    char* url;
+    double* cached[NREADS];
+    double* expected[NREADS];
+    size_t ncached[NREADS], nexpected[NREADS];
+    int r, failures = 0;
+
+    if(argc < 3 || argc > 4) {
+	fprintf(stderr,"usage: test_partcache <DAP2 url> <variable> [<client parameters>]\n");
+	exit(1);
+    }
+    printf("*** Test: reads of %s inside a cached read of %s\n",argv[2],argv[1]);
+    url = (char*)malloc(strlen(argv[1]) + strlen(params) + 32);
+    sprintf(url,"%s[cache][noprefetch]%s",params,argv[1]);
+    readall(url,argv[2],cached,ncached,0);
+    fprintf(stderr,"cached reads done\n");
+    fflush(stderr);
+
+    readall(argv[1],argv[2],expected,nexpected,1);
+    for(r=0;r<NREADS;r++) {
+	if(ncached[r] != nexpected[r]
+	   || memcmp(cached[r],expected[r],nexpected[r]*sizeof(double)) != 0) {
+	    fprintf(stderr,"*** FAIL: read %d of %s has the wrong values\n",r,argv[2]);
+	    failures++;
+	}
+	free(cached[r]);
+	free(expected[r]);
+    }
+    free(url);
+    if(failures > 0) exit(1);
+    printf("*** PASS\n");
+    return 0;
+}
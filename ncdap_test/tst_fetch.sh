@@ -0,0 +1,62 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+# This shell script checks that DAP2 data read from local file://
+# fixtures is the same whether the DataDDS is kept in memory or in a
+# file ([fetch=disk], which reads the .dods fixture in place), and
+# that fetches over the fetch limit are not split for local files.
+# It also compares strided and type converting reads with those of a
+# netCDF copy of each dataset, made by test_getvars.
+
+set -e
+echo ""
+echo "*** Testing DAP2 data fetched into memory and onto disk"
+
+TESTS="synth1 synth3 test.03 test.07 test.gr1 NestedSeq whoi fnoc1.nc 1998-6-avhrr.dat"
+
+for x in ${TESTS} ; do
+    for fetch in memory disk ; do
+	echo "*** checking ${x} with fetch=${fetch}..."
+	rm -f tst_fetch.dmp
+	${NCDUMP} "[cache][fetch=${fetch}]file://${srcdir}/testdata3/${x}" > tst_fetch.dmp
+	diff -w ${srcdir}/expected3/${x}.dmp tst_fetch.dmp
+    done
+done
+
+# Local files are fetched whole in one response, so small fetch
+# limits must neither split the fetch nor change the data.
+URL="file://${srcdir}/testdata3/fnoc1.nc"
+${NCGEN} -b -o tst_fetch.nc ${srcdir}/expected3/fnoc1.nc.dmp
+for slab in 'u' 'u[3:11,2:15,:],lat[4:9],time' ; do
+    ${NCDUMP} -v "${slab}" tst_fetch.nc | sed -n '/^data:/,$p' > tst_fetch.txt
+    for params in "[fetchlimit=1000][concurrency=4]" \
+		  "[cache][fetchlimit=1000][concurrency=4]" ; do
+	echo "*** checking ${slab} with ${params}..."
+	${NCDUMP} -v "${slab}" "${params}${URL}" | sed -n '/^data:/,$p' > tst_fetch.dmp
+	diff -w tst_fetch.txt tst_fetch.dmp
+	nfetch=`${NCDUMP} -v "${slab}" "[log][show=fetch]${params}${URL}" 2>&1 >/dev/null \
+		| grep -c 'fetch: .*\.dods'`
+	if test "x${nfetch}" != x1 ; then
+	    echo "*** FAIL: ${nfetch} DataDDS fetches instead of 1"
+	    exit 1
+	fi
+    done
+done
+
+# Strided and type converting reads, including reads inside an
+# earlier one, must match those of a netCDF copy of the dataset,
+# however the data is fetched and cached.
+for x in fnoc1.nc test.02 test.gr1 1998-6-avhrr.dat ; do
+    URL="file://${srcdir}/testdata3/${x}"
+    for params in "" "[cache]" "[cache][noprefetch]" "[wholevar]" "[cache][wholevar]" ; do
+	echo "*** checking reads of ${x} with ${params}..."
+	${execdir}/test_getvars "${URL}" "${params}${URL}"
+    done
+done
+rm -f test_getvars.nc
+
+rm -f tst_fetch.dmp tst_fetch.txt tst_fetch.nc
+echo "*** All DAP2 fetch tests passed!"
+exit 0
@@ -0,0 +1,60 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+# This shell script checks DAP2 reads from the test server that
+# depend on the server applying constraints, comparing them with
+# plain reads of the same data.
+
+set -e
+echo ""
+
+# Figure our dts server; if none, then just stop
+DTS=`${execdir}/findtestserver dap2 dts`
+if test "x$DTS" = "x" ; then
+echo "WARNING: Cannot locate test server for dts"
+exit
+fi
+
+echo "*** Testing batched reads"
+${execdir}/test_batch "${DTS}/test.03"
+
+# Over a small fetch limit, a read is fetched as up to 4 concurrent
+# slabs of its first dimension, and the prefetched variables in up to
+# 4 concurrent groups.  The data must not change, and strided and
+# converting reads must match those of a netCDF copy of the dataset.
+URL="${DTS}/test.02"
+SPLIT="[fetchlimit=32][concurrency=4]"
+${NCDUMP} "${URL}" | sed -n '/^data:/,$p' > tst_remotefetch.txt
+for params in "[noprefetch]" "[cache][noprefetch]" "[cache][prefetch]" ; do
+    echo "*** checking ${URL} with ${params}${SPLIT}..."
+    ${NCDUMP} "${params}${SPLIT}${URL}" | sed -n '/^data:/,$p' > tst_remotefetch.dmp
+    diff -w tst_remotefetch.txt tst_remotefetch.dmp
+    ${execdir}/test_getvars "${URL}" "${params}${SPLIT}${URL}"
+done
+# f64 is 200 bytes, so it takes 4 slabs; all of test.02 takes 4 groups
+for params in "[noprefetch]" "[cache][prefetch]" ; do
+    if test "x${params}" = "x[noprefetch]" ; then vars="-v f64" ; else vars="" ; fi
+    nfetch=`${NCDUMP} ${vars} "[log][show=fetch]${params}${SPLIT}${URL}" 2>&1 >/dev/null \
+	    | grep -c 'fetch: .*\.dods'`
+    if test "${nfetch}" -lt 2 ; then
+	echo "*** FAIL: ${params}${SPLIT} made ${nfetch} DataDDS fetches, not several"
+	exit 1
+    fi
+done
+rm -f tst_remotefetch.txt tst_remotefetch.dmp test_getvars.nc
+
+# Reads inside a cached read of part of a variable must be taken from
+# the cache, with no DataDDS fetch of their own
+echo "*** checking reads inside a cached read of ${URL}..."
+${execdir}/test_partcache "${URL}" f64 "[log][show=fetch]" 2> tst_remotefetch.log
+nfetch=`sed '/^cached reads done/q' tst_remotefetch.log | grep -c 'fetch: .*\.dods'`
+if test "x${nfetch}" != x1 ; then
+    echo "*** FAIL: ${nfetch} DataDDS fetches instead of 1"
+    exit 1
+fi
+rm -f tst_remotefetch.log
+
+echo "*** All DAP2 remote fetch tests passed!"
+exit 0
@@ -17,8 +17,22 @@ static struct {
     int *dimids;		/* ids for dimensions in chunkspec string */
     size_t *chunksizes;		/* corresponding chunk sizes */
     bool_t omit;		/* true if chunking to be turned off */
+    int access;			/* NC_ACCESS_* flags, if chunking chosen automatically */
 } chunkspecs;
 
+#define AUTO_PREFIX "auto:"
+
+/* Names of access patterns recognized in "auto:pattern" chunkspecs */
+static struct {
+    const char *name;
+    int access;
+} access_patterns[] = {
+    {"timeseries", NC_ACCESS_TIMESERIES},
+    {"slice", NC_ACCESS_SLICE},
+    {"balanced", NC_ACCESS_TIMESERIES | NC_ACCESS_SLICE},
+    {NULL, 0}
+};
+
 /*
  * Parse chunkspec string and convert into chunkspec_t structure.
  *   ncid: location ID of open netCDF file or group in an open file
@@ -33,6 +47,9 @@ static struct {
  *         not mentioned in the string.
  *         If the chunkspec string is "/", specifying no dimensions or 
  *         chunk sizes, it indicates chunking to be turned off on output.
+ *         If the chunkspec string is "auto:pattern", where pattern is
+ *         one of "timeseries", "slice", or "balanced", chunk sizes
+ *         are chosen by the library to suit that access pattern.
  *
  * Returns NC_NOERR if no error, NC_EINVAL if spec has consecutive
  * unescaped commas or no chunksize specified for dimension.
@@ -49,12 +66,23 @@ chunkspec_parse(int ncid, const char *spec) {
 
     chunkspecs.ndims = 0;
     chunkspecs.omit = false;
+    chunkspecs.access = 0;
     if (!spec || *spec == '\0') /* default chunking */
 	return NC_NOERR; 
     if (spec[0] == '/' && spec[1] == '\0') { /* no chunking */
 	chunkspecs.omit = true;
 	return NC_NOERR;
     }
+    if (strncmp(spec, AUTO_PREFIX, strlen(AUTO_PREFIX)) == 0) { /* chosen by library */
+	int i;
+	for(i = 0; access_patterns[i].name; i++) {
+	    if(strcmp(spec + strlen(AUTO_PREFIX), access_patterns[i].name) == 0) {
+		chunkspecs.access = access_patterns[i].access;
+		return NC_NOERR;
+	    }
+	}
+	return(NC_EINVAL);
+    }
     /* Count unescaped commas, handle consecutive unescaped commas as error */
     for(cp = spec; *cp; cp++) {
 	if(*cp == ',' && *pp != '\\') {
@@ -160,4 +188,11 @@ chunkspec_omit(void) {
     return chunkspecs.omit;
 }
 
+/* Return the NC_ACCESS_* access pattern flags from an "auto:pattern"
+ * chunkspec, or 0 if chunk sizes are not to be chosen automatically. */
+int
+chunkspec_access(void) {
+    return chunkspecs.access;
+}
+
 
@@ -28,4 +28,9 @@ chunkspec_ndims(void);
 extern bool_t
 chunkspec_omit(void);
 
+/* Return the NC_ACCESS_* access pattern flags from an "auto:pattern"
+ * chunkspec, or 0 if chunk sizes are not to be chosen automatically. */
+extern int
+chunkspec_access(void);
+
 #endif	/* _CHUNKSPEC_H_  */
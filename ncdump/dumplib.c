@@ -739,11 +739,176 @@ nccomp_val_equals(const nctype_t *this,
 }
 #endif /* USE_NETCDF4 */
 
+/* Fast paths for formatting the values of primitive types with the
+ * default formats, which otherwise spend most of ncdump's time in
+ * snprintf().  Each returns the length of the string it put in sout,
+ * the same as snprintf(sout, PRIM_LEN, fmt, vv) would, or -1 if fmt
+ * or vv is one it doesn't handle, for the caller to use snprintf(). */
+
+/* Convert magnitude uv to decimal digits, with a leading '-' if neg */
+static int
+ullong_tostring(unsigned long long uv, int neg, char *sout) {
+    char digits[24];
+    int nd = 0, len = 0;
+    do {
+	digits[nd++] = '0' + (char)(uv % 10);
+	uv /= 10;
+    } while(uv != 0);
+    if(neg)
+	sout[len++] = '-';
+    while(nd > 0)
+	sout[len++] = digits[--nd];
+    sout[len] = '\0';
+    return len;
+}
+
+/* For signed integer types, with format "%d" or "%lld" */
+static int
+fast_int_tostring(const char *fmt, long long vv, char *sout) {
+    if(strcmp(fmt, "%d") != 0 && strcmp(fmt, "%lld") != 0)
+	return -1;
+    if(vv < 0)			/* negate as unsigned, so LLONG_MIN works */
+	return ullong_tostring(-(unsigned long long)vv, 1, sout);
+    return ullong_tostring((unsigned long long)vv, 0, sout);
+}
+
+/* For unsigned integer types, with format "%u" or "%llu" */
+static int
+fast_uint_tostring(const char *fmt, unsigned long long vv, char *sout) {
+    if(strcmp(fmt, "%u") != 0 && strcmp(fmt, "%llu") != 0)
+	return -1;
+    return ullong_tostring(vv, 0, sout);
+}
+
+/* Most significant digits handled, so scaled values stay exact in a
+ * double and the rounding check below is meaningful */
+#define FAST_MAX_DIGITS 15
+
+/* For finite float and double values, with format "%.<prec>g".  The
+ * value is scaled by a power of ten so its integer part has prec
+ * digits, then rounded to that integer.  If the rounding errors in
+ * scaling could have decided which way the value rounds, the value is
+ * left to snprintf(), so the result is always the same as snprintf()
+ * would produce. */
+static int
+fast_double_tostring(const char *fmt, double vv, char *sout) {
+    static const double pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const int maxexact = sizeof(pow10) / sizeof(pow10[0]) - 1;
+    char digits[FAST_MAX_DIGITS];
+    int prec, exp, scale, tries, nsig, len, i;
+    double av, scaled, slop, whole, frac;
+    unsigned long long dd;
+    const char *cp;
+
+    /* parse "%.<prec>g" */
+    if(fmt[0] != '%' || fmt[1] != '.' || !isdigit((unsigned char)fmt[2]))
+	return -1;
+    prec = 0;
+    for(cp = fmt + 2; isdigit((unsigned char)*cp); cp++) {
+	prec = 10 * prec + (*cp - '0');
+	if(prec > FAST_MAX_DIGITS)
+	    return -1;
+    }
+    if(cp[0] != 'g' || cp[1] != '\0')
+	return -1;
+    if(prec == 0)
+	prec = 1;
+
+    len = 0;
+    if(signbit(vv))
+	sout[len++] = '-';
+    av = fabs(vv);
+    if(av == 0.0) {
+	sout[len++] = '0';
+	sout[len] = '\0';
+	return len;
+    }
+
+    /* scale av to [10^(prec-1), 10^prec), correcting log10() if needed */
+    exp = (int)floor(log10(av));
+    for(tries = 0; ; tries++) {
+	scale = prec - 1 - exp;
+	if(tries > 2 || scale > 300 || scale < -300)
+	    return -1;
+	if(scale >= -maxexact && scale <= maxexact) {
+	    /* power is exact, so scaled is within half an ulp, at most
+	     * scaled*2^-53, of the exact value */
+	    scaled = scale >= 0 ? av * pow10[scale] : av / pow10[-scale];
+	    slop = scaled * DBL_EPSILON;
+	} else {
+	    /* power is rounded too, allow for a few ulps in pow() */
+	    scaled = av * pow(10.0, scale);
+	    slop = scaled * 8 * DBL_EPSILON;
+	}
+	if(scaled < pow10[prec - 1])
+	    exp--;
+	else if(scaled >= pow10[prec])
+	    exp++;
+	else
+	    break;
+    }
+    whole = floor(scaled);
+    frac = scaled - whole;
+    if(fabs(frac - 0.5) <= slop)	/* too close to halfway to be sure */
+	return -1;
+    dd = (unsigned long long)whole + (frac > 0.5);
+    if(dd == (unsigned long long)pow10[prec]) { /* rounded up to next power */
+	dd /= 10;
+	exp++;
+    }
+    for(i = prec - 1; i >= 0; i--) {
+	digits[i] = '0' + (char)(dd % 10);
+	dd /= 10;
+    }
+    for(nsig = prec; nsig > 1 && digits[nsig - 1] == '0'; nsig--)
+	;			/* %g drops trailing zeros */
+
+    if(exp < -4 || exp >= prec) { /* exponential notation */
+	int aexp = exp < 0 ? -exp : exp;
+	sout[len++] = digits[0];
+	if(nsig > 1) {
+	    sout[len++] = '.';
+	    for(i = 1; i < nsig; i++)
+		sout[len++] = digits[i];
+	}
+	sout[len++] = 'e';
+	sout[len++] = exp < 0 ? '-' : '+';
+	if(aexp >= 100) {
+	    sout[len++] = '0' + (char)(aexp / 100);
+	    aexp %= 100;
+	}
+	sout[len++] = '0' + (char)(aexp / 10);
+	sout[len++] = '0' + (char)(aexp % 10);
+    } else if(exp >= 0) {	/* integer part has exp+1 digits */
+	for(i = 0; i <= exp; i++)
+	    sout[len++] = digits[i];
+	if(nsig > exp + 1) {
+	    sout[len++] = '.';
+	    for(i = exp + 1; i < nsig; i++)
+		sout[len++] = digits[i];
+	}
+    } else {			/* leading zeros after the point */
+	sout[len++] = '0';
+	sout[len++] = '.';
+	for(i = exp + 1; i < 0; i++)
+	    sout[len++] = '0';
+	for(i = 0; i < nsig; i++)
+	    sout[len++] = digits[i];
+    }
+    sout[len] = '\0';
+    return len;
+}
+
 int
 ncbyte_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(signed char *)valp);
+    res = fast_int_tostring(typ->fmt, *(signed char *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(signed char *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -763,7 +928,9 @@ int
 ncshort_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(short *)valp);
+    res = fast_int_tostring(typ->fmt, *(short *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(short *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -773,7 +940,9 @@ int
 ncint_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(int *)valp);
+    res = fast_int_tostring(typ->fmt, *(int *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(int *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -823,7 +992,9 @@ ncfloat_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     float vv = *(float *)valp;
     if(isfinite(vv)) {
 	int res;
-	res = snprintf(sout, PRIM_LEN, typ->fmt, vv);
+	res = fast_double_tostring(typ->fmt, vv, sout);
+	if(res < 0)
+	    res = snprintf(sout, PRIM_LEN, typ->fmt, vv);
 	assert(res < PRIM_LEN);
     } else {
 	float_special_tostring(vv, sout);
@@ -838,7 +1009,9 @@ ncdouble_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     double vv = *(double *)valp;
     if(isfinite(vv)) {
 	int res;
-	res = snprintf(sout, PRIM_LEN, typ->fmt, vv);
+	res = fast_double_tostring(typ->fmt, vv, sout);
+	if(res < 0)
+	    res = snprintf(sout, PRIM_LEN, typ->fmt, vv);
 	assert(res < PRIM_LEN);
     } else {
 	double_special_tostring(vv, sout);
@@ -851,7 +1024,9 @@ int
 ncubyte_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned char *)valp);
+    res = fast_uint_tostring(typ->fmt, *(unsigned char *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned char *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -861,7 +1036,9 @@ int
 ncushort_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned short *)valp);
+    res = fast_uint_tostring(typ->fmt, *(unsigned short *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned short *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -871,7 +1048,9 @@ int
 ncuint_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned int *)valp);
+    res = fast_uint_tostring(typ->fmt, *(unsigned int *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned int *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -881,7 +1060,9 @@ int
 ncint64_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(long long *)valp);
+    res = fast_int_tostring(typ->fmt, *(long long *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(long long *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -891,7 +1072,9 @@ int
 ncuint64_typ_tostring(const nctype_t *typ, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned long long *)valp);
+    res = fast_uint_tostring(typ->fmt, *(unsigned long long *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, typ->fmt, *(unsigned long long *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1199,7 +1382,9 @@ int
 ncbyte_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(signed char *)valp);
+    res = fast_int_tostring(varp->fmt, *(signed char *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(signed char *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1219,7 +1404,9 @@ int
 ncshort_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(short *)valp);
+    res = fast_int_tostring(varp->fmt, *(short *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(short *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1229,7 +1416,9 @@ int
 ncint_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(int *)valp);
+    res = fast_int_tostring(varp->fmt, *(int *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(int *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1241,7 +1430,9 @@ ncfloat_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     float vv = *(float *)valp;
     if(isfinite(vv)) {
 	int res;
-	res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
+	res = fast_double_tostring(varp->fmt, vv, sout);
+	if(res < 0)
+	    res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
 	assert(res < PRIM_LEN);
     } else {
 	float_special_tostring(vv, sout);
@@ -1256,7 +1447,9 @@ ncdouble_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     double vv = *(double *)valp;
     if(isfinite(vv)) {
 	int res;
-	res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
+	res = fast_double_tostring(varp->fmt, vv, sout);
+	if(res < 0)
+	    res = snprintf(sout, PRIM_LEN, varp->fmt, vv);
 	assert(res < PRIM_LEN);
     } else {
 	double_special_tostring(vv, sout);
@@ -1331,7 +1524,9 @@ int
 ncubyte_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned char *)valp);
+    res = fast_uint_tostring(varp->fmt, *(unsigned char *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned char *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1341,7 +1536,9 @@ int
 ncushort_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned short *)valp);
+    res = fast_uint_tostring(varp->fmt, *(unsigned short *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned short *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1351,7 +1548,9 @@ int
 ncuint_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned int *)valp);
+    res = fast_uint_tostring(varp->fmt, *(unsigned int *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned int *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1361,7 +1560,9 @@ int
 ncint64_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(long long *)valp);
+    res = fast_int_tostring(varp->fmt, *(long long *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(long long *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -1371,7 +1572,9 @@ int
 ncuint64_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     char sout[PRIM_LEN];
     int res;
-    res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned long long *)valp);
+    res = fast_uint_tostring(varp->fmt, *(unsigned long long *)valp, sout);
+    if(res < 0)
+	res = snprintf(sout, PRIM_LEN, varp->fmt, *(unsigned long long *)valp);
     assert(res < PRIM_LEN);
     sbuf_cpy(sfbf, sout);
     return sbuf_len(sfbf);
@@ -0,0 +1,387 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Export variable data as raw binary, NumPy .npy arrays, or CSV, for
+ * ncdump -E.  Values are read in blocks of whole rows, aligned with
+ * chunks where possible, and written with one write per block, rather
+ * than formatted one at a time as CDL. */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+#include "utils.h"
+#include "export.h"
+#include "slabspec.h"
+
+/* Read and write at most this many bytes of values at a time */
+#define EXPORTBUFSIZ (8*1024*1024)
+
+/* Write CSV text when this many bytes of it are waiting */
+#define CSVBUFSIZ (1024*1024)
+
+/* Longest CSV text for one value or index */
+#define CSV_VAL_LEN 64
+
+export_format_t
+export_format(const char *name) {
+    if(strcmp(name, "raw") == 0)
+	return EXPORT_RAW;
+    if(strcmp(name, "npy") == 0)
+	return EXPORT_NPY;
+    if(strcmp(name, "csv") == 0)
+	return EXPORT_CSV;
+    return EXPORT_NONE;
+}
+
+static void
+write_out(const void *buf, size_t len) {
+    if(len > 0 && fwrite(buf, 1, len, stdout) != len)
+	error("can't write exported data");
+}
+
+static int
+little_endian(void) {
+    const unsigned int one = 1;
+    return *(const unsigned char *)&one == 1;
+}
+
+/* Reverse the bytes of each of nvals values of size bytes, in place */
+static void
+swap_bytes(char *buf, size_t nvals, size_t size) {
+    size_t i, j;
+    for(i = 0; i < nvals; i++, buf += size) {
+	for(j = 0; j < size / 2; j++) {
+	    char c = buf[j];
+	    buf[j] = buf[size - 1 - j];
+	    buf[size - 1 - j] = c;
+	}
+    }
+}
+
+/* NumPy dtype for values of a netCDF atomic type, little-endian */
+static const char *
+npy_descr(nc_type type) {
+    switch(type) {
+    case NC_BYTE: return "|i1";
+    case NC_CHAR: return "|S1";
+    case NC_SHORT: return "<i2";
+    case NC_INT: return "<i4";
+    case NC_FLOAT: return "<f4";
+    case NC_DOUBLE: return "<f8";
+    case NC_UBYTE: return "|u1";
+    case NC_USHORT: return "<u2";
+    case NC_UINT: return "<u4";
+    case NC_INT64: return "<i8";
+    case NC_UINT64: return "<u8";
+    default:
+	error("no NumPy type for netCDF type %d", type);
+    }
+    return NULL;
+}
+
+/* Write a version 1.0 .npy header for a C-ordered array of values of
+ * type with shape dims */
+static void
+write_npy_header(nc_type type, int rank, const size_t *dims) {
+    const char magic[] = "\223NUMPY\001\000";
+    const size_t prefix = sizeof(magic) - 1 + 2; /* magic, version, length */
+    char *hdr = (char *) emalloc(128 + 24 * (rank + 1));
+    size_t len, padded;
+    int d;
+
+    len = sprintf(hdr, "{'descr': '%s', 'fortran_order': False, 'shape': (",
+		  npy_descr(type));
+    for(d = 0; d < rank; d++)
+	len += sprintf(hdr + len, d == 0 ? "%lu" : ", %lu", (unsigned long)dims[d]);
+    len += sprintf(hdr + len, "%s), }", rank == 1 ? "," : "");
+    /* pad with spaces and a newline so the data is 64-byte aligned */
+    padded = (prefix + len + 1 + 63) / 64 * 64 - prefix;
+    memset(hdr + len, ' ', padded - len - 1);
+    hdr[padded - 1] = '\n';
+    write_out(magic, sizeof(magic) - 1);
+    putchar((int)(padded & 0xff));
+    putchar((int)(padded >> 8));
+    write_out(hdr, padded);
+    free(hdr);
+}
+
+/* CSV text waiting to be written */
+typedef struct {
+    char *buf;
+    size_t len;
+} csvbuf_t;
+
+static void
+csv_flush(csvbuf_t *cbp) {
+    write_out(cbp->buf, cbp->len);
+    cbp->len = 0;
+}
+
+/* Append a field to the CSV text, quoted if it has to be */
+static void
+csv_field(csvbuf_t *cbp, const char *field, int first) {
+    const char *cp;
+    if(cbp->len + 2 * strlen(field) + 4 > CSVBUFSIZ)
+	csv_flush(cbp);
+    if(!first)
+	cbp->buf[cbp->len++] = ',';
+    if(strpbrk(field, ",\"\r\n") == NULL && !(field[0] == ' ' || field[0] == '\0')) {
+	size_t len = strlen(field);
+	memcpy(cbp->buf + cbp->len, field, len);
+	cbp->len += len;
+	return;
+    }
+    cbp->buf[cbp->len++] = '"';
+    for(cp = field; *cp; cp++) {
+	if(*cp == '"')
+	    cbp->buf[cbp->len++] = '"';
+	cbp->buf[cbp->len++] = *cp;
+    }
+    cbp->buf[cbp->len++] = '"';
+}
+
+/* Format one value of an atomic type as CSV text, precise enough for
+ * floating-point values to be read back exactly */
+static void
+csv_value(nc_type type, const void *valp, char *sout) {
+    switch(type) {
+    case NC_BYTE:
+	snprintf(sout, CSV_VAL_LEN, "%d", *(const signed char *)valp);
+	break;
+    case NC_CHAR:
+	sout[0] = *(const char *)valp;
+	sout[1] = '\0';
+	break;
+    case NC_SHORT:
+	snprintf(sout, CSV_VAL_LEN, "%d", *(const short *)valp);
+	break;
+    case NC_INT:
+	snprintf(sout, CSV_VAL_LEN, "%d", *(const int *)valp);
+	break;
+    case NC_FLOAT:
+	snprintf(sout, CSV_VAL_LEN, "%.9g", *(const float *)valp);
+	break;
+    case NC_DOUBLE:
+	snprintf(sout, CSV_VAL_LEN, "%.17g", *(const double *)valp);
+	break;
+    case NC_UBYTE:
+	snprintf(sout, CSV_VAL_LEN, "%u", *(const unsigned char *)valp);
+	break;
+    case NC_USHORT:
+	snprintf(sout, CSV_VAL_LEN, "%u", *(const unsigned short *)valp);
+	break;
+    case NC_UINT:
+	snprintf(sout, CSV_VAL_LEN, "%u", *(const unsigned int *)valp);
+	break;
+    case NC_INT64:
+	snprintf(sout, CSV_VAL_LEN, "%lld", *(const long long *)valp);
+	break;
+    case NC_UINT64:
+	snprintf(sout, CSV_VAL_LEN, "%llu", *(const unsigned long long *)valp);
+	break;
+    default:
+	error("can't export values of netCDF type %d as CSV", type);
+    }
+}
+
+/* Shape of blocks for reading a variable of shape dims: whole rows in
+ * the order they are written, in at most EXPORTBUFSIZ bytes, and a
+ * multiple of the chunk length along the dimension where blocks are
+ * split, when that fits */
+static void
+export_blocks(int rank, const size_t *dims, const size_t *chunks,
+	      size_t value_size, size_t *blocks) {
+    size_t inner = value_size;
+    int d;
+    for(d = rank - 1; d >= 0; d--) {
+	size_t len;
+	if(inner * dims[d] <= EXPORTBUFSIZ) {
+	    blocks[d] = dims[d];
+	    inner *= dims[d];
+	    continue;
+	}
+	len = EXPORTBUFSIZ / inner;
+	if(chunks[d] > 1 && len >= chunks[d])
+	    len = len / chunks[d] * chunks[d];
+	blocks[d] = len > 0 ? len : 1;
+	for(d--; d >= 0; d--)
+	    blocks[d] = 1;
+    }
+}
+
+/* Write the data of variable varid in group ncid in format fmt, or
+ * just of the hyperslab slab, if not NULL */
+static void
+export_var(int ncid, int varid, export_format_t fmt, const char *slab) {
+    char name[NC_MAX_NAME + 1];
+    nc_type type;
+    int rank;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t dims[NC_MAX_VAR_DIMS], chunks[NC_MAX_VAR_DIMS], blocks[NC_MAX_VAR_DIMS];
+    size_t start[NC_MAX_VAR_DIMS], count[NC_MAX_VAR_DIMS], idx[NC_MAX_VAR_DIMS];
+    size_t first[NC_MAX_VAR_DIMS], fstart[NC_MAX_VAR_DIMS];
+    ptrdiff_t stride[NC_MAX_VAR_DIMS];
+    int strided = 0;
+    size_t value_size, nvals = 1, nblock;
+    int storage = NC_CONTIGUOUS;
+    int swap = !little_endian();
+    csvbuf_t csv;
+    char *buf;
+    int d;
+
+    NC_CHECK(nc_inq_var(ncid, varid, name, &type, &rank, dimids, NULL));
+    if(type > NC_MAX_ATOMIC_TYPE || type == NC_STRING)
+	error("can't export variable %s, which is not of a fixed-size primitive type",
+	      name);
+    NC_CHECK(nc_inq_type(ncid, type, NULL, &value_size));
+    for(d = 0; d < rank; d++)
+	NC_CHECK(nc_inq_dimlen(ncid, dimids[d], &dims[d]));
+    /* from here on, dims is the shape of the values exported, which
+     * start at first with strides stride */
+    if(slab) {
+	int ret = slabspec_parse(slab, rank, dims, first, dims, stride);
+	if(ret != NC_NOERR)
+	    error("%s[%s]: %s", name, slab, nc_strerror(ret));
+    } else {
+	for(d = 0; d < rank; d++) {
+	    first[d] = 0;
+	    stride[d] = 1;
+	}
+    }
+    for(d = 0; d < rank; d++) {
+	nvals *= dims[d];
+	start[d] = 0;
+	idx[d] = 0;
+	chunks[d] = 1;
+	if(stride[d] > 1 && dims[d] > 1)
+	    strided = 1;
+    }
+    if(rank > 0) {
+	NC_CHECK(nc_inq_var_chunking(ncid, varid, &storage, chunks));
+	for(d = 0; d < rank; d++) {
+	    if(storage != NC_CHUNKED)
+		chunks[d] = 1;
+	    else		/* chunk length in values exported */
+		chunks[d] = (chunks[d] + (size_t)stride[d] - 1) / (size_t)stride[d];
+	}
+    }
+    export_blocks(rank, dims, chunks, value_size, blocks);
+    nblock = 1;
+    for(d = 0; d < rank; d++)
+	nblock *= blocks[d];
+    buf = (char *) emalloc(nblock * value_size + 1);
+
+    csv.buf = NULL;
+    csv.len = 0;
+    switch(fmt) {
+    case EXPORT_NPY:
+	write_npy_header(type, rank, dims);
+	break;
+    case EXPORT_CSV:
+	csv.buf = (char *) emalloc(CSVBUFSIZ);
+	for(d = 0; d < rank; d++) {
+	    char dimname[NC_MAX_NAME + 1];
+	    NC_CHECK(nc_inq_dimname(ncid, dimids[d], dimname));
+	    csv_field(&csv, dimname, d == 0);
+	}
+	csv_field(&csv, name, rank == 0);
+	csv.buf[csv.len++] = '\n';
+	break;
+    default:
+	break;
+    }
+
+    while(nvals > 0) {
+	size_t n = 1;
+	size_t i;
+	for(d = 0; d < rank; d++) {
+	    count[d] = dims[d] - start[d] < blocks[d] ? dims[d] - start[d] : blocks[d];
+	    n *= count[d];
+	}
+	for(d = 0; d < rank; d++)
+	    fstart[d] = first[d] + start[d] * (size_t)stride[d];
+	if(strided) {
+	    NC_CHECK(nc_get_vars(ncid, varid, fstart, count, stride, buf));
+	} else {
+	    NC_CHECK(nc_get_vara(ncid, varid, fstart, count, buf));
+	}
+	if(fmt == EXPORT_CSV) {
+	    char sout[CSV_VAL_LEN];
+	    for(i = 0; i < n; i++) {
+		for(d = 0; d < rank; d++) {
+		    snprintf(sout, CSV_VAL_LEN, "%lu",
+			     (unsigned long)(first[d] + idx[d] * (size_t)stride[d]));
+		    csv_field(&csv, sout, d == 0);
+		}
+		csv_value(type, buf + i * value_size, sout);
+		csv_field(&csv, sout, rank == 0);
+		csv.buf[csv.len++] = '\n';
+		/* next index, odometer style */
+		for(d = rank - 1; d >= 0; d--) {
+		    if(++idx[d] < dims[d] || d == 0)
+			break;
+		    idx[d] = 0;
+		}
+	    }
+	} else {
+	    if(swap && value_size > 1)
+		swap_bytes(buf, n, value_size);
+	    write_out(buf, n * value_size);
+	}
+	nvals -= n;
+	/* next block, odometer style */
+	for(d = rank - 1; d >= 0; d--) {
+	    start[d] += blocks[d];
+	    if(start[d] < dims[d] || d == 0)
+		break;
+	    start[d] = 0;
+	}
+    }
+    if(fmt == EXPORT_CSV) {
+	csv_flush(&csv);
+	free(csv.buf);
+    }
+    free(buf);
+}
+
+/* Export the variable named varname in group ncid, if it has one, and
+ * in its subgroups, or just the hyperslab slab of them if not NULL */
+static void
+export_group_vars(int ncid, export_format_t fmt, const char *varname,
+		  const char *slab, int *nexportedp) {
+    int varid;
+#ifdef USE_NETCDF4
+    int numgrps;
+    int *ncids;
+    int g;
+#endif
+    if(nc_inq_gvarid(ncid, varname, &varid) == NC_NOERR) {
+	if(fmt == EXPORT_CSV && *nexportedp > 0)
+	    putchar('\n');	/* blank line between tables */
+	export_var(ncid, varid, fmt, slab);
+	(*nexportedp)++;
+    }
+#ifdef USE_NETCDF4
+    NC_CHECK(nc_inq_grps(ncid, &numgrps, NULL));
+    ncids = (int *) emalloc((numgrps + 1) * sizeof(int));
+    NC_CHECK(nc_inq_grps(ncid, NULL, ncids));
+    for(g = 0; g < numgrps; g++)
+	export_group_vars(ncids[g], fmt, varname, slab, nexportedp);
+    free(ncids);
+#endif
+}
+
+void
+export_vars(int ncid, export_format_t fmt, int nlvars, char **lvars,
+	    char **lslabs) {
+    int nexported = 0;
+    int iv;
+    for(iv = 0; iv < nlvars; iv++)
+	export_group_vars(ncid, fmt, lvars[iv], lslabs ? lslabs[iv] : NULL,
+			  &nexported);
+    fflush(stdout);
+}
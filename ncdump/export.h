@@ -0,0 +1,30 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+#ifndef _EXPORT_H_
+#define _EXPORT_H_
+
+/* Formats for exporting variable data with ncdump -E, instead of
+ * printing it as CDL */
+typedef enum {
+    EXPORT_NONE = 0,
+    EXPORT_RAW,			/* values as little-endian binary */
+    EXPORT_NPY,			/* NumPy .npy array for each variable */
+    EXPORT_CSV			/* CSV, with a column for each dimension index */
+} export_format_t;
+
+/* Format named by name ("raw", "npy" or "csv"), or EXPORT_NONE if
+ * name isn't one of them */
+extern export_format_t
+export_format(const char *name);
+
+/* Write the data of each variable named in lvars to standard output
+ * in format fmt, for all matching variables in the group ncid and its
+ * subgroups.  If lslabs is not NULL, it has a hyperslab spec for each
+ * variable, or NULL to export all of it. */
+extern void
+export_vars(int ncid, export_format_t fmt, int nlvars, char **lvars,
+	    char **lslabs);
+
+#endif	/* _EXPORT_H_  */
@@ -80,6 +80,9 @@ typedef struct ncvar_t {	/* variable */
     const char *fmt;            /* overriding variable-specific format for
 				   printing values or base values, if any */
     int locid;			/* group id */
+    size_t *slab_start;		/* corner of hyperslab specified with -v,
+				   or NULL to dump all values */
+    ptrdiff_t *slab_stride;	/* strides of hyperslab specified with -v */
     /* member functions */
     val_tostring_func val_tostring; /* function to convert value to string for 
 				       output */
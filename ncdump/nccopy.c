@@ -6,7 +6,9 @@
  *   $Id: nccopy.c 400 2010-08-27 21:02:52Z russ $
  *********************************************************************/
 
+#define _GNU_SOURCE		/* for copy_file_range() */
 #include "config.h"		/* for USE_NETCDF4 macro */
+#include <stdio.h>
 #include <stdlib.h>
 #ifdef HAVE_GETOPT_H
 #include <getopt.h>
@@ -14,13 +16,25 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
 #include <string.h>
+#include <errno.h>
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 #include <netcdf.h>
 #include "nciter.h"
 #include "utils.h"
 #include "chunkspec.h"
 #include "dimmap.h"
 #include "nccomps.h"
+#include "rechunk.h"
+
+#if defined(HAVE_UNISTD_H) && defined(HAVE_FCNTL_H)
+#define USE_RAW_COPY		/* can copy classic data sections as bytes */
+#endif
 
 #ifdef _MSC_VER
 #include "XGetopt.h"
@@ -48,6 +62,7 @@ static int option_shuffle_vars = NC_NOSHUFFLE; /* default, no shuffling on compr
 static int option_fix_unlimdims = 0; /* default, preserve unlimited dimensions */
 static char* option_chunkspec = 0;   /* default, no chunk specification */
 static size_t option_copy_buffer_size = COPY_BUFFER_SIZE;
+static int option_copy_buffer_set = 0; /* default, -m not given, may copy classic data as bytes */
 static size_t option_chunk_cache_size = CHUNK_CACHE_SIZE; /* default from config.h */
 static size_t option_chunk_cache_nelems = CHUNK_CACHE_NELEMS; /* default from config.h */
 static int option_read_diskless = 0; /* default, don't read input into memory on open */
@@ -67,6 +82,10 @@ static char** option_lvars = 0;         /* list of variable names specified with
 static bool_t option_varstruct = false;   /* if -v set, copy structure for non-selected vars */
 static int option_compute_chunkcaches = 0; /* default, don't try still flaky estimate of
 					    * chunk cache for each variable */
+static int option_nbuffers = 1;	/* default, copy without a reader thread, using one buffer */
+static size_t option_rechunk_budget = 0; /* default, no rechunking plan, rely on chunk cache */
+static int option_skip_fill = 0; /* default, write all values, output variables in no-fill mode */
+static char *scratch_path = 0;	/* scratch file for two-pass rechunking, if needed */
 
 /* get group id in output corresponding to group igrp in input,
  * given parent group id (or root group id) parid in output. */
@@ -522,9 +541,13 @@ copy_var_specials(int igrp, int varid, int ogrp, int o_varid)
 	    /* If product of chunksizes is too small and no unlimited
 	     * dimensions used, don't chunk.  Also if chunking
 	     * explicitly turned off with chunk spec, don't chunk. */
-	    if ((csprod < option_min_chunk_bytes && !is_unlimited) || contig == 1
+	    if ((csprod < option_min_chunk_bytes && !is_unlimited)
+		|| (contig == 1 && chunkspec_access() == 0)
 		|| chunkspec_omit() == true) {
 		NC_CHECK(nc_def_var_chunking(ogrp, o_varid, NC_CONTIGUOUS, NULL));
+	    } else if (chunkspec_access() != 0) {
+		/* Let the library choose chunk sizes for access pattern */
+		NC_CHECK(nc_def_var_access(ogrp, o_varid, chunkspec_access(), 0, NULL));
 	    } else {
 		NC_CHECK(nc_def_var_chunking(ogrp, o_varid, NC_CHUNKED, chunkp));
 	    }
@@ -578,7 +601,7 @@ set_var_chunked(int ogrp, int o_varid)
     int odim;
     size_t chunk_threshold = CHUNK_THRESHOLD;
 
-    if(chunkspec_ndims() == 0) 	/* no chunking specified on command line */
+    if(chunkspec_ndims() == 0 && chunkspec_access() == 0) /* no chunking specified on command line */
 	return stat;
     NC_CHECK(nc_inq_varndims(ogrp, o_varid, &ndims));
 
@@ -609,7 +632,8 @@ set_var_chunked(int ogrp, int o_varid)
 		size_t chunksize = chunkspec_size(idimid); /* from chunkspec */
 		size_t dimlen;
 		NC_CHECK(nc_inq_dimlen(ogrp, odimid, &dimlen));
-		if( (chunksize > 0) || dimmap_ounlim(odimid)) {
+		if( (chunksize > 0) || dimmap_ounlim(odimid)
+		    || chunkspec_access() != 0) {
 		    chunked = 1;		    
 		}
 		if(dimlen > 0) { /* dimlen for unlimited dims is still 0 before copying data */
@@ -622,7 +646,10 @@ set_var_chunked(int ogrp, int o_varid)
 	if(varsize < chunk_threshold && !is_unlimited)
 	    chunked = 0;
 
-	if(chunked) {
+	if(chunked && chunkspec_access() != 0) {
+	    /* Let the library choose chunk sizes for access pattern */
+	    NC_CHECK(nc_def_var_access(ogrp, o_varid, chunkspec_access(), 0, NULL));
+	} else if(chunked) {
 	    /* Allocate chunksizes and set defaults to dimsize for any
 	     * dimensions not mentioned in chunkspec, except use 1 for unlimited dims. */
 	    size_t *chunkp = (size_t *) emalloc(ndims * sizeof(size_t));
@@ -660,6 +687,34 @@ set_var_compressed(int ogrp, int o_varid)
     return stat;
 }
 
+/* If skipping fill values was specified on the command line, use
+ * fill values for a chunked output variable of an atomic type, so
+ * that slabs of only fill values need not be copied: the chunks they
+ * would have been written to are then never allocated, and read back
+ * as fill values. */
+static int
+set_var_fill_skippable(int ogrp, int o_varid)
+{
+    int stat = NC_NOERR;
+    nc_type vartype;
+    int ndims;
+    int contig = 1;
+
+    if(!option_skip_fill)
+	return stat;
+    NC_CHECK(nc_inq_vartype(ogrp, o_varid, &vartype));
+    if(vartype > NC_MAX_ATOMIC_TYPE || vartype == NC_STRING)
+	return stat;
+    NC_CHECK(nc_inq_varndims(ogrp, o_varid, &ndims));
+    if(ndims > 0) {
+	NC_CHECK(nc_inq_var_chunking(ogrp, o_varid, &contig, NULL));
+    }
+    if(contig == 0) {
+	NC_CHECK(nc_def_var_fill(ogrp, o_varid, NC_FILL, NULL));
+    }
+    return stat;
+}
+
 /* Release the variable chunk cache allocated for variable varid in
  * group grp.  This is not necessary, but will save some memory when
  * processing one variable at a time.  */
@@ -849,6 +904,7 @@ copy_var(int igrp, int varid, int ogrp)
 		/* Set compression if specified in command line option */
 		NC_CHECK(set_var_compressed(ogrp, o_varid));
 	    }
+	    NC_CHECK(set_var_fill_skippable(ogrp, o_varid));
 	}
     }
 #endif	/* USE_NETCDF4 */
@@ -950,6 +1006,563 @@ inq_nvals(int igrp, int varid, long long *nvalsp) {
     return stat;
 }
 
+/* Free values of strings and vlens read into buf by nc_get_vara() */
+static int
+free_var_values(int igrp, nc_type vartype, size_t nvalues, void *buf) {
+    int stat = NC_NOERR;
+#ifdef USE_NETCDF4
+    /* we have to explicitly free values for strings and vlens */
+    if(vartype == NC_STRING) {
+	NC_CHECK(nc_free_string(nvalues, (char **)buf));
+    } else if(vartype > NC_STRING) { /* user-defined type */
+	nc_type vclass;
+	NC_CHECK(nc_inq_user_type(igrp, vartype, NULL, NULL, NULL, NULL, &vclass));
+	if(vclass == NC_VLEN) {
+	    NC_CHECK(nc_free_vlens(nvalues, (nc_vlen_t *)buf));
+	}
+    }
+#endif	/* USE_NETCDF4 */
+    return stat;
+}
+
+/* State for not writing slabs of an output variable that hold only
+ * fill values.  Chunks that are never written aren't allocated, and
+ * read back as fill values, so sparse variables copy faster and take
+ * less space. */
+typedef struct skip_fill {
+    void *fillp;		/* output fill value, NULL if not skipping */
+    size_t value_size;		/* size of a value, and of fill value */
+    int rank;
+    size_t *dims;		/* dimension lengths of the variable */
+    size_t *chunks;		/* chunk lengths of the output variable */
+    int *unlim;			/* which output dimensions are unlimited */
+    int unwritten;		/* true if input chunks never written may be skipped unread */
+    int corner_written;		/* true once the last value of the variable is written */
+} skip_fill_t;
+
+/* Return true if all nvalues values in buf, each of value_size bytes,
+ * are the same as the value at fillp.  Comparing the buffer with
+ * itself shifted by one value lets memcmp() do the work, which is
+ * vectorized in most C libraries. */
+static int
+all_fill(const void *buf, size_t nvalues, size_t value_size, const void *fillp) {
+    const char *p = (const char *)buf;
+    if(nvalues == 0)
+	return 1;
+    if(memcmp(p, fillp, value_size) != 0)
+	return 0;
+    return memcmp(p, p + value_size, (nvalues - 1) * value_size) == 0;
+}
+
+/* Set up skipping of slabs that hold only fill values, when copying
+ * variable varid in group igrp to ovarid in ogrp.  Slabs are only
+ * skipped with the -S option, for netCDF-4 output variables of atomic
+ * types that are chunked and use fill values; otherwise skipp->fillp
+ * is NULL. */
+static int
+init_skip_fill(int igrp, int varid, int ogrp, int ovarid, skip_fill_t *skipp) {
+    int stat = NC_NOERR;
+    memset((void*)skipp, 0, sizeof(skip_fill_t));
+    if(!option_skip_fill)
+	return stat;
+#ifdef USE_NETCDF4
+    {
+	int okind, ikind;
+	nc_type vartype;
+	int ndims;
+	int ocontig = 1, icontig = 1;
+	int no_fill = 1;
+	int *dimids;
+	int dim;
+
+	NC_CHECK(nc_inq_format(ogrp, &okind));
+	if(okind != NC_FORMAT_NETCDF4 && okind != NC_FORMAT_NETCDF4_CLASSIC)
+	    return stat;
+	NC_CHECK(nc_inq_vartype(ogrp, ovarid, &vartype));
+	if(vartype > NC_MAX_ATOMIC_TYPE || vartype == NC_STRING)
+	    return stat;
+	NC_CHECK(nc_inq_varndims(ogrp, ovarid, &ndims));
+	if(ndims == 0)
+	    return stat;
+	NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, NULL));
+	if(ocontig != 0)
+	    return stat;
+	NC_CHECK(nc_inq_type(ogrp, vartype, NULL, &skipp->value_size));
+	skipp->fillp = emalloc(skipp->value_size);
+	NC_CHECK(nc_inq_var_fill(ogrp, ovarid, &no_fill, skipp->fillp));
+	if(no_fill) {
+	    free(skipp->fillp);
+	    skipp->fillp = NULL;
+	    return stat;
+	}
+
+	skipp->rank = ndims;
+	skipp->chunks = (size_t *) emalloc(ndims * sizeof(size_t));
+	NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, skipp->chunks));
+	skipp->dims = (size_t *) emalloc(ndims * sizeof(size_t));
+	skipp->unlim = (int *) emalloc(ndims * sizeof(int));
+	dimids = (int *) emalloc(ndims * sizeof(int));
+	NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+	for(dim = 0; dim < ndims; dim++) {
+	    NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &skipp->dims[dim]));
+	}
+	NC_CHECK(nc_inq_vardimid(ogrp, ovarid, dimids));
+	for(dim = 0; dim < ndims; dim++) {
+	    skipp->unlim[dim] = dimmap_ounlim(dimids[dim]);
+	}
+	free(dimids);
+
+	/* Input chunks that were never written hold the input fill
+	 * value, so can be skipped without reading them if that's the
+	 * same as the output fill value. */
+	NC_CHECK(nc_inq_format(igrp, &ikind));
+	if(ikind == NC_FORMAT_NETCDF4 || ikind == NC_FORMAT_NETCDF4_CLASSIC) {
+	    NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, NULL));
+	    if(icontig == 0) {
+		void *ifillp = emalloc(skipp->value_size);
+		NC_CHECK(nc_inq_var_fill(igrp, varid, &no_fill, ifillp));
+		skipp->unwritten = !no_fill &&
+		    memcmp(ifillp, skipp->fillp, skipp->value_size) == 0;
+		free(ifillp);
+	    }
+	}
+    }
+#endif	/* USE_NETCDF4 */
+    return stat;
+}
+
+/* Check whether the values in a box within a slab are all fill
+ * values or, if out is not NULL, copy them to out instead.  The slab
+ * has shape count, with its values in buf, and the box has shape
+ * bcount, starting at bstart within the slab. */
+static int
+slab_box(const skip_fill_t *skipp, const size_t *count, const char *buf,
+	 const size_t *bstart, const size_t *bcount, char *out) {
+    int rank = skipp->rank;
+    size_t value_size = skipp->value_size;
+    size_t *idx = (size_t *) emalloc(rank * sizeof(size_t));
+    int allfill = 1;
+    int dim;
+
+    memset((void*)idx, 0, rank * sizeof(size_t));
+    for(;;) {			/* for each row of the box */
+	size_t offset = 0;
+	for(dim = 0; dim < rank; dim++)
+	    offset = offset * count[dim] + bstart[dim] + (dim < rank - 1 ? idx[dim] : 0);
+	if(out) {
+	    memcpy(out, buf + offset * value_size, bcount[rank - 1] * value_size);
+	    out += bcount[rank - 1] * value_size;
+	} else if(!all_fill(buf + offset * value_size, bcount[rank - 1], value_size,
+			    skipp->fillp)) {
+	    allfill = 0;
+	    break;
+	}
+	for(dim = rank - 2; dim >= 0; dim--) {
+	    if(++idx[dim] < bcount[dim])
+		break;
+	    idx[dim] = 0;
+	}
+	if(dim < 0)
+	    break;
+    }
+    free(idx);
+    return allfill;
+}
+
+/* Write values to a box of variable ovarid in ogrp, noting whether
+ * that includes the last value of the variable. */
+static int
+put_box(skip_fill_t *skipp, int ogrp, int ovarid, const size_t *start,
+	const size_t *count, const void *buf) {
+    int stat = NC_NOERR;
+    int dim;
+    NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, buf));
+    for(dim = 0; dim < skipp->rank; dim++) {
+	if(start[dim] + count[dim] != skipp->dims[dim])
+	    break;
+    }
+    if(dim == skipp->rank)
+	skipp->corner_written = 1;
+    return stat;
+}
+
+/* Write a slab of nvalues values in buf to variable ovarid in ogrp,
+ * skipping the parts of it that are all fill values.  If the slab
+ * covers several output chunks, those of its pieces that lie in one
+ * output chunk and hold only fill values are skipped, and the rest
+ * written a chunk at a time. */
+static int
+put_vara_skip_fill(skip_fill_t *skipp, int ogrp, int ovarid, const size_t *start,
+		   const size_t *count, size_t nvalues, const void *buf) {
+    int stat = NC_NOERR;
+    int rank = skipp->rank;
+    size_t *first, *last, *cell, *bstart, *bcount, *ostart;
+    size_t ncells = 1, icell, nfill = 0, boxsize;
+    char *isfill, *boxbuf;
+    int pass, dim;
+
+    if(skipp->fillp == NULL)
+	return nc_put_vara(ogrp, ovarid, start, count, buf);
+    if(all_fill(buf, nvalues, skipp->value_size, skipp->fillp))
+	return stat;
+
+    first = (size_t *) emalloc(rank * sizeof(size_t));
+    last = (size_t *) emalloc(rank * sizeof(size_t));
+    cell = (size_t *) emalloc(rank * sizeof(size_t));
+    bstart = (size_t *) emalloc(rank * sizeof(size_t));
+    bcount = (size_t *) emalloc(rank * sizeof(size_t));
+    ostart = (size_t *) emalloc(rank * sizeof(size_t));
+    boxsize = skipp->value_size;
+    for(dim = 0; dim < rank; dim++) {
+	first[dim] = start[dim] / skipp->chunks[dim];
+	last[dim] = (start[dim] + count[dim] - 1) / skipp->chunks[dim];
+	ncells *= last[dim] - first[dim] + 1;
+	boxsize *= skipp->chunks[dim] < count[dim] ? skipp->chunks[dim] : count[dim];
+    }
+    isfill = (char *) emalloc(ncells);
+    boxbuf = NULL;
+
+    /* First find which output chunks get only fill values from this
+     * slab, then write the others, if there were any of the former. */
+    for(pass = 0; pass < 2; pass++) {
+	if(pass == 1) {
+	    if(nfill == 0 || ncells == 1) {
+		NC_CHECK(put_box(skipp, ogrp, ovarid, start, count, buf));
+		break;
+	    }
+	    boxbuf = (char *) emalloc(boxsize);
+	}
+	memcpy(cell, first, rank * sizeof(size_t));
+	for(icell = 0; icell < ncells; icell++) {
+	    for(dim = 0; dim < rank; dim++) {
+		size_t lo = cell[dim] * skipp->chunks[dim];
+		size_t hi = lo + skipp->chunks[dim];
+		if(lo < start[dim])
+		    lo = start[dim];
+		if(hi > start[dim] + count[dim])
+		    hi = start[dim] + count[dim];
+		ostart[dim] = lo;
+		bstart[dim] = lo - start[dim];
+		bcount[dim] = hi - lo;
+	    }
+	    if(pass == 0) {
+		isfill[icell] = (char)slab_box(skipp, count, buf, bstart, bcount, NULL);
+		nfill += isfill[icell];
+	    } else if(!isfill[icell]) {
+		slab_box(skipp, count, buf, bstart, bcount, boxbuf);
+		NC_CHECK(put_box(skipp, ogrp, ovarid, ostart, bcount, boxbuf));
+	    }
+	    for(dim = rank - 1; dim >= 0; dim--) { /* next chunk, odometer style */
+		if(++cell[dim] <= last[dim])
+		    break;
+		cell[dim] = first[dim];
+	    }
+	}
+    }
+    free(first);
+    free(last);
+    free(cell);
+    free(bstart);
+    free(bcount);
+    free(ostart);
+    free(isfill);
+    if(boxbuf)
+	free(boxbuf);
+    return stat;
+}
+
+/* Finish copying a variable with skipped fill values.  If the last
+ * value of the variable wasn't written, unlimited dimensions of the
+ * output would end up too short, so write a fill value there. */
+static int
+finish_skip_fill(skip_fill_t *skipp, int ogrp, int ovarid) {
+    int stat = NC_NOERR;
+    int unlim = 0;
+    int dim;
+    if(skipp->fillp == NULL)
+	return stat;
+    if(!skipp->corner_written) {
+	for(dim = 0; dim < skipp->rank; dim++) {
+	    if(skipp->dims[dim] == 0) /* no values to copy */
+		break;
+	    if(skipp->unlim[dim])
+		unlim = 1;
+	}
+	if(dim == skipp->rank && unlim) {
+	    size_t *start = (size_t *) emalloc(skipp->rank * sizeof(size_t));
+	    size_t *count = (size_t *) emalloc(skipp->rank * sizeof(size_t));
+	    for(dim = 0; dim < skipp->rank; dim++) {
+		start[dim] = skipp->dims[dim] - 1;
+		count[dim] = 1;
+	    }
+	    NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, skipp->fillp));
+	    free(start);
+	    free(count);
+	}
+    }
+    free(skipp->fillp);
+    free(skipp->dims);
+    free(skipp->chunks);
+    free(skipp->unlim);
+    return stat;
+}
+
+#ifdef HAVE_PTHREAD_H
+/* Pipelined copying of variable data, with -j option.  A reader
+ * thread gets slabs of values from the input variable into a ring of
+ * buffers, while the main thread puts them to the output variable in
+ * the same order, so the output is the same as for the serial copy.
+ * The netCDF library is not thread-safe, even for classic files, whose
+ * ids are looked up in a list shared by all open files, so calls to
+ * the library are serialized with nc_lock.  Reading still overlaps
+ * with the work outside the library, such as waiting for the disk
+ * or the network while the writer has nothing to do. */
+
+/* A slab of values read from the input, waiting to be written */
+typedef struct copy_slab {
+    size_t *start;
+    size_t *count;
+    size_t nvalues;		/* 0 marks the end of the variable */
+    void *buf;
+} copy_slab_t;
+
+/* A ring of slabs between the reader thread and the writer */
+typedef struct copy_ring {
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    copy_slab_t *slabs;
+    int nslabs;
+    int head;			/* next slab for the reader to fill */
+    int tail;			/* next slab for the writer to empty */
+    int nfull;			/* how many slabs are waiting to be written */
+    int igrp;
+    int varid;
+    nciter_t *iterp;
+} copy_ring_t;
+
+static pthread_mutex_t nc_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Reader thread: fill slabs until the variable has all been read */
+static void *
+read_slabs(void *arg) {
+    copy_ring_t *ring = (copy_ring_t *)arg;
+    copy_slab_t *slab;
+    size_t *start, *count;
+    size_t ntoget;
+    int rank = ring->iterp->rank;
+
+    start = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    count = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    do {
+	ntoget = nc_next_iter(ring->iterp, start, count);
+
+	pthread_mutex_lock(&ring->mutex);
+	while(ring->nfull == ring->nslabs)
+	    pthread_cond_wait(&ring->not_full, &ring->mutex);
+	slab = &ring->slabs[ring->head];
+	pthread_mutex_unlock(&ring->mutex);
+
+	slab->nvalues = ntoget;
+	if(ntoget > 0) {
+	    memcpy(slab->start, start, rank * sizeof(size_t));
+	    memcpy(slab->count, count, rank * sizeof(size_t));
+	    pthread_mutex_lock(&nc_lock);
+	    NC_CHECK(nc_get_vara(ring->igrp, ring->varid, slab->start, slab->count,
+				 slab->buf));
+	    pthread_mutex_unlock(&nc_lock);
+	}
+
+	pthread_mutex_lock(&ring->mutex);
+	ring->head = (ring->head + 1) % ring->nslabs;
+	ring->nfull++;
+	pthread_cond_signal(&ring->not_empty);
+	pthread_mutex_unlock(&ring->mutex);
+    } while(ntoget > 0);
+    free(start);
+    free(count);
+    return NULL;
+}
+
+/* Copy data of variable varid in group igrp to variable ovarid in
+ * ogrp, reading ahead into option_nbuffers buffers */
+static int
+copy_var_data_pipelined(int igrp, int varid, int ogrp, int ovarid,
+			nc_type vartype, nciter_t *iterp) {
+    int stat = NC_NOERR;
+    copy_ring_t ring;
+    copy_slab_t *slab;
+    pthread_t reader;
+    skip_fill_t skip;
+    int i;
+
+    NC_CHECK(init_skip_fill(igrp, varid, ogrp, ovarid, &skip));
+
+    ring.nslabs = option_nbuffers;
+    ring.head = ring.tail = ring.nfull = 0;
+    ring.igrp = igrp;
+    ring.varid = varid;
+    ring.iterp = iterp;
+    ring.slabs = (copy_slab_t *) emalloc(ring.nslabs * sizeof(copy_slab_t));
+    for(i = 0; i < ring.nslabs; i++) {
+	ring.slabs[i].start = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
+	ring.slabs[i].count = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
+	ring.slabs[i].buf = emalloc(option_copy_buffer_size);
+	memset(ring.slabs[i].buf, 0, option_copy_buffer_size);
+    }
+    pthread_mutex_init(&ring.mutex, NULL);
+    pthread_cond_init(&ring.not_empty, NULL);
+    pthread_cond_init(&ring.not_full, NULL);
+
+    if(pthread_create(&reader, NULL, read_slabs, &ring) != 0)
+	error("can't create reader thread");
+
+    /* Write slabs as they are filled, until the end marker */
+    for(;;) {
+	pthread_mutex_lock(&ring.mutex);
+	while(ring.nfull == 0)
+	    pthread_cond_wait(&ring.not_empty, &ring.mutex);
+	slab = &ring.slabs[ring.tail];
+	pthread_mutex_unlock(&ring.mutex);
+
+	if(slab->nvalues == 0)
+	    break;
+	pthread_mutex_lock(&nc_lock);
+	NC_CHECK(put_vara_skip_fill(&skip, ogrp, ovarid, slab->start, slab->count,
+				    slab->nvalues, slab->buf));
+	NC_CHECK(free_var_values(igrp, vartype, slab->nvalues, slab->buf));
+	pthread_mutex_unlock(&nc_lock);
+
+	pthread_mutex_lock(&ring.mutex);
+	ring.tail = (ring.tail + 1) % ring.nslabs;
+	ring.nfull--;
+	pthread_cond_signal(&ring.not_full);
+	pthread_mutex_unlock(&ring.mutex);
+    }
+    pthread_join(reader, NULL);
+    NC_CHECK(finish_skip_fill(&skip, ogrp, ovarid));
+
+    pthread_cond_destroy(&ring.not_full);
+    pthread_cond_destroy(&ring.not_empty);
+    pthread_mutex_destroy(&ring.mutex);
+    for(i = 0; i < ring.nslabs; i++) {
+	free(ring.slabs[i].start);
+	free(ring.slabs[i].count);
+	free(ring.slabs[i].buf);
+    }
+    free(ring.slabs);
+    return stat;
+}
+#endif	/* HAVE_PTHREAD_H */
+
+#ifdef USE_NETCDF4
+/* Copy data of variable varid in group igrp to variable ovarid in
+ * ogrp, a block of shape blocks at a time. */
+static int
+copy_var_blocks(int igrp, int varid, int ogrp, int ovarid, const size_t *blocks) {
+    int stat = NC_NOERR;
+    nciter_t *iterp;
+    size_t *start;
+    size_t *count;
+    size_t bufsize;
+    size_t ntoget;
+    void *buf;
+    skip_fill_t skip;
+    int dim;
+
+    NC_CHECK(init_skip_fill(igrp, varid, ogrp, ovarid, &skip));
+    NC_CHECK(nc_get_block_iter(igrp, varid, blocks, &iterp));
+    bufsize = val_size(igrp, varid);
+    for(dim = 0; dim < iterp->rank; dim++)
+	bufsize *= blocks[dim];
+    buf = emalloc(bufsize);
+    start = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
+    count = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
+    while((ntoget = nc_next_iter(iterp, start, count)) > 0) {
+	NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
+	NC_CHECK(put_vara_skip_fill(&skip, ogrp, ovarid, start, count, ntoget, buf));
+    }
+    NC_CHECK(finish_skip_fill(&skip, ogrp, ovarid));
+    free(start);
+    free(count);
+    free(buf);
+    NC_CHECK(nc_free_iter(iterp));
+    return stat;
+}
+
+/* Copy data of variable varid in group igrp to chunked variable
+ * ovarid in ogrp.  If the chunks are the same, just copy a chunk at a
+ * time.  Otherwise use a plan that moves only whole chunks through
+ * blocks of about option_rechunk_budget bytes, instead of relying on
+ * the output chunk cache to hold every chunk that a slab of input
+ * touches.  If the plan takes two passes, the intermediate chunks go
+ * to a variable in the file scratch_path, which is removed
+ * afterwards. */
+static int
+copy_var_data_rechunked(int igrp, int varid, int ogrp, int ovarid,
+			nc_type vartype) {
+    int stat = NC_NOERR;
+    int ndims;
+    int *dimids;
+    size_t *dims, *ichunks, *ochunks;
+    int icontig = 1, ocontig = 1;
+    rechunk_plan_t *planp;
+    int dim;
+
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    dimids = (int *) emalloc((ndims + 1) * sizeof(int));
+    dims = (size_t *) emalloc((ndims + 1) * sizeof(size_t));
+    ichunks = (size_t *) emalloc((ndims + 1) * sizeof(size_t));
+    ochunks = (size_t *) emalloc((ndims + 1) * sizeof(size_t));
+    NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+    for(dim = 0; dim < ndims; dim++) {
+	NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &dims[dim]));
+    }
+    NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, ichunks));
+    if(icontig != NC_CHUNKED) {	/* contiguous input reads fastest by rows */
+	for(dim = 0; dim < ndims - 1; dim++)
+	    ichunks[dim] = 1;
+	ichunks[ndims - 1] = dims[ndims - 1];
+    }
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, ochunks));
+    if(icontig == NC_CHUNKED
+       && memcmp(ichunks, ochunks, ndims * sizeof(size_t)) == 0) {
+	/* same chunks, so no plan needed, just copy a chunk at a time */
+	NC_CHECK(copy_var_blocks(igrp, varid, ogrp, ovarid, ichunks));
+	goto done;
+    }
+    NC_CHECK(rechunk_plan(ndims, dims, val_size(igrp, varid), ichunks, ochunks,
+			  option_rechunk_budget, &planp));
+
+    if(planp->npasses == 1) {
+	NC_CHECK(copy_var_blocks(igrp, varid, ogrp, ovarid, planp->readblock));
+    } else {
+	int sgrp, svarid;
+	char dimname[NC_MAX_NAME];
+	NC_CHECK(nc_create(scratch_path, NC_NETCDF4 | NC_CLOBBER, &sgrp));
+	for(dim = 0; dim < ndims; dim++) {
+	    snprintf(dimname, sizeof(dimname), "dim%d", dim);
+	    NC_CHECK(nc_def_dim(sgrp, dimname, dims[dim], &dimids[dim]));
+	}
+	NC_CHECK(nc_def_var(sgrp, "scratch", vartype, ndims, dimids, &svarid));
+	NC_CHECK(nc_def_var_chunking(sgrp, svarid, NC_CHUNKED, planp->scratchchunks));
+	NC_CHECK(nc_def_var_fill(sgrp, svarid, NC_NOFILL, NULL));
+	NC_CHECK(nc_enddef(sgrp));
+	NC_CHECK(copy_var_blocks(igrp, varid, sgrp, svarid, planp->readblock));
+	NC_CHECK(copy_var_blocks(sgrp, svarid, ogrp, ovarid, planp->writeblock));
+	NC_CHECK(nc_close(sgrp));
+	(void) remove(scratch_path);
+    }
+    rechunk_free_plan(planp);
+done:
+    free(dimids);
+    free(dims);
+    free(ichunks);
+    free(ochunks);
+    return stat;
+}
+#endif	/* USE_NETCDF4 */
+
 /* Copy data from variable varid in group igrp to corresponding group
  * ogrp. */
 static int
@@ -966,9 +1579,11 @@ copy_var_data(int igrp, int varid, int ogrp) {
     size_t *count;
     nciter_t *iterp;		/* opaque structure for iteration status */
     int do_realloc = 0;
+    skip_fill_t skip;		/* for not writing slabs of fill values */
 #ifdef USE_NETCDF4    
     int okind;
     size_t chunksize;
+    int rechunk = 0;
 #endif
 
     NC_CHECK(inq_nvals(igrp, varid, &nvalues));
@@ -1011,8 +1626,17 @@ copy_var_data(int igrp, int varid, int ogrp) {
 						option_chunk_cache_nelems,
 						COPY_CHUNKCACHE_PREEMPTION));
 	    }
+	    /* With a memory budget, plan the copy of atomic types by
+	     * whole chunks */
+	    if(option_rechunk_budget > 0 && vartype <= NC_MAX_ATOMIC_TYPE
+	       && vartype != NC_STRING)
+		rechunk = 1;
 	}
     }
+    if(rechunk) {
+	NC_CHECK(copy_var_data_rechunked(igrp, varid, ogrp, ovarid, vartype));
+	return stat;
+    }
     /* For chunked variables, option_copy_buffer_size must also be at least as large as
      * size of a chunk in input, otherwise resize it. */
     {
@@ -1023,6 +1647,17 @@ copy_var_data(int igrp, int varid, int ogrp) {
 	}
     }
 #endif	/* USE_NETCDF4 */
+    /* initialize variable iteration */
+    NC_CHECK(nc_get_iter(igrp, varid, option_copy_buffer_size, &iterp));
+
+#ifdef HAVE_PTHREAD_H
+    if(option_nbuffers > 1) {
+	NC_CHECK(copy_var_data_pipelined(igrp, varid, ogrp, ovarid, vartype, iterp));
+	NC_CHECK(nc_free_iter(iterp));
+	return stat;
+    }
+#endif	/* HAVE_PTHREAD_H */
+
     if(buf && do_realloc) {
 	free(buf);
 	buf = 0;
@@ -1032,30 +1667,33 @@ copy_var_data(int igrp, int varid, int ogrp) {
 	memset((void*)buf,0,option_copy_buffer_size);
     }
 
-    /* initialize variable iteration */
-    NC_CHECK(nc_get_iter(igrp, varid, option_copy_buffer_size, &iterp));
-
     start = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
     count = (size_t *) emalloc((iterp->rank + 1) * sizeof(size_t));
-    /* nc_next_iter() initializes start and count on first call,
-     * changes start and count to iterate through whole variable on
-     * subsequent calls. */
-    while((ntoget = nc_next_iter(iterp, start, count)) > 0) {
-	NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
-	NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, buf));
-#ifdef USE_NETCDF4
-	/* we have to explicitly free values for strings and vlens */
-	if(vartype == NC_STRING) {
-	    NC_CHECK(nc_free_string(ntoget, (char **)buf));
-	} else if(vartype > NC_STRING) { /* user-defined type */
-	    nc_type vclass;
-	    NC_CHECK(nc_inq_user_type(igrp, vartype, NULL, NULL, NULL, NULL, &vclass));
-	    if(vclass == NC_VLEN) {
-		NC_CHECK(nc_free_vlens(ntoget, (nc_vlen_t *)buf));
-	    }
+    NC_CHECK(init_skip_fill(igrp, varid, ogrp, ovarid, &skip));
+    if(skip.unwritten) {
+	/* Go a chunk at a time, skipping input chunks that were never
+	 * written without reading them. */
+	nc_chunk_iter_t *citerp;
+	NC_CHECK(nc_get_chunk_iter(igrp, varid, NC_CHUNK_ITER_SKIP_FILL, &citerp));
+	for(;;) {
+	    NC_CHECK(nc_next_chunk_iter(citerp, start, count, &ntoget));
+	    if(ntoget == 0)
+		break;
+	    NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
+	    NC_CHECK(put_vara_skip_fill(&skip, ogrp, ovarid, start, count, ntoget, buf));
 	}
-#endif	/* USE_NETCDF4 */
-    } /* end main iteration loop */
+	NC_CHECK(nc_free_chunk_iter(citerp));
+    } else {
+	/* nc_next_iter() initializes start and count on first call,
+	 * changes start and count to iterate through whole variable on
+	 * subsequent calls. */
+	while((ntoget = nc_next_iter(iterp, start, count)) > 0) {
+	    NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
+	    NC_CHECK(put_vara_skip_fill(&skip, ogrp, ovarid, start, count, ntoget, buf));
+	    NC_CHECK(free_var_values(igrp, vartype, ntoget, buf));
+	} /* end main iteration loop */
+    }
+    NC_CHECK(finish_skip_fill(&skip, ogrp, ovarid));
 #ifdef USE_NETCDF4
     /* We're all done with this input and output variable, so if
      * either variable is chunked, free up its variable chunk cache */
@@ -1232,37 +1870,48 @@ copy_fixed_size_data(int igrp, int ogrp, size_t nfixed_vars, int *fixed_varids)
     return NC_NOERR;
 }
 
-/* copy a record's worth of data for a variable from input to output */
+/* copy a batch of records of data for a variable from input to output */
 static int
 copy_rec_var_data(int ncid, 	/* input */
 		  int ogrp, 	/* output */
-		  int irec, 	/* record number */
+		  int irec, 	/* first record number */
 		  int varid, 	/* input variable id */
 		  int ovarid, 	/* output variable id */
 		  size_t *start,   /* start indices for record data */
 		  size_t *count,   /* edge lengths for record data */
-		  void *buf	   /* buffer large enough to hold data */
+		  size_t nvals,	   /* number of values in the batch */
+		  void *buf,	   /* buffer large enough to hold data */
+		  skip_fill_t *skipp /* for skipping fill values in output */
     ) 
 {
     NC_CHECK(nc_get_vara(ncid, varid, start, count, buf));
-    NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, buf));
+    NC_CHECK(put_vara_skip_fill(skipp, ogrp, ovarid, start, count, nvals, buf));
     return NC_NOERR;
 }
 
-/* Only called for classic format or 64-bit offset format files, to speed up special case */
+/* Only called for classic format or 64-bit offset format files, to
+ * speed up special case.  Records are copied in batches of as many as
+ * fit in the copy buffer, with one read and one write per variable for
+ * each batch, rather than a call per variable per record. */
 static int
 copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
     int unlimid;
     size_t nrecs = 0;		/* how many records? */
     size_t irec;
     size_t ivar;
+    size_t recbytes = 0;	/* bytes in one record of all record variables */
+    size_t batch;		/* how many records to copy at a time */
     void **buf;			/* space for reading in data for each variable */
     int *rec_ovarids;		/* corresponding varids in output */
     size_t **start;
     size_t **count;
+    size_t *nvals;		/* number of values in a record of each variable */
+    skip_fill_t *skips;		/* for skipping fill values of each variable */
     NC_CHECK(nc_inq_unlimdim(ncid, &unlimid));
     NC_CHECK(nc_inq_dimlen(ncid, unlimid, &nrecs));
     buf = (void **) emalloc(nrec_vars * sizeof(void *));
+    nvals = (size_t *) emalloc(nrec_vars * sizeof(size_t));
+    skips = (skip_fill_t *) emalloc(nrec_vars * sizeof(skip_fill_t));
     rec_ovarids = (int *) emalloc(nrec_vars * sizeof(int));
     start = (size_t **) emalloc(nrec_vars * sizeof(size_t*));
     count = (size_t **) emalloc(nrec_vars * sizeof(size_t*));
@@ -1274,7 +1923,6 @@ copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
 	size_t value_size;
 	int dimid;
 	int ii;
-	size_t nvals;
 	char varname[NC_MAX_NAME];
 	varid = rec_varids[ivar];
 	NC_CHECK(nc_inq_varndims(ncid, varid, &ndims));
@@ -1283,35 +1931,54 @@ copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
 	count[ivar] = (size_t *) emalloc(ndims * sizeof(size_t));
 	NC_CHECK(nc_inq_vardimid (ncid, varid, dimids));
 	value_size = val_size(ncid, varid);
-	nvals = 1;
+	nvals[ivar] = 1;
 	for(ii = 1; ii < ndims; ii++) { /* for rec size, don't include first record dimension */
 	    size_t dimlen;
 	    dimid = dimids[ii];
 	    NC_CHECK(nc_inq_dimlen(ncid, dimid, &dimlen));
-	    nvals *= dimlen;
+	    nvals[ivar] *= dimlen;
 	    start[ivar][ii] = 0;
 	    count[ivar][ii] = dimlen;
 	}
 	start[ivar][0] = 0;	
 	count[ivar][0] = 1;	/* 1 record */
-	buf[ivar] = (void *) emalloc(nvals * value_size);
+	recbytes += nvals[ivar] * value_size;
 	NC_CHECK(nc_inq_varname(ncid, varid, varname));
 	NC_CHECK(nc_inq_varid(ogrp, varname, &rec_ovarids[ivar]));
+	NC_CHECK(init_skip_fill(ncid, varid, ogrp, rec_ovarids[ivar], &skips[ivar]));
 	if(dimids)
 	    free(dimids);
     }
 
-    /* for each record, copy all variable data */
-    for(irec = 0; irec < nrecs; irec++) {
+    /* get space to hold a batch of records for each record variable */
+    batch = recbytes > 0 ? option_copy_buffer_size / recbytes : nrecs;
+    if(batch > nrecs)
+	batch = nrecs;
+    if(batch < 1)
+	batch = 1;
+    for (ivar = 0; ivar < nrec_vars; ivar++) {
+	buf[ivar] = (void *) emalloc(batch * nvals[ivar] * val_size(ncid, rec_varids[ivar]));
+    }
+
+    /* for each batch of records, copy all variable data */
+    for(irec = 0; irec < nrecs; irec += batch) {
+	size_t nbatch = nrecs - irec < batch ? nrecs - irec : batch;
 	for (ivar = 0; ivar < nrec_vars; ivar++) {
 	    int varid, ovarid;
 	    varid = rec_varids[ivar];
 	    ovarid = rec_ovarids[ivar];
 	    start[ivar][0] = irec;
+	    count[ivar][0] = nbatch;
 	    NC_CHECK(copy_rec_var_data(ncid, ogrp, irec, varid, ovarid, 
-				       start[ivar], count[ivar], buf[ivar]));
+				       start[ivar], count[ivar], nbatch * nvals[ivar],
+				       buf[ivar], &skips[ivar]));
 	}
     }
+    for (ivar = 0; ivar < nrec_vars; ivar++) {
+	NC_CHECK(finish_skip_fill(&skips[ivar], ogrp, rec_ovarids[ivar]));
+    }
+    free(skips);
+    free(nvals);
     for (ivar = 0; ivar < nrec_vars; ivar++) {
 	if(start[ivar])
 	    free(start[ivar]);
@@ -1336,6 +2003,181 @@ copy_record_data(int ncid, int ogrp, size_t nrec_vars, int *rec_varids) {
     return NC_NOERR;
 }
 
+#ifdef USE_RAW_COPY
+/* If input and output are classic format files of the same kind in
+ * which every variable starts at the same offset and records have the
+ * same size, the data section of the output is byte for byte that of
+ * the input.  In that case, return 1 and get the extent of the bytes
+ * to copy, from the start of the first variable to the end of the
+ * last value in the input.  Copies that ask for how the data are
+ * moved, with -j, -m or -S, still go through the API. */
+static int
+same_classic_layout(const char *infile, int igrp, int ogrp, int inkind,
+		    int outkind, off_t *beginp, off_t *endp) {
+    int nvars, onvars;
+    int varid;
+    int unlimid;
+    size_t nrecs = 0;
+    long long begin = -1, end = 0;
+
+    if(inkind != outkind || option_write_diskless || option_nlvars > 0)
+	return 0;
+    if(option_nbuffers > 1 || option_copy_buffer_set || option_skip_fill)
+	return 0;
+    if(inkind != NC_FORMAT_CLASSIC && inkind != NC_FORMAT_64BIT_OFFSET
+       && inkind != NC_FORMAT_CDF5)
+	return 0;
+    NC_CHECK(nc_inq_nvars(igrp, &nvars));
+    NC_CHECK(nc_inq_nvars(ogrp, &onvars));
+    if(nvars != onvars)
+	return 0;
+    NC_CHECK(nc_inq_unlimdim(igrp, &unlimid));
+    if(unlimid != -1)
+	NC_CHECK(nc_inq_dimlen(igrp, unlimid, &nrecs));
+    for(varid = 0; varid < nvars; varid++) {
+	long long ioffset, istride, ooffset, ostride;
+	long long nbytes;
+	int ndims, dimid;
+	int *dimids;
+	int recvar;
+	int d;
+	/* input may not be a local file, such as from an OPeNDAP server */
+	if(nc_inq_var_offset(igrp, varid, &ioffset, &istride) != NC_NOERR
+	   || nc_inq_var_offset(ogrp, varid, &ooffset, &ostride) != NC_NOERR)
+	    return 0;
+	if(ioffset != ooffset || istride != ostride)
+	    return 0;
+	/* bytes of the variable, or of one record of it */
+	NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+	dimids = (int *) emalloc((ndims + 1) * sizeof(int));
+	NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+	recvar = isrecvar(igrp, varid);
+	nbytes = val_size(igrp, varid);
+	for(d = recvar ? 1 : 0; d < ndims; d++) {
+	    size_t len;
+	    dimid = dimids[d];
+	    NC_CHECK(nc_inq_dimlen(igrp, dimid, &len));
+	    nbytes *= len;
+	}
+	free(dimids);
+	if(recvar) {
+	    if(nrecs == 0)
+		continue;
+	    nbytes += (long long)(nrecs - 1) * istride;
+	}
+	if(nbytes == 0)
+	    continue;
+	if(begin == -1 || ioffset < begin)
+	    begin = ioffset;
+	if(ioffset + nbytes > end)
+	    end = ioffset + nbytes;
+    }
+    if(begin == -1)		/* no data to copy */
+	return 0;
+    /* A file written in no-fill mode may end before the last values of
+     * its last record variable were ever written.  The API reads
+     * those as zeros, so copy such a file through the API instead. */
+    {
+	int ifd = open(infile, O_RDONLY);
+	off_t size = ifd < 0 ? -1 : lseek(ifd, 0, SEEK_END);
+	if(ifd >= 0)
+	    close(ifd);
+	if(size < (off_t) end)
+	    return 0;
+    }
+    *beginp = (off_t) begin;
+    *endp = (off_t) end;
+    return 1;
+}
+
+/* Copy bytes from begin up to end of infile to the same place in
+ * outfile.  Where the kernel supports it, the copy is made without
+ * passing the data through user space, and file systems that can
+ * share extents between files may do so. */
+static int
+copy_file_bytes(const char *infile, const char *outfile, off_t begin, off_t end) {
+    int ifd, ofd;
+    off_t ioff = begin, ooff = begin;
+
+    if((ifd = open(infile, O_RDONLY)) < 0)
+	error("can't open %s: %s", infile, strerror(errno));
+    if((ofd = open(outfile, O_WRONLY)) < 0)
+	error("can't open %s: %s", outfile, strerror(errno));
+#ifdef HAVE_COPY_FILE_RANGE
+    while(ioff < end) {
+	size_t len = end - ioff > (1 << 30) ? (1 << 30) : (size_t)(end - ioff);
+	ssize_t n = copy_file_range(ifd, &ioff, ofd, &ooff, len, 0);
+	if(n <= 0)		/* not supported here, copy the rest below */
+	    break;
+    }
+#endif
+    if(ioff < end) {
+	char *buf = (char *) emalloc(option_copy_buffer_size);
+	if(lseek(ifd, ioff, SEEK_SET) < 0 || lseek(ofd, ooff, SEEK_SET) < 0)
+	    error("can't seek in %s or %s: %s", infile, outfile, strerror(errno));
+	while(ioff < end) {
+	    size_t len = end - ioff > option_copy_buffer_size ?
+		option_copy_buffer_size : (size_t)(end - ioff);
+	    ssize_t n = read(ifd, buf, len);
+	    if(n <= 0)
+		error("can't read %s: %s", infile, n < 0 ? strerror(errno) : "file too short");
+	    if(write(ofd, buf, n) != n)
+		error("can't write %s: %s", outfile, strerror(errno));
+	    ioff += n;
+	}
+	free(buf);
+    }
+    if(close(ofd) < 0)
+	error("can't write %s: %s", outfile, strerror(errno));
+    close(ifd);
+    return NC_NOERR;
+}
+
+/* After records have been copied as bytes, the output header still
+ * says there are none.  Copy the last record of a record variable
+ * through the API, which also updates the record count. */
+static int
+copy_numrecs(int igrp, int ogrp) {
+    int unlimid;
+    size_t nrecs = 0;
+    int nvars;
+    int varid;
+
+    NC_CHECK(nc_inq_unlimdim(igrp, &unlimid));
+    if(unlimid == -1)
+	return NC_NOERR;
+    NC_CHECK(nc_inq_dimlen(igrp, unlimid, &nrecs));
+    if(nrecs == 0)
+	return NC_NOERR;
+    NC_CHECK(nc_inq_nvars(igrp, &nvars));
+    for(varid = 0; varid < nvars; varid++) {
+	int ndims;
+	int dimids[NC_MAX_VAR_DIMS];
+	size_t start[NC_MAX_VAR_DIMS], count[NC_MAX_VAR_DIMS];
+	size_t nvals = 1;
+	void *buf;
+	int d;
+	if(!isrecvar(igrp, varid))
+	    continue;
+	NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+	NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+	start[0] = nrecs - 1;
+	count[0] = 1;
+	for(d = 1; d < ndims; d++) {
+	    start[d] = 0;
+	    NC_CHECK(nc_inq_dimlen(igrp, dimids[d], &count[d]));
+	    nvals *= count[d];
+	}
+	buf = emalloc(nvals * val_size(igrp, varid));
+	NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
+	NC_CHECK(nc_put_vara(ogrp, varid, start, count, buf));
+	free(buf);
+	break;
+    }
+    return NC_NOERR;
+}
+#endif	/* USE_RAW_COPY */
+
 /* copy infile to outfile using netCDF API
  */
 static int
@@ -1347,6 +2189,9 @@ copy(char* infile, char* outfile)
     int open_mode = NC_NOWRITE;
     int create_mode = NC_CLOBBER;
     size_t ndims;
+#ifdef USE_RAW_COPY
+    off_t raw_begin, raw_end;
+#endif
 
     if(option_read_diskless) {
 	open_mode |= NC_DISKLESS;
@@ -1433,6 +2278,12 @@ copy(char* infile, char* outfile)
     }
     NC_CHECK(nc_create(outfile, create_mode, &ogrp));
     NC_CHECK(nc_set_fill(ogrp, NC_NOFILL, NULL));
+    if(option_rechunk_budget > 0) {
+	/* scratch file for rechunking goes next to output */
+	scratch_path = (char *) emalloc(strlen(outfile) + strlen(".rechunk") + 1);
+	strcpy(scratch_path, outfile);
+	strcat(scratch_path, ".rechunk");
+    }
 
 #ifdef USE_NETCDF4
     /* Because types in one group may depend on types in a different
@@ -1448,11 +2299,24 @@ copy(char* infile, char* outfile)
     NC_CHECK(copy_schema(igrp, ogrp));
     NC_CHECK(nc_enddef(ogrp));
 
+#ifdef USE_RAW_COPY
+    /* Fastest of all, for classic input and output with the same
+     * layout, copy the data section as bytes, with no decoding */
+    if(same_classic_layout(infile, igrp, ogrp, inkind, outkind, &raw_begin, &raw_end)) {
+	NC_CHECK(nc_close(ogrp)); /* write header, drop any buffered blocks */
+	NC_CHECK(copy_file_bytes(infile, outfile, raw_begin, raw_end));
+	NC_CHECK(nc_open(outfile, NC_WRITE, &ogrp));
+	NC_CHECK(nc_set_fill(ogrp, NC_NOFILL, NULL));
+	NC_CHECK(copy_numrecs(igrp, ogrp));
+    } else
+#endif
     /* For performance, special case netCDF-3 input or output file with record
      * variables, to copy a record-at-a-time instead of a
      * variable-at-a-time. */
     /* TODO: check that these special cases work with -v option */
-    if(nc3_special_case(igrp, inkind)) {
+    if(nc3_special_case(igrp, inkind) && !(option_rechunk_budget > 0
+		&& (outkind == NC_FORMAT_NETCDF4
+		    || outkind == NC_FORMAT_NETCDF4_CLASSIC))) {
 	size_t nfixed_vars, nrec_vars;
 	int *fixed_varids;
 	int *rec_varids;
@@ -1473,6 +2337,8 @@ copy(char* infile, char* outfile)
 
     NC_CHECK(nc_close(igrp));
     NC_CHECK(nc_close(ogrp));
+    if(scratch_path)
+	free(scratch_path);
     return stat;
 }
 
@@ -1528,7 +2394,7 @@ usage(void)
   [-5]      CDF5 output (same as -k 'cdf5)\n\
   [-d n]    set output deflation compression level, default same as input (0=none 9=max)\n\
   [-s]      add shuffle option to deflation compression\n\
-  [-c chunkspec] specify chunking for dimensions, e.g. \"dim1/N1,dim2/N2,...\"\n\
+  [-c chunkspec] specify chunking for dimensions, e.g. \"dim1/N1,dim2/N2,...\", or \"auto:timeseries|slice|balanced\"\n\
   [-u]      convert unlimited dimensions to fixed-size dimensions in output copy\n\
   [-w]      write whole output file from diskless netCDF on close\n\
   [-v var1,...] include data for only listed variables, but definitions for all variables\n\
@@ -1539,13 +2405,16 @@ usage(void)
   [-h n]    set size in bytes of chunk_cache for chunked variables\n\
   [-e n]    set number of elements that chunk_cache can hold\n\
   [-r]      read whole input file into diskless file on open (classic or 64-bit offset or cdf5 formats only)\n\
+  [-j n]    read ahead into n copy buffers in a separate thread while writing, default 1 (no read ahead)\n\
+  [-M n]    rechunk variables through whole-chunk blocks of about n bytes, in one or two passes\n\
+  [-S]      don't write chunks of netCDF-4 output that hold only fill values, using fill mode for them\n\
   infile    name of netCDF input file\n\
   outfile   name for netCDF output file\n"
 
     /* Don't document this flaky option until it works better */
     /* [-x]      use experimental computed estimates for variable-specific chunk caches\n\ */
 
-    error("%s [-k kind] [-[3|4|6|7]] [-d n] [-s] [-c chunkspec] [-u] [-w] [-[v|V] varlist] [-[g|G] grplist] [-m n] [-h n] [-e n] [-r] infile outfile\n%s\nnetCDF library version %s",
+    error("%s [-k kind] [-[3|4|6|7]] [-d n] [-s] [-c chunkspec] [-u] [-w] [-[v|V] varlist] [-[g|G] grplist] [-m n] [-h n] [-e n] [-r] [-j n] [-M n] [-S] infile outfile\n%s\nnetCDF library version %s",
 	  progname, USAGE, nc_inq_libvers());
 }
 
@@ -1609,7 +2478,7 @@ main(int argc, char**argv)
        usage();
     }
 
-    while ((c = getopt(argc, argv, "k:3467d:sum:c:h:e:rwxg:G:v:V:")) != -1) {
+    while ((c = getopt(argc, argv, "k:3467d:sum:c:h:e:rwxg:G:v:V:j:M:S")) != -1) {
 	switch(c) {
         case 'k': /* for specifying variant of netCDF format to be generated 
                      Format names:
@@ -1673,6 +2542,7 @@ main(int argc, char**argv)
 	    if(dval < 0)
 		error("Suffix used for '-m' option value must be K, M, G, T, or P");
 	    option_copy_buffer_size = dval;
+	    option_copy_buffer_set = 1;
 	    break;
 	}
 	case 'h':		/* non-default size of chunk cache */
@@ -1697,6 +2567,28 @@ main(int argc, char**argv)
 	case 'w':
 	    option_write_diskless = 1; /* write to memory, persist on close */
 	    break;
+	case 'j':		/* number of copy buffers for reading ahead */
+	    option_nbuffers = strtol(optarg, NULL, 10);
+	    if(option_nbuffers < 1) {
+		error("invalid number of copy buffers: %d", option_nbuffers);
+	    }
+#ifndef HAVE_PTHREAD_H
+	    if(option_nbuffers > 1) {
+		error("-j option requires threads, which are not available");
+	    }
+#endif
+	    break;
+	case 'M':		/* memory budget for rechunking plans */
+	{
+	    double dval = double_with_suffix(optarg);	/* "K" for kilobytes. "M" for megabytes, ... */
+	    if(dval <= 0)
+		error("Value of '-M' option must be positive, with optional suffix K, M, G, T, or P");
+	    option_rechunk_budget = dval;
+	    break;
+	}
+	case 'S':		/* skip writing chunks of only fill values */
+	    option_skip_fill = 1;
+	    break;
 	case 'x':		/* use experimental variable-specific chunk caches */
 	    option_compute_chunkcaches = 1;
 	    break;
@@ -38,6 +38,8 @@ int optind;
 #include "netcdf.h"
 #include "utils.h"
 #include "nccomps.h"
+#include "export.h"
+#include "slabspec.h"
 #include "nctime0.h"		/* new iso time and calendar stuff */
 #include "dumplib.h"
 #include "ncdump.h"
@@ -98,6 +100,7 @@ fspec_t formatting_specs =	/* defaults, overridden by command-line options */
     false,	        /* for DAP URLs, client-side cache used */
     0,			/* if -v specified, number of variables in list */
     0,			/* if -v specified, list of variable names */
+    0,			/* if -v specified, list of hyperslabs */
     0,			/* if -g specified, number of groups names in list */
     0,			/* if -g specified, list of group names */
     0,			/* if -g specified, list of matching grpids */
@@ -110,10 +113,12 @@ usage(void)
 #define USAGE   "\
   [-c]             Coordinate variable data and header information\n\
   [-h]             Header information only, no data\n\
-  [-v var1[,...]]  Data for variable(s) <var1>,... only\n\
+  [-v var1[,...]]  Data for variable(s) <var1>,... only, or hyperslabs such as <var1>[0:10,5,::2]\n\
   [-b [c|f]]       Brief annotations for C or Fortran indices in data\n\
   [-f [c|f]]       Full annotations for C or Fortran indices in data\n\
   [-l len]         Line length maximum in data section (default 80)\n\
+  [-j n]           Format data values with n threads\n\
+  [-E raw|npy|csv] Export data of -v variables as binary, NumPy or CSV\n\
   [-n name]        Name for netCDF (default derived from file name)\n\
   [-p n[,n]]       Display floating-point values with less precision\n\
   [-k]             Output kind of netCDF file\n\
@@ -128,7 +133,7 @@ usage(void)
   file             Name of netCDF file (or URL if DAP access enabled)\n"
 
     (void) fprintf(stderr,
-		   "%s [-c|-h] [-v ...] [[-b|-f] [c|f]] [-l len] [-n name] [-p n[,n]] [-k] [-x] [-s] [-t|-i] [-g ...] [-w] [-Ln] file\n%s",
+		   "%s [-c|-h] [-v ...] [[-b|-f] [c|f]] [-l len] [-j n] [-E fmt] [-n name] [-p n[,n]] [-k] [-x] [-s] [-t|-i] [-g ...] [-w] [-Ln] file\n%s",
 		   progname,
 		   USAGE);
 
@@ -1486,6 +1491,40 @@ get_fill_info(int ncid, int varid, ncvar_t *vp) {
 }
 
 
+/*
+ * If a hyperslab of variable varp, with id varid in group ncid, was
+ * specified with -v, set the start and stride of the hyperslab in
+ * varp, and change vdims from the variable's shape to the
+ * hyperslab's.
+ */
+static void
+set_var_slab(int ncid, int varid, ncvar_t *varp, size_t *vdims)
+{
+    int iv;
+    for (iv = 0; iv < formatting_specs.nlvars; iv++) {
+	int slabvarid;
+	size_t *count;
+	int ret;
+	if (formatting_specs.lslabs[iv] == NULL ||
+	    nc_inq_gvarid(ncid, formatting_specs.lvars[iv], &slabvarid) != NC_NOERR ||
+	    slabvarid != varid)
+	    continue;
+	varp->slab_start = (size_t *) emalloc((varp->ndims + 1) * sizeof(size_t));
+	varp->slab_stride = (ptrdiff_t *) emalloc((varp->ndims + 1) * sizeof(ptrdiff_t));
+	count = (size_t *) emalloc((varp->ndims + 1) * sizeof(size_t));
+	ret = slabspec_parse(formatting_specs.lslabs[iv], varp->ndims, vdims,
+			     varp->slab_start, count, varp->slab_stride);
+	if (ret != NC_NOERR) {
+	    error("%s[%s]: %s", formatting_specs.lvars[iv],
+		  formatting_specs.lslabs[iv], nc_strerror(ret));
+	}
+	memcpy(vdims, count, varp->ndims * sizeof(size_t));
+	free(count);
+	return;
+    }
+}
+
+
 /* Recursively dump the contents of a group. (Only netcdf-4 format
  * files can have groups, so recursion will not take place for classic
  * format files.)
@@ -1811,6 +1850,14 @@ do_ncdump_rec(int ncid, const char *path)
 	     vdims = 0;
 	     continue;
 	 }
+	 if(var.slab_start != NULL) {
+	     free(var.slab_start);
+	     free(var.slab_stride);
+	     var.slab_start = NULL;
+	     var.slab_stride = NULL;
+	 }
+	 if (formatting_specs.lslabs)
+	     set_var_slab(ncid, varid, &var, vdims);
 	 if(var.fillvalp != NULL) free(var.fillvalp);
 	 get_fill_info(ncid, varid, &var); /* sets has_fillval, fillvalp mmbrs */
 	 if(var.timeinfo != NULL) {
@@ -1877,6 +1924,10 @@ do_ncdump_rec(int ncid, const char *path)
 done:
    if(var.dims != NULL) free(var.dims);
    if(var.fillvalp != NULL) free(var.fillvalp);
+   if(var.slab_start != NULL) {
+      free(var.slab_start);
+      free(var.slab_stride);
+   }
    if(var.timeinfo != NULL) {
       if(var.timeinfo->units) free(var.timeinfo->units);
       free(var.timeinfo);
@@ -2101,6 +2152,7 @@ main(int argc, char *argv[])
     bool_t kind_out = false;	/* if true, just output kind of netCDF file */
     bool_t kind_out_extended = false;	/* output inq_format vs inq_format_extended */
     int Xp_flag = 0;    /* indicate that -Xp flag was set */
+    export_format_t export_fmt = EXPORT_NONE; /* if set, export data instead of CDL */
 
 #if defined(WIN32) || defined(msdos) || defined(WIN64)
     putenv("PRINTF_EXPONENT_DIGITS=2"); /* Enforce unix/linux style exponent formatting. */
@@ -2121,7 +2173,7 @@ main(int argc, char *argv[])
        exit(EXIT_SUCCESS);
     }
 
-    while ((c = getopt(argc, argv, "b:cd:f:g:hikl:n:p:stv:xwKL:X:")) != EOF)
+    while ((c = getopt(argc, argv, "b:cd:E:f:g:hij:kl:n:p:stv:xwKL:X:")) != EOF)
       switch(c) {
 	case 'h':		/* dump header only, no data */
 	  formatting_specs.header_only = true;
@@ -2168,9 +2220,28 @@ main(int argc, char *argv[])
 	      error("unreasonably small line length specified: %d", max_len);
 	  }
 	  break;
+	case 'j':		/* number of threads formatting values */
+	  formatting_specs.nthreads = (int) strtol(optarg, 0, 0);
+	  if (formatting_specs.nthreads < 1) {
+	      error("invalid number of threads: %d", formatting_specs.nthreads);
+	  }
+#ifndef HAVE_PTHREAD_H
+	  if (formatting_specs.nthreads > 1) {
+	      error("-j option requires threads, which are not available");
+	  }
+#endif
+	  break;
+	case 'E':		/* export data in a binary or columnar format */
+	  export_fmt = export_format(optarg);
+	  if (export_fmt == EXPORT_NONE) {
+	      error("invalid value for -E option: %s", optarg);
+	  }
+	  break;
 	case 'v':		/* variable names */
 	  /* make list of names of variables specified */
 	  make_lvars (optarg, &formatting_specs.nlvars, &formatting_specs.lvars);
+	  formatting_specs.lslabs = slabspec_split(formatting_specs.nlvars,
+						   formatting_specs.lvars);
 	  break;
 	case 'g':		/* group names */
 	  /* make list of names of groups specified */
@@ -2249,6 +2320,10 @@ main(int argc, char *argv[])
 
     set_max_len(max_len);
 
+    if (export_fmt != EXPORT_NONE && formatting_specs.nlvars == 0) {
+	error("-E option requires variables to export, named with -v");
+    }
+
     argc -= optind;
     argv += optind;
 
@@ -2320,11 +2395,21 @@ main(int argc, char *argv[])
 		    if(grp_matches(ncid, formatting_specs.nlgrps, formatting_specs.lgrps, formatting_specs.grpids) == 0)
 			exit(EXIT_FAILURE);
 		}
-		if (xml_out) {
+		if (export_fmt != EXPORT_NONE) {
+		    export_vars(ncid, export_fmt, formatting_specs.nlvars,
+				formatting_specs.lvars, formatting_specs.lslabs);
+		} else if (xml_out) {
+		    int iv;
 		    if(formatting_specs.nc_kind == NC_FORMAT_NETCDF4) {
 			error("NcML output (-x) currently only permitted for netCDF classic model");
 			exit(EXIT_FAILURE);
 		    }
+		    /* NcML output has no data values to take a hyperslab of */
+		    for (iv = 0; iv < formatting_specs.nlvars; iv++) {
+			if (formatting_specs.lslabs[iv] != NULL)
+			    error("hyperslab %s[%s] not permitted with NcML output (-x)",
+				  formatting_specs.lvars[iv], formatting_specs.lslabs[iv]);
+		    }
 		    do_ncdumpx(ncid, path);
 		} else {
 		    do_ncdump(ncid, path);
@@ -59,6 +59,10 @@ typedef struct {			/* specification for how to format dump */
     char** lvars;		/* list of variable names specified with -v
 				 * option on command line */
 
+    char** lslabs;		/* hyperslab specified with -v for each
+				 * variable in lvars, as in
+				 * "var[0:10,:]", or NULL for all of it */
+
     int nlgrps;			/* Number of groups specified with -g
 				 * option on command line */
 
@@ -79,6 +83,9 @@ typedef struct {			/* specification for how to format dump */
 
     int xopt_inmemory;      /* Use in-memory option; testing only */
     int xopt_props ;      /* 1=>Unconditionally Suppress properties attribute */
+    int nthreads;		/* number of threads formatting data
+				 * values, from -j option, 0 or 1 to
+				 * format them as they are printed */
 } fspec_t;
 
 #endif	/*_NCDUMP_H_ */
@@ -138,14 +138,15 @@ up_start(
 }
 
 /*
- * Updates a vector of size_t, odometer style, for chunk access.
- * Returns 0 if odometer overflowed, else 1.
+ * Updates a vector of size_t, odometer style, for access by blocks,
+ * such as chunks or multiples of chunks.  Returns 0 if odometer
+ * overflowed, else 1.
  */
 static int
-up_start_by_chunks(
+up_start_by_blocks(
      int ndims,		 /* Number of dimensions */
      const size_t *dims, /* The "odometer" limits for each dimension */
-     const size_t *chunks, /* the odometer increments for each dimension */
+     const size_t *blocks, /* the odometer increments for each dimension */
      size_t* odom	 /* The "odometer" vector to be updated */
      )
 {
@@ -153,10 +154,10 @@ up_start_by_chunks(
     int id;
     int ret = 1;
 
-    odom[incdim] += chunks[incdim];
+    odom[incdim] += blocks[incdim];
     for (id = incdim; id > 0; id--) {
 	if(odom[id] >= dims[id]) {
-	    odom[id-1] += chunks[id-1];
+	    odom[id-1] += blocks[id-1];
 	    /* odom[id] -= dims[id]; */
 	    odom[id] = 0;
 	}
@@ -226,6 +227,51 @@ nc_get_iter(int ncid,
     return stat;
 }
 
+/* Initialize iteration over a variable in blocks of the shape given
+ * by blocksizes, rather than in chunks or rows.  The blocks need not
+ * match the variable's chunks, but blocks that are multiples of the
+ * chunk shape access whole chunks.  Caller must release the iterator
+ * with nc_free_iter(). */
+int
+nc_get_block_iter(int ncid,
+		  int varid,
+		  const size_t *blocksizes, /* shape of each block */
+		  nciter_t **iterpp /* returned opaque iteration state */)
+{
+    int stat = NC_NOERR;
+    nciter_t *iterp;
+    nc_type vartype;
+    size_t value_size = 0;
+    size_t bufsize;
+    int ndims;
+    int *dimids;
+    int dim;
+
+    iterp = (nciter_t *) emalloc(sizeof(nciter_t));
+    memset((void*)iterp,0,sizeof(nciter_t));
+
+    NC_CHECK(nc_inq_varndims(ncid, varid, &ndims));
+    dimids = (int *) emalloc((ndims + 1) * sizeof(int));
+    iterp->dimsizes = (size_t *) emalloc((ndims + 1) * sizeof(size_t));
+    iterp->chunksizes = (size_t *) emalloc((ndims + 1) * sizeof(size_t));
+
+    NC_CHECK(nc_inq_vartype(ncid, varid, &vartype));
+    NC_CHECK(inq_value_size(ncid, vartype, &value_size));
+    NC_CHECK(nc_inq_vardimid (ncid, varid, dimids));
+    bufsize = value_size;
+    for(dim = 0; dim < ndims; dim++) {
+	NC_CHECK(nc_inq_dimlen(ncid, dimids[dim], &iterp->dimsizes[dim]));
+	iterp->chunksizes[dim] = blocksizes[dim];
+	bufsize *= blocksizes[dim];
+    }
+    /* Blocks are stepped through just like chunks */
+    NC_CHECK(nc_blkio_init(bufsize, value_size, ndims, 1, iterp));
+    iterp->to_get = 0;
+    free(dimids);
+    *iterpp = iterp;
+    return stat;
+}
+
 /* Iterate on blocks for variables, by updating start and count vector
  * for next vara call.  Assumes nc_get_iter called first.  Returns
  * number of variable values to get, 0 if done, negative number if
@@ -284,7 +330,7 @@ nc_next_iter(nciter_t *iter,	/* returned opaque iteration state */
 		}
 	    }
 	} else {		/* chunked storage */
-	    iter->more = up_start_by_chunks(iter->rank, iter->dimsizes,
+	    iter->more = up_start_by_blocks(iter->rank, iter->dimsizes,
 					    iter->chunksizes, start);
 	    /* adjust count to stay in range of dimsizes */
 	    for(i = 0; i < iter->rank; i++) {
@@ -30,7 +30,7 @@ typedef struct {
     size_t inc;	     /* increment for right_dim element of start vector */
     int chunked;     /* 1 if chunked, 0 if contiguous */
     size_t *dimsizes;
-    size_t *chunksizes; /* ignored if not chunked */
+    size_t *chunksizes; /* chunk or block shape, ignored if not chunked */
 } nciter_t;
 
 /*
@@ -43,6 +43,13 @@ typedef struct {
 extern int
 nc_get_iter(int ncid, int varid, size_t bufsize, nciter_t **iterpp);
 
+/* Get iterator over variable data in blocks of the given shape,
+ * rather than in chunks or rows.  Returns pointer to malloc'd
+ * nciter_t, which caller must later release using nc_free_iter(). */
+extern int
+nc_get_block_iter(int ncid, int varid, const size_t *blocksizes,
+		  nciter_t **iterpp);
+
 /* Iterate over blocks of variable values, using start and count
  * vectors.  Returns number of values to access (product of counts),
  * or 0 if done. */
@@ -0,0 +1,201 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Plan copying of variables between chunk shapes, for nccopy -c
+ * with a memory budget (-M). */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+#include "utils.h"
+#include "rechunk.h"
+
+/* Cost in bytes of accessing a chunk, beyond reading or writing its
+ * values, such as for a disk seek and the chunk index.  Keeps plans
+ * away from intermediate chunks that are too small to be efficient. */
+#define CHUNK_OVERHEAD 4096
+
+static size_t
+gcd(size_t a, size_t b) {
+    while(b != 0) {
+	size_t t = a % b;
+	a = b;
+	b = t;
+    }
+    return a;
+}
+
+/* Along one dimension, number of values read from chunks of length
+ * chunk for each value in a block of length block, when blocks start
+ * at multiples of block and chunks aren't cached between blocks.  It
+ * is 1 if blocks are multiples of chunks. */
+static double
+overlap(size_t block, size_t chunk) {
+    return (double)(block + chunk - gcd(block, chunk)) / block;
+}
+
+/* Number of values read from chunks of shape chunks for each value
+ * copied in blocks of shape blocks */
+static double
+amplification(int rank, const size_t *blocks, const size_t *chunks) {
+    double amp = 1.0;
+    int d;
+    for(d = 0; d < rank; d++)
+	amp *= overlap(blocks[d], chunks[d]);
+    return amp;
+}
+
+/* Cost, per byte of the variable, of a pass that reads chunks of
+ * shape ichunks in blocks of shape blocks and writes them to chunks of
+ * shape ochunks, which blocks are aligned with */
+static double
+pass_cost(int rank, size_t value_size, const size_t *blocks,
+	  const size_t *ichunks, const size_t *ochunks) {
+    double ibytes = value_size, obytes = value_size;
+    int d;
+    for(d = 0; d < rank; d++) {
+	ibytes *= ichunks[d];
+	obytes *= ochunks[d];
+    }
+    return amplification(rank, blocks, ichunks) * (1.0 + CHUNK_OVERHEAD / ibytes)
+	+ 1.0 + CHUNK_OVERHEAD / obytes;
+}
+
+/* Grow block, starting from base and keeping each of its lengths a
+ * multiple of the base length (or the whole dimension), until it won't
+ * fit in budget bytes.  At each step, grow the dimension along which
+ * block overlaps chunks of shape target worst, to the next length
+ * that is also a multiple of target, so blocks get aligned with target
+ * chunks first and only then get bigger. */
+static void
+grow_block(int rank, const size_t *dims, size_t value_size,
+	   const size_t *base, const size_t *target, size_t budget,
+	   size_t *block) {
+    int *full = (int *) emalloc((rank + 1) * sizeof(int));
+    size_t bytes = value_size;
+    int d;
+
+    for(d = 0; d < rank; d++) {
+	block[d] = base[d];
+	bytes *= block[d];
+	full[d] = (block[d] >= dims[d]);
+    }
+    for(;;) {
+	int best = -1;
+	double worst = 0;
+	size_t room, next;
+	for(d = 0; d < rank; d++) {
+	    double amp;
+	    if(full[d])
+		continue;
+	    amp = overlap(block[d], target[d]);
+	    if(best == -1 || amp >= worst) { /* ties go to later dimensions */
+		best = d;
+		worst = amp;
+	    }
+	}
+	if(best == -1)
+	    break;
+	/* longest length along best that fits in the budget */
+	room = budget / (bytes / block[best]);
+	room = room / base[best] * base[best];
+	if(room > dims[best])
+	    room = dims[best];
+	if(worst > 1.0) {
+	    size_t lcm = base[best] / gcd(base[best], target[best]) * target[best];
+	    next = (block[best] / lcm + 1) * lcm;
+	    if(next > dims[best])
+		next = dims[best];
+	    if(next > room) {
+		next = room;
+		full[best] = 1;
+	    }
+	} else {
+	    next = room;
+	    full[best] = 1;
+	}
+	if(next <= block[best]) {
+	    full[best] = 1;
+	    continue;
+	}
+	bytes = bytes / block[best] * next;
+	block[best] = next;
+	if(next >= dims[best])
+	    full[best] = 1;
+    }
+    free(full);
+}
+
+int
+rechunk_plan(int rank, const size_t *dims, size_t value_size,
+	     const size_t *ichunks, const size_t *ochunks, size_t budget,
+	     rechunk_plan_t **planpp) {
+    rechunk_plan_t *planp;
+    size_t *ic, *oc, *rb, *wb, *mc;
+    double onepass, twopass;
+    int d;
+
+    planp = (rechunk_plan_t *) emalloc(sizeof(rechunk_plan_t));
+    ic = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    oc = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    rb = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    wb = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    mc = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    for(d = 0; d < rank; d++) {
+	ic[d] = ichunks[d] < dims[d] ? ichunks[d] : dims[d];
+	oc[d] = ochunks[d] < dims[d] ? ochunks[d] : dims[d];
+	if(ic[d] == 0)
+	    ic[d] = 1;
+	if(oc[d] == 0)
+	    oc[d] = 1;
+    }
+
+    /* One pass: write whole output chunks, reading whatever input
+     * chunks they overlap */
+    grow_block(rank, dims, value_size, oc, ic, budget, wb);
+    onepass = pass_cost(rank, value_size, wb, ic, oc);
+
+    /* Two passes: read whole input chunks into a scratch variable
+     * whose chunks the blocks of both passes line up with */
+    grow_block(rank, dims, value_size, ic, wb, budget, rb);
+    for(d = 0; d < rank; d++) {
+	mc[d] = rb[d] < wb[d] ? rb[d] : wb[d];
+	/* first pass must write whole scratch chunks too */
+	if(rb[d] > wb[d] && rb[d] < dims[d])
+	    rb[d] = rb[d] / wb[d] * wb[d];
+    }
+    twopass = pass_cost(rank, value_size, rb, ic, mc)
+	+ pass_cost(rank, value_size, wb, mc, oc);
+
+    planp->rank = rank;
+    if(twopass < onepass) {
+	planp->npasses = 2;
+	planp->readblock = rb;
+	planp->scratchchunks = mc;
+	planp->writeblock = wb;
+    } else {
+	planp->npasses = 1;
+	planp->readblock = wb;
+	planp->scratchchunks = NULL;
+	planp->writeblock = NULL;
+	free(rb);
+	free(mc);
+    }
+    free(ic);
+    free(oc);
+    *planpp = planp;
+    return NC_NOERR;
+}
+
+void
+rechunk_free_plan(rechunk_plan_t *planp) {
+    if(planp->npasses == 2) {
+	free(planp->scratchchunks);
+	free(planp->writeblock);
+    }
+    free(planp->readblock);
+    free(planp);
+}
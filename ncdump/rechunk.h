@@ -0,0 +1,41 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+#ifndef _RECHUNK_H_
+#define _RECHUNK_H_
+
+/*
+ * A plan for copying a variable from one chunk shape to another
+ * without holding more than a memory budget of values at once.  With
+ * one pass, the variable is copied in blocks that are multiples of
+ * the output chunk shape.  With two passes, the variable is first
+ * copied in blocks that are multiples of the input chunk shape to a
+ * scratch variable with intermediate chunks, then from the scratch
+ * variable in blocks that are multiples of the output chunk shape.
+ * Either way, every write covers whole chunks, so no output chunk has
+ * to wait in the chunk cache for the rest of its values.
+ */
+typedef struct {
+    int rank;
+    int npasses;		/* 1 or 2 */
+    size_t *readblock;		/* block shape for the first pass */
+    size_t *scratchchunks;	/* chunk shape of scratch variable, for 2 passes */
+    size_t *writeblock;		/* block shape for the second pass, for 2 passes */
+} rechunk_plan_t;
+
+/* Make a plan for copying a variable of shape dims, with values of
+ * value_size bytes, from chunks of shape ichunks to chunks of shape
+ * ochunks, with blocks of at most budget bytes when possible.  Blocks
+ * are never smaller than the chunks they are aligned with.  Caller
+ * must release the plan with rechunk_free_plan(). */
+extern int
+rechunk_plan(int rank, const size_t *dims, size_t value_size,
+	     const size_t *ichunks, const size_t *ochunks, size_t budget,
+	     rechunk_plan_t **planpp);
+
+/* Release memory allocated for a plan */
+extern void
+rechunk_free_plan(rechunk_plan_t *planp);
+
+#endif	/* _RECHUNK_H_  */
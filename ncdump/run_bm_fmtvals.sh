@@ -0,0 +1,21 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi 
+. ../test_common.sh
+
+# This shell script times ncdump on a 1 GB file of float values, which
+# mostly measures how fast ncdump formats values.
+
+set -e
+echo ""
+echo "*** Benchmarking ncdump on 1 GB of floats"
+
+NVALS=${NVALS-268435456}
+rm -f bm_fmtvals.nc
+${execdir}/tst_fmtvals -b $NVALS
+start=`date +%s`
+${NCDUMP} bm_fmtvals.nc > /dev/null
+end=`date +%s`
+echo "*** ncdump took `expr $end - $start` seconds"
+rm -f bm_fmtvals.nc
+exit 0
@@ -12,9 +12,12 @@ set -e
 
 echo ""
 
-rm -f utf8.nc utf8.cdl
+# Use names of our own, rather than replacing the utf8.nc that
+# run_utf8_tests.sh leaves for other tests with a netCDF-4 file
+rm -f utf8_4.nc utf8_4.cdl
 echo "*** creating enhanced file with utf8 characters..."
-${NCGEN} -4 -b -o utf8.nc ${srcdir}/ref_tst_utf8_4.cdl
+${NCGEN} -4 -b -o utf8_4.nc ${srcdir}/ref_tst_utf8_4.cdl
 echo "*** dump and compare utf8 output..."
-${NCDUMP} utf8.nc > utf8.cdl
-diff -b -w utf8.cdl ${srcdir}/ref_tst_utf8_4.cdl
+${NCDUMP} -n utf8 utf8_4.nc > utf8_4.cdl
+diff -b -w utf8_4.cdl ${srcdir}/ref_tst_utf8_4.cdl
+rm -f utf8_4.nc utf8_4.cdl
@@ -0,0 +1,144 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Hyperslabs of variables selected with ncdump -v "var[...]". */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <netcdf.h>
+#include "utils.h"
+#include "slabspec.h"
+
+char **
+slabspec_split(int nlvars, char **lvars) {
+    char **lslabs = (char **) emalloc((nlvars + 1) * sizeof(char *));
+    int iv;
+    for(iv = 0; iv < nlvars; iv++) {
+	char *name = lvars[iv];
+	size_t len = strlen(name);
+	char *open = strchr(name, '[');
+	lslabs[iv] = NULL;
+	if(open == NULL || len == 0 || name[len - 1] != ']')
+	    continue;
+	name[len - 1] = '\0';
+	lslabs[iv] = strdup(open + 1);
+	*open = '\0';
+    }
+    return lslabs;
+}
+
+/* Parse an optionally signed integer from the text between cp and
+ * end, ignoring blanks.  Returns 1 and sets *valp if there is one, 0
+ * if there is nothing but blanks, or -1 if there is anything else. */
+static int
+parse_index(const char *cp, const char *end, long long *valp) {
+    char *ep;
+    while(cp < end && isspace((unsigned char)*cp))
+	cp++;
+    while(end > cp && isspace((unsigned char)end[-1]))
+	end--;
+    if(cp == end)
+	return 0;
+    *valp = strtoll(cp, &ep, 10);
+    return ep == end ? 1 : -1;
+}
+
+/* Parse one dimension's entry, between cp and end, for a dimension of
+ * length len */
+static int
+parse_dim(const char *cp, const char *end, size_t len,
+	  size_t *startp, size_t *countp, ptrdiff_t *stridep) {
+    const char *fields[4];	/* starts of up to 3 fields, then end */
+    long long vals[3];
+    int has[3];
+    int nfields = 1;
+    long long first, stop, step;
+    int i;
+
+    fields[0] = cp;
+    for(; cp < end; cp++) {
+	if(*cp == ':') {
+	    if(nfields == 3)
+		return NC_EINVAL;
+	    fields[nfields++] = cp + 1;
+	}
+    }
+    fields[nfields] = end + 1;
+    for(i = 0; i < nfields; i++) {
+	has[i] = parse_index(fields[i], fields[i + 1] - 1, &vals[i]);
+	if(has[i] < 0)
+	    return NC_EINVAL;
+    }
+    if(nfields == 1 && !has[0]) { /* empty, for the whole dimension */
+	*startp = 0;
+	*countp = len;
+	*stridep = 1;
+	return NC_NOERR;
+    }
+    if(nfields == 1) {		/* a single index */
+	first = vals[0] < 0 ? vals[0] + (long long)len : vals[0];
+	if(first < 0 || first >= (long long)len)
+	    return NC_EINVALCOORDS;
+	*startp = (size_t)first;
+	*countp = 1;
+	*stridep = 1;
+	return NC_NOERR;
+    }
+    /* start:stop:step, with stop excluded and negative indices counting
+     * back from the end */
+    step = nfields == 3 && has[2] ? vals[2] : 1;
+    if(step < 1)
+	return NC_EINVAL;
+    first = nfields > 1 && has[0] ? vals[0] : 0;
+    stop = nfields > 1 && has[1] ? vals[1] : (long long)len;
+    if(first < 0)
+	first += (long long)len;
+    if(stop < 0)
+	stop += (long long)len;
+    if(stop > (long long)len)
+	stop = (long long)len;
+    if(first < 0 || first >= (long long)len)
+	return NC_EINVALCOORDS;
+    if(stop <= first)
+	return NC_EINVAL;
+    *startp = (size_t)first;
+    *countp = (size_t)((stop - first + step - 1) / step);
+    *stridep = (ptrdiff_t)step;
+    return NC_NOERR;
+}
+
+int
+slabspec_parse(const char *spec, int rank, const size_t *dims,
+	       size_t *start, size_t *count, ptrdiff_t *stride) {
+    const char *cp = spec;
+    int d;
+
+    for(d = 0; d < rank; d++) {
+	start[d] = 0;
+	count[d] = dims[d];
+	stride[d] = 1;
+    }
+    if(rank == 0) {
+	long long val;
+	return parse_index(spec, spec + strlen(spec), &val) == 0 ? NC_NOERR : NC_EINVAL;
+    }
+    for(d = 0; ; d++) {
+	const char *end = strchr(cp, ',');
+	int ret;
+	if(end == NULL)
+	    end = cp + strlen(cp);
+	if(d == rank)
+	    return NC_EINVAL;	/* more entries than dimensions */
+	ret = parse_dim(cp, end, dims[d], &start[d], &count[d], &stride[d]);
+	if(ret != NC_NOERR)
+	    return ret;
+	if(*end == '\0')
+	    break;
+	cp = end + 1;
+    }
+    return NC_NOERR;
+}
@@ -0,0 +1,28 @@
+/*********************************************************************
+ *   Copyright 2016, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+#ifndef _SLABSPEC_H_
+#define _SLABSPEC_H_
+
+#include <stddef.h>
+
+/* Split each name in the list lvars (of length nlvars) that ends with
+ * a hyperslab, as in "var[0:10,100:200:2,:]", into the variable name,
+ * by truncating it in place, and the hyperslab spec between the
+ * brackets.  Returns a list of nlvars specs, with NULL for names that
+ * have none. */
+extern char **
+slabspec_split(int nlvars, char **lvars);
+
+/* Parse hyperslab spec, a comma-separated list with one
+ * "start:stop:stride" or "index" entry for each of the leading
+ * dimensions of a variable of shape dims, into the start, count, and
+ * stride of the values it selects.  Returns NC_NOERR, NC_EINVAL if
+ * spec is malformed or selects no values, or NC_EINVALCOORDS if an
+ * index is out of range. */
+extern int
+slabspec_parse(const char *spec, int rank, const size_t *dims,
+	       size_t *start, size_t *count, ptrdiff_t *stride);
+
+#endif	/* _SLABSPEC_H_  */
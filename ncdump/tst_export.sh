@@ -0,0 +1,57 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi 
+. ../test_common.sh
+
+# This shell script checks ncdump -E, which exports variable data as
+# raw binary, NumPy .npy arrays, or CSV instead of CDL.
+
+set -e
+echo ""
+echo "*** Testing ncdump export of variable data"
+
+rm -f tst_export.nc tst_export.raw tst_export.npy tst_export.csv tst_export.txt
+${NCGEN} -b -o tst_export.nc $srcdir/ref_tst_export.cdl
+
+echo "*** checking -E raw writes little-endian values..."
+${NCDUMP} -E raw -v t tst_export.nc > tst_export.raw
+od -An -v -t x1 tst_export.raw | tr -s ' \n' '  ' > tst_export.txt
+printf " 01 00 fe ff 03 00 90 01 f4 01 a8 fd " | cmp - tst_export.txt
+
+echo "*** checking -E npy writes an aligned header and the same values..."
+${NCDUMP} -E npy -v t tst_export.nc > tst_export.npy
+test `wc -c < tst_export.npy` -eq 140
+grep "{'descr': '<i2', 'fortran_order': False, 'shape': (2, 3), }" tst_export.npy > /dev/null
+tail -c 12 tst_export.npy | cmp - tst_export.raw
+
+echo "*** checking -E csv writes a row for each value..."
+${NCDUMP} -E csv -v t,c,d tst_export.nc > tst_export.csv
+cat > tst_export.txt <<'EOF2'
+time,x,t
+0,0,1
+0,1,-2
+0,2,3
+1,0,400
+1,1,500
+1,2,-600
+
+n,c
+0,a
+1,""""
+2,","
+3,b
+
+d
+0.10000000000000001
+EOF2
+diff tst_export.txt tst_export.csv
+
+echo "*** checking -E without -v fails..."
+if ${NCDUMP} -E csv tst_export.nc > /dev/null 2>&1 ; then
+    echo "*** FAIL: ncdump -E without -v succeeded"
+    exit 1
+fi
+echo "*** All ncdump export tests passed!"
+
+rm -f tst_export.nc tst_export.raw tst_export.npy tst_export.csv tst_export.txt
+exit 0
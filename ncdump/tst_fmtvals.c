@@ -0,0 +1,205 @@
+/* This is part of the netCDF package.
+   Copyright 2016 University Corporation for Atmospheric Research/Unidata.
+   See COPYRIGHT file for conditions of use.
+
+   Write a file of values of each primitive numeric type, spread over
+   many magnitudes, and a list of those values printed with printf()
+   in ncdump's default formats, so tst_fmtvals.sh can check that
+   ncdump's own formatting of the values is the same.
+
+   With "-b nvals", instead write a file with one float variable of
+   nvals values, for run_bm_fmtvals.sh to time ncdump on.
+*/
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <netcdf.h>
+
+#define FILE_NAME "tst_fmtvals.nc"
+#define VALS_NAME "tst_fmtvals.txt"
+#define BM_FILE_NAME "bm_fmtvals.nc"
+#define DIM_NAME "n"
+#define NVALS 20000
+#define BM_CHUNK (1024 * 1024)	/* values written at a time for -b */
+
+/* Same as ncdump's default formats */
+#define FLT_FMT "%.7g"
+#define DBL_FMT "%.15g"
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* xorshift, so the values are the same everywhere */
+static unsigned long long
+next_rand(void) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return seed;
+}
+
+/* A value with a random 17-digit mantissa and sign, and a decimal
+ * exponent in [-maxexp, maxexp], or one of the values that exercise
+ * rounding and the switch between fixed and exponential notation */
+static double
+rand_value(int i, int maxexp) {
+    static const double special[] = {
+	0.0, -0.0, 1.0, -1.0, 0.5, 0.1, 1e-4, 1e-5, 9.9999995e-5,
+	123456.75, 1234567.5, 9999999.5, 99999995, 1e7, 1e15, 1e16,
+	999999999999999.5, 0.30000000000000004, 5e-324, 1.17549435e-38,
+	3.40282347e+38, 1.7976931348623157e+308, 2.2250738585072014e-308
+    };
+    const int nspecial = sizeof(special) / sizeof(special[0]);
+    double mant;
+    int exp;
+    if(i < nspecial)
+	return special[i];
+    mant = 1.0 + (double)(next_rand() % 900000000000000000ULL) / 1e17;
+    exp = (int)(next_rand() % (unsigned)(2 * maxexp + 1)) - maxexp;
+    if(next_rand() % 4 == 0)	/* short decimals, for exact fixed notation */
+	mant = floor(mant * 1000.0) / 1000.0;
+    return (next_rand() % 2 ? -mant : mant) * pow(10.0, exp);
+}
+
+static int
+write_bm_file(size_t nvals) {
+    int ncid, dimid, varid;
+    float *vals;
+    size_t start, count, i;
+
+    if (nc_create(BM_FILE_NAME, NC_CLOBBER|NC_64BIT_OFFSET, &ncid)) ERR;
+    if (nc_def_dim(ncid, DIM_NAME, nvals, &dimid)) ERR;
+    if (nc_def_var(ncid, "f", NC_FLOAT, 1, &dimid, &varid)) ERR;
+    if (nc_set_fill(ncid, NC_NOFILL, NULL)) ERR;
+    if (nc_enddef(ncid)) ERR;
+    if (!(vals = malloc(BM_CHUNK * sizeof(float)))) ERR;
+    for (start = 0; start < nvals; start += count) {
+	count = nvals - start < BM_CHUNK ? nvals - start : BM_CHUNK;
+	for (i = 0; i < count; i++)
+	    vals[i] = (float)rand_value(NVALS, 30);
+	if (nc_put_vara_float(ncid, varid, &start, &count, vals)) ERR;
+    }
+    free(vals);
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, dimid, varid;
+    FILE *fp;
+    int i;
+    int cmode = NC_CLOBBER;
+    static signed char bvals[NVALS];
+    static short svals[NVALS];
+    static int ivals[NVALS];
+    static float fvals[NVALS];
+    static double dvals[NVALS];
+#ifdef USE_NETCDF4
+    static unsigned char ubvals[NVALS];
+    static unsigned short usvals[NVALS];
+    static unsigned int uivals[NVALS];
+    static long long i64vals[NVALS];
+    static unsigned long long u64vals[NVALS];
+#endif
+
+    if (argc == 3 && strcmp(argv[1], "-b") == 0) {
+	printf("\n*** Writing %s for benchmarking...", BM_FILE_NAME);
+	if (write_bm_file((size_t)strtoull(argv[2], NULL, 10))) ERR;
+	SUMMARIZE_ERR;
+	FINAL_RESULTS;
+    }
+
+    printf("\n*** Writing values of each numeric type...");
+    for (i = 0; i < NVALS; i++) {
+	unsigned long long r = next_rand();
+	bvals[i] = (signed char)r;
+	svals[i] = (short)(r >> 8);
+	ivals[i] = (int)(r >> 24);
+	fvals[i] = (float)rand_value(i, 37);
+	if (isinf(fvals[i]))	/* ncdump prints these as Infinityf */
+	    fvals[i] = fvals[i] > 0 ? FLT_MAX : -FLT_MAX;
+	dvals[i] = rand_value(i, 307);
+#ifdef USE_NETCDF4
+	ubvals[i] = (unsigned char)r;
+	usvals[i] = (unsigned short)(r >> 8);
+	uivals[i] = (unsigned int)(r >> 24);
+	u64vals[i] = r;
+	i64vals[i] = (long long)(r >> (r % 64));
+	if (r % 2)
+	    i64vals[i] = -i64vals[i];
+#endif
+    }
+    /* ncdump prints default fill values as _ */
+    for (i = 0; i < NVALS; i++) {
+	if (svals[i] == NC_FILL_SHORT) svals[i] = 0;
+	if (ivals[i] == NC_FILL_INT) ivals[i] = 0;
+#ifdef USE_NETCDF4
+	if (ubvals[i] == NC_FILL_UBYTE) ubvals[i] = 0;
+	if (usvals[i] == NC_FILL_USHORT) usvals[i] = 0;
+	if (uivals[i] == NC_FILL_UINT) uivals[i] = 0;
+	if (i64vals[i] == NC_FILL_INT64) i64vals[i] = 0;
+	if (u64vals[i] == NC_FILL_UINT64) u64vals[i] = 0;
+#endif
+    }
+    bvals[0] = -128;
+    svals[0] = -32768;
+    ivals[0] = NC_MIN_INT;
+    ivals[1] = NC_MAX_INT;
+#ifdef USE_NETCDF4
+    cmode |= NC_NETCDF4;
+    u64vals[0] = NC_MAX_UINT64;
+    u64vals[1] = 0;
+    i64vals[0] = NC_MIN_INT64;
+    i64vals[1] = NC_MAX_INT64;
+#endif
+
+    if (nc_create(FILE_NAME, cmode, &ncid)) ERR;
+    if (nc_def_dim(ncid, DIM_NAME, NVALS, &dimid)) ERR;
+    if (nc_def_var(ncid, "b", NC_BYTE, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_schar(ncid, varid, bvals)) ERR;
+    if (nc_def_var(ncid, "s", NC_SHORT, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_short(ncid, varid, svals)) ERR;
+    if (nc_def_var(ncid, "i", NC_INT, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_int(ncid, varid, ivals)) ERR;
+    if (nc_def_var(ncid, "f", NC_FLOAT, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_float(ncid, varid, fvals)) ERR;
+    if (nc_def_var(ncid, "d", NC_DOUBLE, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_double(ncid, varid, dvals)) ERR;
+#ifdef USE_NETCDF4
+    if (nc_def_var(ncid, "ub", NC_UBYTE, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_uchar(ncid, varid, ubvals)) ERR;
+    if (nc_def_var(ncid, "us", NC_USHORT, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_ushort(ncid, varid, usvals)) ERR;
+    if (nc_def_var(ncid, "ui", NC_UINT, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_uint(ncid, varid, uivals)) ERR;
+    if (nc_def_var(ncid, "i64", NC_INT64, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_longlong(ncid, varid, i64vals)) ERR;
+    if (nc_def_var(ncid, "u64", NC_UINT64, 1, &dimid, &varid)) ERR;
+    if (nc_put_var_ulonglong(ncid, varid, u64vals)) ERR;
+#endif
+    if (nc_close(ncid)) ERR;
+    SUMMARIZE_ERR;
+
+    printf("\n*** Writing the values as printed by printf...");
+    if (!(fp = fopen(VALS_NAME, "w"))) ERR;
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%d\n", bvals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%d\n", svals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%d\n", ivals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, FLT_FMT "\n", fvals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, DBL_FMT "\n", dvals[i]);
+#ifdef USE_NETCDF4
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%u\n", ubvals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%u\n", usvals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%u\n", uivals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%lld\n", i64vals[i]);
+    for (i = 0; i < NVALS; i++) fprintf(fp, "%llu\n", u64vals[i]);
+#endif
+    if (fclose(fp)) ERR;
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
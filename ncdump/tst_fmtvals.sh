@@ -0,0 +1,40 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi 
+. ../test_common.sh
+
+# This shell script checks that ncdump formats values of each numeric
+# type the same as printf does with ncdump's default formats.
+
+set -e
+echo ""
+echo "*** Testing ncdump formatting of numeric values"
+
+rm -f tst_fmtvals.nc tst_fmtvals.txt tst_fmtvals.dmp tst_fmtvals_j.dmp
+${execdir}/tst_fmtvals
+
+# One value per line, from the data section
+${NCDUMP} tst_fmtvals.nc | awk '
+/^data:/ { indata = 1; next }
+indata && $0 != "}" {
+    sub(/^ *[A-Za-z_][A-Za-z_0-9]* = /, "")
+    n = split($0, vals, /[,;]/)
+    for (i = 1; i <= n; i++) {
+	gsub(/ /, "", vals[i])
+	if (vals[i] != "") print vals[i]
+    }
+}' > tst_fmtvals.dmp
+diff -b tst_fmtvals.txt tst_fmtvals.dmp
+
+# Formatting with threads (-j) shouldn't change the output
+if ${NCDUMP} -j 2 -h tst_fmtvals.nc > /dev/null 2>&1 ; then
+    for opts in "" "-b c" "-f f -l 40" ; do
+	${NCDUMP} $opts tst_fmtvals.nc > tst_fmtvals.dmp
+	${NCDUMP} -j 4 $opts tst_fmtvals.nc > tst_fmtvals_j.dmp
+	cmp tst_fmtvals.dmp tst_fmtvals_j.dmp
+    done
+fi
+echo "*** All ncdump formatting of numeric values tests passed!"
+
+rm -f tst_fmtvals.nc tst_fmtvals.txt tst_fmtvals.dmp tst_fmtvals_j.dmp
+exit 0
@@ -0,0 +1,92 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi 
+. ../test_common.sh
+
+# This shell script checks that ncdump -v "var[start:stop:stride,...]"
+# dumps or exports just that hyperslab of var, annotated with indices
+# in the whole variable.
+
+set -e
+echo ""
+echo "*** Testing ncdump of hyperslabs"
+
+rm -f tst_hyperslab.nc tst_hyperslab.dmp tst_hyperslab.txt
+${NCGEN} -b -o tst_hyperslab.nc $srcdir/ref_tst_hyperslab.cdl
+
+echo "*** checking hyperslabs with brief annotations..."
+${NCDUMP} -b c -v 'v[1:3,0:5:2,-2:],s[1,2:5],sc' tst_hyperslab.nc \
+    | sed -n '/^data:/,$p' > tst_hyperslab.dmp
+cat > tst_hyperslab.txt <<'EOF2'
+data:
+
+ v =
+  // v(1,0, 5-6)
+    40, 41,
+  // v(1,2, 5-6)
+    54, 55,
+  // v(1,4, 5-6)
+    68, 69,
+  // v(2,0, 5-6)
+    75, 76,
+  // v(2,2, 5-6)
+    89, 90,
+  // v(2,4, 5-6)
+    103, 104 ;
+
+ s =
+  // s(1, 2-4)
+    "jkl" ;
+
+ sc = 3.5 ;
+}
+EOF2
+diff tst_hyperslab.txt tst_hyperslab.dmp
+
+echo "*** checking empty names in the list are skipped..."
+${NCDUMP} -b c -v ',v[1:3,0:5:2,-2:],,s[1,2:5],sc,' tst_hyperslab.nc \
+    | sed -n '/^data:/,$p' > tst_hyperslab.dmp
+diff tst_hyperslab.txt tst_hyperslab.dmp
+
+echo "*** checking a strided row with full Fortran annotations..."
+${NCDUMP} -f f -v 'v[2,4,::3]' tst_hyperslab.nc \
+    | sed -n '/^data:/,$p' > tst_hyperslab.dmp
+cat > tst_hyperslab.txt <<'EOF2'
+data:
+
+ v =
+  98,   // v(1,5,3)
+    101,   // v(4,5,3)
+    104;  // v(7,5,3)
+    }
+EOF2
+diff tst_hyperslab.txt tst_hyperslab.dmp
+
+echo "*** checking export of a hyperslab..."
+${NCDUMP} -E csv -v 'v[:,1:4:2,6]' tst_hyperslab.nc > tst_hyperslab.dmp
+cat > tst_hyperslab.txt <<'EOF2'
+t,x,y,v
+0,1,6,13
+0,3,6,27
+1,1,6,48
+1,3,6,62
+2,1,6,83
+2,3,6,97
+EOF2
+diff tst_hyperslab.txt tst_hyperslab.dmp
+
+echo "*** checking invalid hyperslabs fail..."
+for slab in 'v[3]' 'v[0,0,0,0]' 'v[1:1]' 'v[0:2:0]' 'v[a]' 'sc[1]' ; do
+    if ${NCDUMP} -v "$slab" tst_hyperslab.nc > /dev/null 2>&1 ; then
+	echo "*** FAIL: ncdump -v $slab succeeded"
+	exit 1
+    fi
+done
+if ${NCDUMP} -x -v 'v[1:3]' tst_hyperslab.nc > /dev/null 2>&1 ; then
+    echo "*** FAIL: ncdump -x -v with a hyperslab succeeded"
+    exit 1
+fi
+echo "*** All ncdump hyperslab tests passed!"
+
+rm -f tst_hyperslab.nc tst_hyperslab.dmp tst_hyperslab.txt
+exit 0
@@ -20,6 +20,82 @@ for i in $TESTFILES ; do
     diff copy_of_$i.cdl tmp.cdl
     rm copy_of_$i.nc copy_of_$i.cdl tmp.cdl
 done
+echo "*** Testing nccopy -j output is the same as serial copy"
+# Giving -m copies through the API rather than as bytes.
+for i in $TESTFILES ; do
+    ${NCCOPY} -m 1k $i.nc copy_of_$i.nc
+    ${NCCOPY} -m 1k -j 4 $i.nc pipelined_$i.nc
+    cmp copy_of_$i.nc pipelined_$i.nc
+    rm copy_of_$i.nc pipelined_$i.nc
+done
+echo "*** Testing nccopy -w -j output is the same as serial copy"
+# fixed size variables go through the reader thread in several slabs
+cat > tst_pipelined.cdl <<EOF
+netcdf tst_pipelined {
+dimensions:
+	t = UNLIMITED ;
+	x = 10 ;
+	y = 8 ;
+variables:
+	int a(x, y) ;
+	double b(y) ;
+	short r(t, x) ;
+data:
+ a = `seq -s ', ' 0 79` ;
+ b = `seq -s ', ' 1 8` ;
+ r = `seq -s ', ' 100 129` ;
+}
+EOF
+${NCGEN} -b tst_pipelined.cdl
+${NCCOPY} -w -m 64 tst_pipelined.nc copy_of_tst_pipelined.nc
+${NCCOPY} -w -m 64 -j 4 tst_pipelined.nc pipelined_tst_pipelined.nc
+cmp copy_of_tst_pipelined.nc pipelined_tst_pipelined.nc
+rm tst_pipelined.cdl tst_pipelined.nc copy_of_tst_pipelined.nc pipelined_tst_pipelined.nc
+echo "*** Testing nccopy output is the same for any number of records per batch"
+for i in $TESTFILES ; do
+    ${NCCOPY} -m 5M $i.nc copy_of_$i.nc
+    ${NCCOPY} -m 1 $i.nc onerec_$i.nc
+    cmp copy_of_$i.nc onerec_$i.nc
+    rm copy_of_$i.nc onerec_$i.nc
+done
+echo "*** Testing nccopy copies the same classic layout as bytes"
+# -w copies through the API into a diskless file.  The padding after
+# variables may differ from the bytes copied, so compare contents.
+for i in $TESTFILES ; do
+    ${NCCOPY} $i.nc raw_$i.nc
+    ${NCCOPY} -w $i.nc api_$i.nc
+    ${NCDUMP} -n copy_of_$i raw_$i.nc > raw_$i.cdl
+    ${NCDUMP} -n copy_of_$i api_$i.nc > api_$i.cdl
+    diff raw_$i.cdl api_$i.cdl
+    rm raw_$i.nc api_$i.nc raw_$i.cdl api_$i.cdl
+done
+echo "*** Testing nccopy of a no-fill file with its last record cut short"
+cat > tst_nofill_short.cdl <<EOF
+netcdf tst_nofill_short {
+dimensions:
+	t = UNLIMITED ;
+	x = 3 ;
+variables:
+	int a(x) ;
+	short r(t, x) ;
+	double s(t, x) ;
+data:
+ a = 1, 2, 3 ;
+ r = 1, 2, 3, 4, 5, 6 ;
+ s = 0.5, 1.5, 2.5, 3.5, 4.5, 5.5 ;
+}
+EOF
+${NCGEN} -b tst_nofill_short.cdl
+# drop the last two values of s, as if they were never written in
+# no-fill mode
+size=`wc -c < tst_nofill_short.nc`
+dd if=tst_nofill_short.nc of=tmp_short.nc bs=1 count=`expr $size - 16` 2> /dev/null
+${NCCOPY} tmp_short.nc raw_short.nc
+${NCCOPY} -w tmp_short.nc api_short.nc
+${NCDUMP} -n tst_nofill_short raw_short.nc > raw_short.cdl
+${NCDUMP} -n tst_nofill_short api_short.nc > api_short.cdl
+diff raw_short.cdl api_short.cdl
+rm tst_nofill_short.cdl tst_nofill_short.nc tmp_short.nc raw_short.nc api_short.nc raw_short.cdl api_short.cdl
 echo "*** Testing nccopy -u"
 ${NCGEN} -b $srcdir/tst_brecs.cdl
 # convert record dimension to fixed-size dimension
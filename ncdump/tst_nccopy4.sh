@@ -26,6 +26,38 @@ ${NCDUMP} copy_of_$i.nc > copy_of_$i.cdl
     diff copy_of_$i.cdl tmp.cdl
     rm copy_of_$i.nc copy_of_$i.cdl tmp.cdl
 done
+echo "*** Testing nccopy -j output is the same as serial copy"
+for i in $TESTFILES ; do
+    ${NCCOPY} -m 1k $i.nc copy_of_$i.nc
+    ${NCCOPY} -m 1k -j 4 $i.nc pipelined_$i.nc
+    ${NCDUMP} -n copy_of_$i copy_of_$i.nc > copy_of_$i.cdl
+    ${NCDUMP} -n copy_of_$i pipelined_$i.nc > tmp.cdl
+    diff copy_of_$i.cdl tmp.cdl
+    rm copy_of_$i.nc pipelined_$i.nc copy_of_$i.cdl tmp.cdl
+done
+echo "*** Testing nccopy -k nc6 -j output is the same as serial copy"
+# fixed size variables go through the reader thread in several slabs
+cat > tst_pipelined.cdl <<EOF
+netcdf tst_pipelined {
+dimensions:
+	t = UNLIMITED ;
+	x = 10 ;
+	y = 8 ;
+variables:
+	int a(x, y) ;
+	double b(y) ;
+	short r(t, x) ;
+data:
+ a = `seq -s ', ' 0 79` ;
+ b = `seq -s ', ' 1 8` ;
+ r = `seq -s ', ' 100 129` ;
+}
+EOF
+${NCGEN} -b tst_pipelined.cdl
+${NCCOPY} -k nc6 -m 64 tst_pipelined.nc copy_of_tst_pipelined.nc
+${NCCOPY} -k nc6 -m 64 -j 4 tst_pipelined.nc pipelined_tst_pipelined.nc
+cmp copy_of_tst_pipelined.nc pipelined_tst_pipelined.nc
+rm tst_pipelined.cdl tst_pipelined.nc copy_of_tst_pipelined.nc pipelined_tst_pipelined.nc
 # echo "*** Testing compression of deflatable files ..."
 ./tst_compress
 echo "*** Test nccopy -d1 can compress a classic format file ..."
@@ -87,6 +119,79 @@ ${NCGEN} -b -o tst_bug321.nc $srcdir/tst_bug321.cdl
 $NCCOPY -k nc7 -c"lat/2,lon/2" tst_bug321.nc tmp.nc
 ${NCDUMP} -n tst_bug321 tmp.nc > tmp.cdl
 diff $srcdir/tst_bug321.cdl tmp.cdl
+echo "*** Test that nccopy -c auto: chooses chunking for an access pattern"
+$NCCOPY -k nc7 -c auto:timeseries tst_bug321.nc tmp.nc
+${NCDUMP} -n tst_bug321 tmp.nc > tmp.cdl
+diff $srcdir/tst_bug321.cdl tmp.cdl
+${NCDUMP} -hs tmp.nc | fgrep 'pr:_ChunkSizes = 1024, 1, 1'
+$NCCOPY -k nc7 -c auto:slice tst_bug321.nc tmp.nc
+${NCDUMP} -hs tmp.nc | fgrep 'pr:_ChunkSizes = 1, 6, 4'
+echo "*** Test that nccopy -M rechunks whole chunks within a memory budget"
+awk 'BEGIN {
+    print "netcdf tst_rechunk {\ndimensions:\n\ttime = UNLIMITED ;\n\tlat = 30 ;\n\tlon = 40 ;"
+    print "variables:\n\tfloat t(time, lat, lon) ;\ndata:\n t ="
+    for (i = 0; i < 200*30*40; i++)
+        printf("%d%s\n", (i * 7) % 1000, i < 200*30*40 - 1 ? "," : " ;")
+    print "}"
+}' > tst_rechunk.cdl
+${NCGEN} -b -k nc4 -o tst_rechunk.nc tst_rechunk.cdl
+${NCDUMP} tst_rechunk.nc > tst_rechunk.cdl
+$NCCOPY -c time/200,lat/1,lon/1 tst_rechunk.nc tmp-chunked.nc
+# Many slabs, read ahead by a second thread
+$NCCOPY -m 10k -j 4 tmp-chunked.nc tmp.nc
+${NCDUMP} -n tst_rechunk tmp.nc > tmp.cdl
+diff tst_rechunk.cdl tmp.cdl
+# Small budgets take two passes through a scratch file, large ones one
+for budget in 20K 100K 10M ; do
+    $NCCOPY -M $budget -c time/1,lat/30,lon/40 tmp-chunked.nc tmp.nc
+    ${NCDUMP} -n tst_rechunk tmp.nc > tmp.cdl
+    diff tst_rechunk.cdl tmp.cdl
+    ${NCDUMP} -hs tmp.nc | fgrep 't:_ChunkSizes = 1, 30, 40'
+    test ! -f tmp.nc.rechunk
+done
+# The same chunks in and out are just copied a chunk at a time
+$NCCOPY -M 20K tmp.nc tmp-rechunk.nc
+${NCDUMP} -n tst_rechunk tmp-rechunk.nc > tmp.cdl
+diff tst_rechunk.cdl tmp.cdl
+${NCDUMP} -hs tmp-rechunk.nc | fgrep 't:_ChunkSizes = 1, 30, 40'
+test ! -f tmp-rechunk.nc.rechunk
+rm tst_rechunk.nc tst_rechunk.cdl tmp-rechunk.nc
+
+echo "*** Test that nccopy doesn't write chunks of only fill values"
+awk 'BEGIN {
+    print "netcdf tst_sparse {\ndimensions:\n\ttime = UNLIMITED ;\n\tlat = 40 ;\n\tlon = 40 ;"
+    print "variables:\n\tfloat t(time, lat, lon) ;\n\t\tt:_FillValue = -999.f ;"
+    print "\t\tt:_ChunkSizes = 1, 10, 10 ;\ndata:\n t ="
+    for (i = 0; i < 50*40*40; i++)
+        printf("%s%s\n", i < 3*40*40 && i % 1600 < 5*40 ? i % 97 : "_",
+               i < 50*40*40 - 1 ? "," : " ;")
+    print "}"
+}' > tst_sparse.cdl
+${NCGEN} -b -k nc4 -o tst_sparse.nc tst_sparse.cdl
+${NCDUMP} tst_sparse.nc > tst_sparse.cdl
+$NCCOPY -S tst_sparse.nc tmp.nc
+${NCDUMP} -n tst_sparse tmp.nc > tmp.cdl
+diff tst_sparse.cdl tmp.cdl
+if test `wc -c < tmp.nc` -ge `wc -c < tst_sparse.nc`; then
+    exit 1
+fi
+# chunks never written in the input are skipped too, keeping the unlimited
+# dimension length
+$NCCOPY -S tmp.nc tmp-chunked.nc
+${NCDUMP} -n tst_sparse tmp-chunked.nc > tmp.cdl
+diff tst_sparse.cdl tmp.cdl
+$NCCOPY -k nc3 tst_sparse.nc tmp-unchunked.nc
+$NCCOPY -S -k nc7 -c time/1,lat/10,lon/10 tmp-unchunked.nc tmp.nc
+${NCDUMP} -n tst_sparse tmp.nc > tmp.cdl
+diff tst_sparse.cdl tmp.cdl
+if test `wc -c < tmp.nc` -ge `wc -c < tmp-unchunked.nc`; then
+    exit 1
+fi
+# without -S, output variables stay in no-fill mode
+$NCCOPY -k nc7 -c time/1,lat/10,lon/10 tmp-unchunked.nc tmp.nc
+${NCDUMP} -s -h tmp.nc | grep '_NoFill = "true"' > /dev/null
+rm tst_sparse.nc tst_sparse.cdl
+
 # echo "*** Test that nccopy compression with chunking can improve compression"
 rm tst_chunking.nc tmp.nc tmp.cdl tmp-chunked.nc tmp-chunked.cdl tmp-unchunked.nc tmp-unchunked.cdl
 
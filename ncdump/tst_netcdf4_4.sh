@@ -98,6 +98,27 @@ else # Non-MINGW Platforms
     fi
 fi
 
+echo '*** testing ncdump of variables read in blocks of chunks...'
+awk 'BEGIN {
+    print "netcdf tst_blocks {";
+    print "dimensions:"; print "  t = UNLIMITED ; y = 12 ; x = 40 ;";
+    print "variables:"; print "  int a(t, y, x) ; short b(y, x) ; char c(t, x) ;";
+    print "data:";
+    printf "  a = "; for (i = 0; i < 5*12*40; i++) printf "%d%s", i, (i < 5*12*40-1 ? ", " : " ;\n");
+    printf "  b = "; for (i = 0; i < 12*40; i++) printf "%d%s", i % 97, (i < 12*40-1 ? ", " : " ;\n");
+    printf "  c = "; for (i = 0; i < 5; i++) printf "\"row %d\"%s", i, (i < 4 ? ", " : " ;\n");
+    print "}" }' > tst_blocks.cdl
+${NCGEN} -k nc3 -o tst_blocks.nc tst_blocks.cdl
+${NCDUMP} tst_blocks.nc > tst_blocks_nc3.cdl
+# the last block of records is short
+${NCCOPY} -k nc4 -c t/2,y/5,x/7 tst_blocks.nc tst_blocks4.nc
+${NCDUMP} -n tst_blocks tst_blocks4.nc > tst_blocks_nc4.cdl
+diff -b tst_blocks_nc3.cdl tst_blocks_nc4.cdl
+${NCCOPY} -k nc4 -c t/1,y/12,x/40 tst_blocks.nc tst_blocks4.nc
+${NCDUMP} -n tst_blocks tst_blocks4.nc > tst_blocks_nc4.cdl
+diff -b tst_blocks_nc3.cdl tst_blocks_nc4.cdl
+rm -f tst_blocks.cdl tst_blocks.nc tst_blocks4.nc tst_blocks_nc3.cdl tst_blocks_nc4.cdl
+
 echo "*** All ncgen and ncdump extra test output for netCDF-4 format passed!"
 exit 0
 
@@ -0,0 +1,58 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi 
+. ../test_common.sh
+
+# This shell script checks that ncgen -b writes the data it converts
+# while parsing (numeric variables with at most a leading unlimited
+# dimension) the same way as data kept in data lists, including fill
+# values, padding, runs of plain numbers read by the lexer's fast
+# path, and falling back for data it cannot convert early, with and
+# without worker threads (-j) converting the data kept in data lists.
+
+set -e
+echo ""
+echo "*** Testing ncgen -b with data converted while parsing"
+
+cat > tst_spool.txt <<'EOF2'
+data:
+
+ a =
+  1, _, _,
+  4, 5, 6,
+  _, _, _,
+  _, _, _,
+  _, _, _ ;
+
+ b = 1.5, 2, _ ;
+
+ c = 1, 2, 3, 4, 5 ;
+
+ d = 1, 0, _ ;
+
+ e =
+  10, 11, 12,
+  13, _, 15,
+  _, _, _,
+  _, _, _,
+  _, _, _ ;
+
+ f = 2, 3, 4 ;
+
+ g = 0.5, -0.0025, 7, 1.25, 9 ;
+}
+EOF2
+
+for threads in 1 4 ; do
+for buf in 4 12 1000000 ; do
+    echo "*** checking with $threads threads and a buffer of $buf bytes..."
+    rm -f tst_spool.nc tst_spool.dmp
+    ${NCGEN} -j $threads -B $buf -b -o tst_spool.nc $srcdir/ref_tst_spool.cdl
+    ${NCDUMP} tst_spool.nc | sed -n '/^data:/,$p' > tst_spool.dmp
+    diff -b tst_spool.txt tst_spool.dmp
+done
+done
+
+rm -f tst_spool.nc tst_spool.dmp tst_spool.txt
+echo "*** All ncgen -b data tests passed!"
+exit 0
@@ -523,21 +523,40 @@ make_lvars(char *optarg, int *nlvarsp, char ***lvarsp)
 {
     char *cp = optarg;
     int nvars = 1;
+    int depth = 0;		/* nesting of [] around cp */
     char ** cpp;
-
-    /* compute number of variable names in comma-delimited list */
-    *nlvarsp = 1;
-    while (*cp++)
-      if (*cp == ',')
- 	nvars++;
-    *nlvarsp = nvars;
+    char *np;
+
+    /* compute number of variable names in comma-delimited list,
+     * not counting commas within hyperslabs, as in "var[0:10,5]" */
+    for (cp = optarg; *cp; cp++) {
+      if (*cp == '[')
+	depth++;
+      else if (*cp == ']' && depth > 0)
+	depth--;
+      else if (*cp == ',' && depth == 0)
+	nvars++;
+    }
     *lvarsp = (char **) emalloc(nvars * sizeof(char*));
     cpp = *lvarsp;
     /* copy variable names into list */
-    for (cp = strtok(optarg, ","); cp != NULL; cp = strtok((char *) NULL, ",")) {
-	*cpp = strdup(cp);
-	cpp++;
+    depth = 0;
+    for (np = cp = optarg; ; cp++) {
+      if (*cp == '[')
+	depth++;
+      else if (*cp == ']' && depth > 0)
+	depth--;
+      else if ((*cp == ',' && depth == 0) || *cp == '\0') {
+	bool_t last = (*cp == '\0');
+	*cp = '\0';
+	if (*np != '\0')	/* skip empty names, as in "a,,b" */
+	  *cpp++ = strdup(np);
+	if (last)
+	  break;
+	np = cp + 1;
+      }
     }
+    *nlvarsp = (int)(cpp - *lvarsp);
 }
 
 void
@@ -10,6 +10,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 #include <netcdf.h>
 #include "utils.h"
 #include "nccomps.h"
@@ -29,6 +32,10 @@ extern fspec_t formatting_specs; /* set from command-line options */
   than this */
 #define VALBUFSIZ 10000
 
+/* Read rows of values in blocks of at most this many bytes, when more
+ * than one row fits */
+#define ROWBLOCKSIZ (8*1024*1024)
+
 static int linep;		/* line position, not counting global indent */
 static int max_line_len;	/* max chars per line, not counting global indent */
 
@@ -235,6 +242,54 @@ pr_any_att_vals(
     sbuf_free(sb);
 }
 
+/*
+ * Index in the variable of a value at index i along dimension d of
+ * the hyperslab being dumped
+ */
+static size_t
+slab_index(const ncvar_t *vp, int d, size_t i)
+{
+    if(vp->slab_start == NULL)
+	return i;
+    return vp->slab_start[d] + i * (size_t)vp->slab_stride[d];
+}
+
+/*
+ * Reads the values in the block with corner cor and shape edg of the
+ * hyperslab being dumped
+ */
+static void
+get_slab_vals(
+    int ncid,
+    int varid,
+    const ncvar_t *vp,
+    const size_t *cor,
+    const size_t *edg,
+    void *vals
+    )
+{
+    size_t *start;
+    bool_t strided = false;
+    int d;
+
+    if(vp->slab_start == NULL) {
+	NC_CHECK(nc_get_vara(ncid, varid, cor, edg, vals));
+	return;
+    }
+    start = (size_t *) emalloc((vp->ndims + 1) * sizeof(size_t));
+    for(d = 0; d < vp->ndims; d++) {
+	start[d] = slab_index(vp, d, cor[d]);
+	if(vp->slab_stride[d] != 1 && edg[d] > 1)
+	    strided = true;
+    }
+    if(strided) {
+	NC_CHECK(nc_get_vars(ncid, varid, start, edg, vp->slab_stride, vals));
+    } else {
+	NC_CHECK(nc_get_vara(ncid, varid, start, edg, vals));
+    }
+    free(start);
+}
+
 /*
  * Prints brief annotation for a row of data values
  */
@@ -247,6 +302,9 @@ annotate_brief(
 {
     int vrank = vp->ndims;
     int id;
+    /* indices of first and last values of row */
+    size_t first = slab_index(vp, vrank-1, 0);
+    size_t last = slab_index(vp, vrank-1, vdims[vrank-1]-1);
     printf ("// ");
     print_name(vp->name);
     printf("(");
@@ -255,20 +313,20 @@ annotate_brief(
     case LANG_C:
 	/* print brief comment with C variable indices */
 	for (id = 0; id < vrank-1; id++)
-	    printf("%lu,", (unsigned long)cor[id]);
+	    printf("%lu,", (unsigned long)slab_index(vp, id, cor[id]));
 	if (vdims[vrank-1] == 1)
-	    printf("0");
+	    printf("%lu", (unsigned long)first);
 	else
-	    printf(" 0-%lu", (unsigned long)vdims[vrank-1]-1);
+	    printf(" %lu-%lu", (unsigned long)first, (unsigned long)last);
 	break;
     case LANG_F:
 	/* print brief comment with Fortran variable indices */
 	if (vdims[vrank-1] == 1)
-	    printf("1");
+	    printf("%lu", (unsigned long)first + 1);
 	else
-	    printf("1-%lu ", (unsigned long)vdims[vrank-1]);
+	    printf("%lu-%lu ", (unsigned long)first + 1, (unsigned long)last + 1);
 	for (id = vrank-2; id >=0 ; id--) {
-	    printf(",%lu", (unsigned long)(1 + cor[id]));
+	    printf(",%lu", (unsigned long)(1 + slab_index(vp, id, cor[id])));
 	}
 	break;
     }
@@ -300,14 +358,14 @@ annotate(
       case LANG_C:
 	/* C variable indices */
 	for (id = 0; id < vrank-1; id++)
-	  printf("%lu,", (unsigned long) cor[id]);
-	printf("%lu", (unsigned long) cor[id] + iel);
+	  printf("%lu,", (unsigned long) slab_index(vp, id, cor[id]));
+	printf("%lu", (unsigned long) slab_index(vp, id, cor[id] + iel));
 	break;
       case LANG_F:
 	/* Fortran variable indices */
-	printf("%lu", (unsigned long) cor[vrank-1] + iel + 1);
+	printf("%lu", (unsigned long) slab_index(vp, vrank-1, cor[vrank-1] + iel) + 1);
 	for (id = vrank-2; id >=0 ; id--) {
-	    printf(",%lu", 1 + (unsigned long) cor[id]);
+	    printf(",%lu", 1 + (unsigned long) slab_index(vp, id, cor[id]));
 	}
 	break;
     }
@@ -409,6 +467,456 @@ upcorner(
     return ret;
 }
 
+/*
+ * Values of a block formatted ahead of printing by several threads,
+ * with -j.  Values are formatted a window at a time, as printing
+ * reaches them.  Each thread formats a slice of the window into its
+ * own buffer, then the values are printed from the buffers in order,
+ * with the same line wrapping and annotations as values formatted one
+ * at a time, so the output is the same either way.
+ */
+typedef struct fmtblock fmtblock_t;
+
+#ifdef HAVE_PTHREAD_H
+/* Fewest values in a block worth formatting with threads */
+#define MIN_THREADED_VALS 10000
+
+/* Most values formatted at a time */
+#define FMTWINDOW (1024*1024)
+
+/* The values one thread formats */
+typedef struct {
+    const ncvar_t *vp;
+    const char *vals;		/* first value of slice */
+    size_t nvals;
+    size_t *offs;		/* where each value's string starts in text */
+    char *text;			/* strings of values, each null terminated */
+    size_t textsize;		/* bytes allocated for text */
+} fmtslice_t;
+
+struct fmtblock {
+    const ncvar_t *vp;
+    int nthreads;
+    const char *block;		/* values of current block, or NULL */
+    size_t nblock;
+    const char *vals;		/* values formatted, or NULL if none */
+    size_t nvals;
+    size_t per;			/* values in each slice but the last */
+    size_t *offs;		/* offsets for all slices */
+    size_t maxvals;		/* values offs has room for */
+    fmtslice_t *slices;
+    pthread_t *threads;
+};
+
+/* Get a formatter for blocks of values of a variable, or NULL if its
+ * values should just be formatted as they are printed */
+static fmtblock_t *
+fmtblock_new(const ncvar_t *vp)
+{
+    fmtblock_t *fbp;
+    int nthreads = formatting_specs.nthreads;
+    int i;
+
+    /* only primitive types whose formatting is thread-safe */
+    if(nthreads < 2 || vp->type == NC_NAT || vp->type > NC_MAX_ATOMIC_TYPE
+       || vp->type == NC_CHAR || vp->type == NC_STRING
+       || (vp->has_timeval && formatting_specs.string_times))
+	return NULL;
+    fbp = (fmtblock_t *) emalloc(sizeof(fmtblock_t));
+    fbp->vp = vp;
+    fbp->nthreads = nthreads;
+    fbp->block = NULL;
+    fbp->nblock = 0;
+    fbp->vals = NULL;
+    fbp->nvals = 0;
+    fbp->per = 0;
+    fbp->offs = NULL;
+    fbp->maxvals = 0;
+    fbp->slices = (fmtslice_t *) emalloc(nthreads * sizeof(fmtslice_t));
+    fbp->threads = (pthread_t *) emalloc(nthreads * sizeof(pthread_t));
+    for(i = 0; i < nthreads; i++) {
+	fbp->slices[i].vp = vp;
+	fbp->slices[i].textsize = 0;
+	fbp->slices[i].text = NULL;
+    }
+    return fbp;
+}
+
+/* Thread: format the values of a slice */
+static void *
+fmtslice_format(void *arg)
+{
+    fmtslice_t *slice = (fmtslice_t *)arg;
+    const ncvar_t *vp = slice->vp;
+    const char *valp = slice->vals;
+    safebuf_t *sb = sbuf_new();
+    size_t used = 0;
+    size_t i;
+
+    for(i = 0; i < slice->nvals; i++) {
+	size_t len;
+	print_any_val(sb, vp, valp);
+	valp += vp->tinfo->size;
+	len = sbuf_len(sb) + 1;
+	if(used + len > slice->textsize) {
+	    size_t newsize = 2 * slice->textsize + len + MAX_OUTPUT_LEN;
+	    char *text = (char *) realloc(slice->text, newsize);
+	    if(text == NULL)
+		error("out of memory formatting values");
+	    slice->text = text;
+	    slice->textsize = newsize;
+	}
+	memcpy(slice->text + used, sbuf_str(sb), len);
+	slice->offs[i] = used;
+	used += len;
+    }
+    sbuf_free(sb);
+    return NULL;
+}
+
+/* Format the window of nvals values starting at vals */
+static void
+fmtblock_format(fmtblock_t *fbp, const char *vals, size_t nvals)
+{
+    size_t value_size = fbp->vp->tinfo->size;
+    int i;
+
+    if(nvals > fbp->maxvals) {
+	free(fbp->offs);
+	fbp->offs = (size_t *) emalloc(nvals * sizeof(size_t));
+	fbp->maxvals = nvals;
+    }
+    fbp->per = (nvals + fbp->nthreads - 1) / fbp->nthreads;
+    for(i = 0; i < fbp->nthreads; i++) {
+	fmtslice_t *slice = &fbp->slices[i];
+	size_t first = i * fbp->per;
+	size_t end = first + fbp->per < nvals ? first + fbp->per : nvals;
+	if(first > end)		/* more threads than values */
+	    first = end;
+	slice->vals = vals + first * value_size;
+	slice->nvals = end - first;
+	slice->offs = fbp->offs + first;
+	if(i > 0 && pthread_create(&fbp->threads[i], NULL, fmtslice_format, slice) != 0)
+	    error("can't create thread to format values");
+    }
+    fmtslice_format(&fbp->slices[0]);
+    for(i = 1; i < fbp->nthreads; i++)
+	pthread_join(fbp->threads[i], NULL);
+    fbp->vals = vals;
+    fbp->nvals = nvals;
+}
+
+/* Set the block of nvals values starting at vals, for fmtblock_str()
+ * to format as they are printed */
+static void
+fmtblock_set(fmtblock_t *fbp, const char *vals, size_t nvals)
+{
+    fbp->block = nvals < MIN_THREADED_VALS ? NULL : vals;
+    fbp->nblock = nvals;
+    fbp->vals = NULL;
+}
+
+/* String for the value at valp, formatting the next window of the
+ * block if needed, or NULL if it's not in the block */
+static const char *
+fmtblock_str(fmtblock_t *fbp, const char *valp)
+{
+    size_t value_size = fbp->vp->tinfo->size;
+    size_t i;
+
+    if(fbp->block == NULL || valp < fbp->block
+       || valp >= fbp->block + fbp->nblock * value_size)
+	return NULL;
+    if(fbp->vals == NULL || valp < fbp->vals
+       || valp >= fbp->vals + fbp->nvals * value_size) {
+	size_t left = fbp->nblock - (valp - fbp->block) / value_size;
+	fmtblock_format(fbp, valp, left < FMTWINDOW ? left : FMTWINDOW);
+    }
+    i = (valp - fbp->vals) / value_size;
+    return fbp->slices[i / fbp->per].text + fbp->offs[i];
+}
+
+static void
+fmtblock_free(fmtblock_t *fbp)
+{
+    int i;
+    for(i = 0; i < fbp->nthreads; i++)
+	free(fbp->slices[i].text);
+    free(fbp->slices);
+    free(fbp->threads);
+    free(fbp->offs);
+    free(fbp);
+}
+#else  /* no threads, so values are always formatted as printed */
+static fmtblock_t *
+fmtblock_new(const ncvar_t *vp)
+{
+    return NULL;
+}
+
+static void
+fmtblock_set(fmtblock_t *fbp, const char *vals, size_t nvals)
+{
+}
+
+static const char *
+fmtblock_str(fmtblock_t *fbp, const char *valp)
+{
+    return NULL;
+}
+
+static void
+fmtblock_free(fmtblock_t *fbp)
+{
+}
+#endif	/* HAVE_PTHREAD_H */
+
+/* Output a value of a variable, using its string formatted in
+ * advance if there is one */
+static void
+print_block_val(
+    safebuf_t *sb,		/* string where output goes */
+    const ncvar_t *varp,	/* variable */
+    fmtblock_t *fbp,		/* values formatted in advance, or NULL */
+    const char *valp		/* pointer to the value */
+	    )
+{
+    const char *cp = fbp ? fmtblock_str(fbp, valp) : NULL;
+    if(cp)
+	sbuf_cpy(sb, cp);
+    else
+	print_any_val(sb, varp, valp);
+}
+
+/*
+ * Rows of a variable's values read in large blocks, rather than with
+ * one read per row.  A block is a multiple of the chunk length along a
+ * split dimension, 1 along outer dimensions, and the whole length of
+ * inner dimensions, so blocks hold rows in the order they are printed,
+ * and a chunk of a chunked variable is read once for all of its rows
+ * rather than once for each.
+ */
+typedef struct {
+    int ncid;
+    int varid;
+    const ncvar_t *vp;
+    int rank;
+    int split;			/* dimension along which blocks are split */
+    size_t rowsize;		/* bytes in a row of values */
+    size_t *dims;		/* shape of values dumped */
+    size_t *blocks;		/* shape of full blocks */
+    size_t *start;		/* corner of current block */
+    size_t *count;		/* shape of current block */
+    char *buf;			/* values of current block */
+    int cache_set;		/* if the variable's chunk cache was enlarged */
+    size_t cache_size;		/* chunk cache settings to restore */
+    size_t cache_nelems;
+    float cache_preemption;
+} rowblock_t;
+
+/* Get a reader for blocks of rows of a variable, or NULL if its rows
+ * should just be read one at a time. */
+static rowblock_t *
+rowblock_new(int ncid, int varid, const ncvar_t *vp, const size_t *vdims)
+{
+    rowblock_t *rbp;
+    int rank = vp->ndims;
+    int storage = NC_CONTIGUOUS;
+    size_t *chunks;
+    size_t *blocks;
+    size_t value_size = vp->tinfo->size;
+    size_t inner, len, nbytes;
+    int split = -1;
+    int spanning = 0;		/* chunks longer than 1 before split? */
+    int d;
+
+    /* only for fixed size values, which need no freeing */
+    if(rank < 2 || vp->type > NC_MAX_ATOMIC_TYPE || vp->type == NC_STRING)
+	return NULL;
+    for(d = 0; d < rank; d++) {
+	if(vdims[d] == 0)
+	    return NULL;
+    }
+    chunks = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    NC_CHECK(nc_inq_var_chunking(ncid, varid, &storage, chunks));
+    for(d = 0; d < rank; d++) {
+	/* chunk lengths in values dumped, for a strided hyperslab */
+	if(storage == NC_CHUNKED && vp->slab_stride && vp->slab_stride[d] > 1)
+	    chunks[d] = (chunks[d] + (size_t)vp->slab_stride[d] - 1)
+		/ (size_t)vp->slab_stride[d];
+	if(storage != NC_CHUNKED || chunks[d] > vdims[d])
+	    chunks[d] = storage == NC_CHUNKED ? vdims[d] : 1;
+    }
+    /* outermost dimension at which a chunk length of rows fits */
+    inner = value_size * vdims[rank - 1];
+    for(d = rank - 2; d >= 0; d--) {
+	if(chunks[d] * inner > ROWBLOCKSIZ)
+	    break;
+	split = d;
+	inner *= vdims[d];
+    }
+    if(split == -1) {
+	free(chunks);
+	return NULL;
+    }
+    inner = value_size;
+    for(d = split + 1; d < rank; d++)
+	inner *= vdims[d];
+    for(d = 0; d < split; d++) {
+	if(chunks[d] > 1)
+	    spanning = 1;
+    }
+    if(spanning) {
+	/* Chunks span several blocks along outer dimensions, so keep
+	 * blocks to one chunk's length, and the chunk cache small
+	 * enough to hold the chunks of a block until the next blocks
+	 * have used them */
+	len = chunks[split];
+    } else {
+	len = ROWBLOCKSIZ / inner / chunks[split] * chunks[split];
+	if(len > vdims[split])
+	    len = vdims[split];
+    }
+    if(len * inner == value_size * vdims[rank - 1]) { /* just one row */
+	free(chunks);
+	return NULL;
+    }
+
+    blocks = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    for(d = 0; d < rank; d++)
+	blocks[d] = d < split ? 1 : d == split ? len : vdims[d];
+
+    rbp = (rowblock_t *) emalloc(sizeof(rowblock_t));
+    rbp->cache_set = 0;
+#ifdef USE_NETCDF4
+    if(spanning) {
+	size_t cache_size, cache_nelems;
+	float cache_preemption;
+	size_t nchunks = 1;
+	nbytes = value_size;
+	for(d = 0; d < rank; d++) {
+	    size_t n = d <= split ? 1 : (vdims[d] + chunks[d] - 1) / chunks[d];
+	    nbytes *= n * chunks[d];
+	    nchunks *= n;
+	}
+	if(nbytes <= 4 * ROWBLOCKSIZ
+	   && nc_get_var_chunk_cache(ncid, varid, &cache_size, &cache_nelems,
+				     &cache_preemption) == NC_NOERR
+	   && cache_size < nbytes) {
+	    rbp->cache_set = 1;
+	    rbp->cache_size = cache_size;
+	    rbp->cache_nelems = cache_nelems;
+	    rbp->cache_preemption = cache_preemption;
+	    if(cache_nelems < nchunks)
+		cache_nelems = nchunks;
+	    NC_CHECK(nc_set_var_chunk_cache(ncid, varid, nbytes, cache_nelems,
+					    cache_preemption));
+	}
+    }
+#endif	/* USE_NETCDF4 */
+
+    rbp->ncid = ncid;
+    rbp->varid = varid;
+    rbp->vp = vp;
+    rbp->rank = rank;
+    rbp->split = split;
+    rbp->rowsize = value_size * vdims[rank - 1];
+    rbp->dims = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    rbp->blocks = blocks;
+    rbp->start = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    rbp->count = (size_t *) emalloc((rank + 1) * sizeof(size_t));
+    nbytes = value_size;
+    for(d = 0; d < rank; d++) {
+	rbp->dims[d] = vdims[d];
+	rbp->start[d] = 0;
+	rbp->count[d] = 0;	/* no block read yet */
+	nbytes *= blocks[d];
+    }
+    rbp->buf = (char *) emalloc(nbytes);
+    free(chunks);
+    return rbp;
+}
+
+/* Move to the next block, odometer style.  Returns false if there are
+ * no more blocks. */
+static bool_t
+rowblock_next(rowblock_t *rbp)
+{
+    int d;
+    if(rbp->count[0] != 0) {	/* not the first block */
+	for(d = rbp->rank - 1; d >= 0; d--) {
+	    rbp->start[d] += rbp->blocks[d];
+	    if(rbp->start[d] < rbp->dims[d] || d == 0)
+		break;
+	    rbp->start[d] = 0;
+	}
+	if(rbp->start[0] >= rbp->dims[0])
+	    return false;
+    }
+    for(d = 0; d < rbp->rank; d++) {
+	rbp->count[d] = rbp->dims[d] - rbp->start[d];
+	if(rbp->count[d] > rbp->blocks[d])
+	    rbp->count[d] = rbp->blocks[d];
+    }
+    return true;
+}
+
+/* Is the row at corner cor in the current block? */
+static bool_t
+rowblock_holds(const rowblock_t *rbp, const size_t *cor)
+{
+    int d;
+    for(d = 0; d < rbp->rank - 1; d++) {
+	if(cor[d] < rbp->start[d] || cor[d] >= rbp->start[d] + rbp->count[d])
+	    return false;
+    }
+    return true;
+}
+
+/* Get the values of the row at corner cor, reading the next block if
+ * the row isn't in the current one, and formatting it with fbp if
+ * not NULL */
+static const char *
+rowblock_row(rowblock_t *rbp, const size_t *cor, fmtblock_t *fbp)
+{
+    size_t row = 0;
+    int d;
+
+    if(!rowblock_holds(rbp, cor)) {
+	size_t nrows = 1;
+	if(!rowblock_next(rbp) || !rowblock_holds(rbp, cor))
+	    error("vardata: rows out of order");
+	get_slab_vals(rbp->ncid, rbp->varid, rbp->vp, rbp->start, rbp->count,
+		      rbp->buf);
+	if(fbp) {
+	    for(d = rbp->split; d < rbp->rank - 1; d++)
+		nrows *= rbp->count[d];
+	    fmtblock_set(fbp, rbp->buf,
+			    nrows * rbp->rowsize / fbp->vp->tinfo->size);
+	}
+    }
+    for(d = rbp->split; d < rbp->rank - 1; d++)
+	row = row * rbp->count[d] + (cor[d] - rbp->start[d]);
+    return rbp->buf + row * rbp->rowsize;
+}
+
+static void
+rowblock_free(rowblock_t *rbp)
+{
+#ifdef USE_NETCDF4
+    /* leave the chunk cache as it was, for the variables dumped next */
+    if(rbp->cache_set)
+	NC_CHECK(nc_set_var_chunk_cache(rbp->ncid, rbp->varid, rbp->cache_size,
+					rbp->cache_nelems, rbp->cache_preemption));
+#endif	/* USE_NETCDF4 */
+    free(rbp->buf);
+    free(rbp->dims);
+    free(rbp->blocks);
+    free(rbp->start);
+    free(rbp->count);
+    free(rbp);
+}
+
 /*  Print data values for variable varid.
  *
  * Recursive to handle possibility of variables with multiple
@@ -426,7 +934,9 @@ print_rows(
     size_t cor[],      	/* corner coordinates */
     size_t edg[],      	/* edges of hypercube */
     void *vals,   	/* allocated buffer for ncols values in a row */
-    int marks_pending	/* number of pending closing "}" record markers */
+    int marks_pending,	/* number of pending closing "}" record markers */
+    rowblock_t *rbp,	/* blocks of rows, or NULL to read a row at a time */
+    fmtblock_t *fbp	/* formatter for blocks of values, or NULL */
     )
 {
     int rank = vp->ndims;
@@ -456,11 +966,11 @@ print_rows(
 	local_edg[level] = 1;
 	for(i = 0; i < d0 - 1; i++) {
 	    print_rows(level + 1, ncid, varid, vp, vdims,
-		       local_cor, local_edg, vals, 0);
+		       local_cor, local_edg, vals, 0, rbp, fbp);
 	    local_cor[level] += 1;
 	}
 	print_rows(level + 1, ncid, varid, vp, vdims,
-		   local_cor, local_edg, vals, marks_pending);
+		   local_cor, local_edg, vals, marks_pending, rbp, fbp);
 	free(local_edg);
 	free(local_cor);
     } else {			/* bottom out of recursion */
@@ -470,14 +980,20 @@ print_rows(
 	if(formatting_specs.brief_data_cmnts && rank > 1 && ncols > 0) {
 	    annotate_brief(vp, cor, vdims);
 	}
-	NC_CHECK(nc_get_vara(ncid, varid, cor, edg, (void *)valp));
+	if(rbp) {
+	    valp = (char *) rowblock_row(rbp, cor, fbp);
+	} else {
+	    get_slab_vals(ncid, varid, vp, cor, edg, (void *)valp);
+	    if(fbp)
+		fmtblock_set(fbp, valp, ncols);
+	}
 
 	/* Test if we should treat array of chars as strings along last dimension  */
 	if(vp->type == NC_CHAR && (vp->fmt == 0 || STREQ(vp->fmt,"%s") || STREQ(vp->fmt,""))) {
-	    pr_tvals(vp, ncols, vals, cor);
+	    pr_tvals(vp, ncols, valp, cor);
 	} else {			/* for non-text variables */
 	    for(i=0; i < d0 - 1; i++) {
-		print_any_val(sb, vp, (void *)valp);
+		print_block_val(sb, vp, fbp, valp);
 		valp += vp->tinfo->size; /* next value according to type */
 		if (formatting_specs.full_data_cmnts) {
 		    printf("%s, ", sb->buf);
@@ -487,7 +1003,7 @@ print_rows(
 		    lput(sbuf_str(sb));
 		}
 	    }
-	    print_any_val(sb, vp, (void *)valp);
+	    print_block_val(sb, vp, fbp, valp);
 	}
 	/* determine if this is the last row */
 	lastrow = true;
@@ -529,6 +1045,8 @@ vardata(
     size_t *edg;	     /* edges of hypercube */
     size_t *add;	     /* "odometer" increment to next "row"  */
     void *vals;
+    rowblock_t *rbp;	     /* blocks of rows, if read that way */
+    fmtblock_t *fbp;	     /* formatter for blocks of values, with -j */
 
     int id;
     size_t nels;
@@ -578,8 +1096,14 @@ vardata(
     }
     nrows = nels/ncols;		/* number of "rows" */
     vals = emalloc(ncols * vp->tinfo->size);
-
-    NC_CHECK(print_rows(level, ncid, varid, vp, vdims, cor, edg, vals, marks_pending));
+    rbp = rowblock_new(ncid, varid, vp, vdims);
+    fbp = fmtblock_new(vp);
+
+    NC_CHECK(print_rows(level, ncid, varid, vp, vdims, cor, edg, vals, marks_pending, rbp, fbp));
+    if(rbp)
+	rowblock_free(rbp);
+    if(fbp)
+	fmtblock_free(fbp);
     free(vals);
     free(cor);
     free(edg);
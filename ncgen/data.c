@@ -736,6 +736,7 @@ builddatasublist(Datalist* dl)
 {
 
   NCConstant d;
+  spoolabandon(); /* {...} is not streamed */
   d.nctype = NC_COMPOUND;
   d.lineno = (dl->length > 0?dl->data[0].lineno:0);
   d.value.compoundv = dl;
@@ -744,6 +745,181 @@ builddatasublist(Datalist* dl)
 
 }
 
+/**************************************************/
+/* Spooling of variable data.
+
+When generating binary output, the values of a variable of primitive
+numeric type that has at most one unlimited dimension, in its first
+dimension, are converted to the variable's type as the parser reads
+them and appended to a compact typed buffer rather than being kept as
+one NCConstant each.  The file cannot be created until the whole CDL
+has been read, so genbin writes the spool out in blocks of whole rows.
+
+The first datalist extended after spoolbegin() is taken to be the
+variable's data list.  Anything else (a {...} sublist, an
+extension of some other list, or a constant that is not a number or _)
+makes the spool give its values back to that list as NCConstants
+and the parser carries on as usual.
+*/
+
+static Spool* spool = NULL; /* currently being filled, if any */
+
+void
+spoolbegin(Symbol* vsym)
+{
+    Dimset* dimset = &vsym->typ.dimset;
+    Symbol* basetype = vsym->typ.basetype;
+    int rank = dimset->ndims;
+    int firstunlim, nunlim;
+
+    if(spool != NULL) spoolabandon();
+    if(vsym->var.spool != NULL) { /* data given more than once */
+	spoolfree(vsym->var.spool);
+	vsym->var.spool = NULL;
+    }
+    if(l_flag != L_BINARY || rank == 0 || basetype == NULL
+       || basetype->subclass != NC_PRIM)
+	return;
+    switch (basetype->typ.typecode) {
+    case NC_BYTE: case NC_SHORT: case NC_INT: case NC_FLOAT: case NC_DOUBLE:
+    case NC_UBYTE: case NC_USHORT: case NC_UINT: case NC_INT64: case NC_UINT64:
+	break;
+    default: return;
+    }
+    firstunlim = findunlimited(dimset,1);
+    nunlim = countunlimited(dimset);
+    if(nunlim > 1 || (firstunlim != 0 && firstunlim != rank))
+	return;
+    spool = (Spool*)emalloc(sizeof(Spool));
+    memset((void*)spool,0,sizeof(Spool));
+    spool->var = vsym;
+    spool->typecode = basetype->typ.typecode;
+    spool->typesize = nctypesize(spool->typecode);
+    spool->values = bbNew();
+    spool->fills = bbNew();
+}
+
+int
+spooling(void)
+{
+    return (spool != NULL);
+}
+
+/* Return 1 if con went into the spool, 0 if the caller must
+   add it to dl itself */
+int
+spoolappend(Datalist* dl, NCConstant* con)
+{
+    if(spool == NULL) return 0;
+    if(spool->owner == NULL) spool->owner = dl;
+    if(dl == spool->owner) {
+	unsigned char value[sizeof(double)+sizeof(long long)];
+	if(spool->count == 0) spool->lineno = con->lineno;
+	switch (con->nctype) {
+	case NC_FILLVALUE: {
+	    size_t* run = (size_t*)bbContents(spool->fills);
+	    size_t nruns = bbLength(spool->fills)/(2*sizeof(size_t));
+	    if(nruns > 0 && run[2*nruns-2]+run[2*nruns-1] == spool->count)
+		run[2*nruns-1]++;
+	    else {
+		size_t newrun[2];
+		newrun[0] = spool->count;
+		newrun[1] = 1;
+		bbAppendn(spool->fills,(void*)newrun,sizeof(newrun));
+	    }
+	    memset((void*)value,0,sizeof(value));
+	    } break;
+	case NC_BYTE: case NC_SHORT: case NC_INT: case NC_FLOAT: case NC_DOUBLE:
+	case NC_UBYTE: case NC_USHORT: case NC_UINT: case NC_INT64: case NC_UINT64:
+	    spoolconvert(spool->var->typ.basetype,con,(void*)value);
+	    break;
+	default:
+	    spoolabandon();
+	    return 0;
+	}
+	bbAppendn(spool->values,(void*)value,spool->typesize);
+	spool->count++;
+	return 1;
+    }
+    spoolabandon();
+    return 0;
+}
+
+/* Give the spooled values back to the owning datalist */
+static void
+spoolunpack(Spool* sp)
+{
+    size_t i, nruns, r;
+    size_t* run = (size_t*)bbContents(sp->fills);
+    NCConstant con;
+
+    nruns = bbLength(sp->fills)/(2*sizeof(size_t));
+    for(r=0,i=0;i<sp->count;i++) {
+	while(r < nruns && i >= run[2*r]+run[2*r+1]) r++;
+	memset((void*)&con,0,sizeof(con));
+	if(r < nruns && i >= run[2*r]) {
+	    con.nctype = NC_FILLVALUE;
+	} else {
+	    const char* value = bbContents(sp->values)+i*sp->typesize;
+	    con.nctype = sp->typecode;
+	    memcpy((void*)&con.value,(void*)value,sp->typesize);
+	}
+	con.lineno = sp->lineno;
+	dlappend(sp->owner,&con);
+    }
+}
+
+void
+spoolabandon(void)
+{
+    if(spool == NULL) return;
+    spoolunpack(spool);
+    spoolfree(spool);
+    spool = NULL;
+}
+
+/* Go back to an ordinary datalist for vsym, e.g. because semantics
+   changed its type */
+void
+spoolrelease(Symbol* vsym)
+{
+    Spool* sp = vsym->var.spool;
+    if(sp == NULL) return;
+    if(sp->owner != NULL) spoolunpack(sp);
+    spoolfree(sp);
+    vsym->var.spool = NULL;
+}
+
+void
+spoolend(Symbol* vsym)
+{
+    if(spool == NULL) return;
+    ASSERT(spool->var == vsym);
+    vsym->var.spool = spool;
+    spool = NULL;
+}
+
+void
+spoolfree(Spool* sp)
+{
+    if(sp == NULL) return;
+    bbFree(sp->values);
+    bbFree(sp->fills);
+    efree(sp);
+}
+
+/* Convert con to the primitive type basetype, storing the value at
+   value as generate_primdata would */
+void
+spoolconvert(Symbol* basetype, NCConstant* con, void* value)
+{
+    NCConstant target;
+    memset((void*)&target,0,sizeof(target));
+    target.nctype = basetype->typ.typecode;
+    convert1(con,&target);
+    memcpy(value,(void*)&target.value,nctypesize(target.nctype));
+}
+
 /*! Function to free an allocated datalist.
 
   This function is used to free an individual datalist
@@ -98,6 +98,28 @@ extern NCConstant builddatasublist(Datalist* dl);
 extern void dlextend(Datalist* dl);
 extern void dlsetalloc(Datalist* dl, size_t newalloc);
 
+/* Values for a variable of primitive numeric type, converted to that
+   type as the parser reads them (binary output only) */
+typedef struct Spool {
+    struct Symbol* var;
+    Datalist* owner;    /* datalist the values would otherwise go into */
+    nc_type typecode;
+    size_t typesize;
+    size_t count;       /* # of values, including fill values */
+    Bytebuffer* values; /* count values of typesize bytes each */
+    Bytebuffer* fills;  /* (start,count) pairs of runs of fill values */
+    int lineno;
+} Spool;
+
+extern void spoolbegin(struct Symbol* vsym);
+extern int spooling(void);
+extern int spoolappend(Datalist* dl, NCConstant* con);
+extern void spoolabandon(void);
+extern void spoolend(struct Symbol* vsym);
+extern void spoolrelease(struct Symbol* vsym);
+extern void spoolfree(Spool* spool);
+extern void spoolconvert(struct Symbol* basetype, NCConstant* con, void* value);
+
 int       datalistline(Datalist*);
 #define   datalistith(dl,i) ((dl)==NULL?NULL:((i) >= (dl)->length?NULL:&(dl)->data[i]))
 #define   datalistlen(dl) ((dl)==NULL?0:(dl)->length)
@@ -6,6 +6,11 @@
 
 #include "includes.h"
 #include <ctype.h>	/* for isprint() */
+#include "nc_iter.h"
+#include "odom.h"
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 
 #ifdef ENABLE_BINARY
 
@@ -14,6 +19,13 @@
 /* Forward*/
 static void genbin_defineattr(Symbol* asym);
 static void genbin_definevardata(Symbol* vsym);
+static void genbin_writespool(Symbol* vsym);
+#ifdef HAVE_PTHREAD_H
+typedef struct Jobs Jobs;
+static Jobs* genbin_startjobs(void);
+static int genbin_writejob(Jobs*,Symbol*);
+static void genbin_endjobs(Jobs*);
+#endif
 static int  genbin_write(Generator*,Symbol*,Bytebuffer*,int,size_t*,size_t*);
 static int genbin_writevar(Generator*,Symbol*,Bytebuffer*,int,size_t*,size_t*);
 static int genbin_writeattr(Generator*,Symbol*,Bytebuffer*,int,size_t*,size_t*);
@@ -162,16 +174,30 @@ gen_netcdf(const char *filename)
     check_err(stat,__LINE__,__FILE__);
 
     if(!header_only) {
+#ifdef HAVE_PTHREAD_H
+	/* With -j, convert the data of the variables that can be
+	   converted safely in worker threads, and write them here,
+	   in order, as the others */
+	Jobs* jobs = (nthreads > 1 ? genbin_startjobs() : NULL);
+#endif
         /* Load values into those variables with defined data */
         if(nvars > 0) {
             for(ivar = 0; ivar < nvars; ivar++) {
                 Symbol* vsym = (Symbol*)listget(vardefs,ivar);
                 if(vsym->data != NULL) {
+#ifdef HAVE_PTHREAD_H
+		    if(jobs != NULL && genbin_writejob(jobs,vsym))
+			continue;
+#endif
                     bbClear(databuf);
                     genbin_definevardata(vsym);
                 }
             }
         }
+#ifdef HAVE_PTHREAD_H
+	if(jobs != NULL)
+	    genbin_endjobs(jobs);
+#endif
     }
     bbFree(databuf);
 }
@@ -365,11 +391,320 @@ genbin_definevardata(Symbol* vsym)
 {
     Bytebuffer* databuf;
     if(vsym->data == NULL) return;
+    if(vsym->var.spool != NULL) {
+	genbin_writespool(vsym);
+	return;
+    }
     databuf = bbNew();
     generator_reset(bin_generator,NULL);
     generate_vardata(vsym,bin_generator,(Writer)genbin_write,databuf);
 }
 
+/* Write the values spooled for vsym while parsing, in blocks of whole
+   rows (of whole chunks along the first dimension when chunk sizes
+   are given), putting in fill values and padding past the end of the
+   data as generate_array would. */
+static void
+genbin_writespool(Symbol* vsym)
+{
+    Spool* spool = vsym->var.spool;
+    Dimset* dimset = &vsym->typ.dimset;
+    Specialdata* special = &vsym->var.special;
+    size_t typesize = spool->typesize;
+    size_t bufsize = nciterbuffersize;
+    size_t* run = (size_t*)bbContents(spool->fills);
+    size_t nruns = bbLength(spool->fills)/(2*sizeof(size_t));
+    size_t offset, nelems, i, r;
+    unsigned char fill[sizeof(double)+sizeof(long long)];
+    Bytebuffer* block = bbNew();
+    Odometer* odom;
+    nciter_t iter;
+
+    spoolconvert(vsym->typ.basetype,datalistith(getfiller(vsym),0),(void*)fill);
+    if(special->nchunks == dimset->ndims && special->_ChunkSizes != NULL) {
+	size_t slab = special->_ChunkSizes[0]
+		      * crossproduct(dimset,1,dimset->ndims) * typesize;
+	if(slab > 0 && slab <= bufsize)
+	    bufsize -= bufsize % slab;
+    }
+    nc_get_iter(vsym,bufsize,&iter);
+    odom = newodometer(dimset,NULL,NULL);
+    for(offset=0,r=0;;offset+=nelems) {
+	char* data;
+	nelems = nc_next_iter(&iter,odometerstartvector(odom),odometercountvector(odom));
+	if(nelems == 0)
+	    break;
+	bbClear(block);
+	if(offset < spool->count) {
+	    size_t n = spool->count - offset;
+	    if(n > nelems) n = nelems;
+	    bbAppendn(block,bbContents(spool->values)+offset*typesize,n*typesize);
+	}
+	for(i=bbLength(block)/typesize;i<nelems;i++)
+	    bbAppendn(block,(void*)fill,typesize);
+	/* Put in the fill values given as _ within this block */
+	data = bbContents(block);
+	for(;r < nruns && run[2*r] < offset+nelems;r++) {
+	    size_t first = (run[2*r] < offset ? offset : run[2*r]);
+	    size_t last = run[2*r] + run[2*r+1];
+	    if(last > offset+nelems) last = offset+nelems;
+	    for(i=first;i<last;i++)
+		memcpy(data+(i-offset)*typesize,(void*)fill,typesize);
+	    if(run[2*r] + run[2*r+1] > last)
+		break; /* run continues into the next block */
+	}
+	genbin_writevar(bin_generator,vsym,block,dimset->ndims,odom->start,odom->count);
+    }
+    odometerfree(odom);
+    bbFree(block);
+    spoolfree(spool);
+    vsym->var.spool = NULL;
+}
+
+#ifdef HAVE_PTHREAD_H
+/*
+With -j, the data of variables of numeric type whose values are all
+numbers or fill values, kept in data lists rather than spooled, is
+converted by worker threads, one variable per worker at a time.
+Converted blocks are queued on the variable's job, and the main
+thread writes them, variable by variable in the order of vardefs,
+so the netCDF library is only called from one thread and the
+output does not depend on the number of threads.  A worker stops
+when its job has JOBQUEUEMAX blocks waiting; since jobs are handed
+out in the same order they are written, the job being written
+always has a worker that can proceed.
+*/
+
+#define JOBQUEUEMAX 2
+
+typedef struct Block {
+    struct Block* next;
+    Bytebuffer* data;
+    size_t* start;
+    size_t* count;
+} Block;
+
+typedef struct Job {
+    Symbol* vsym;
+    Datalist* filler; /* computed before the workers start */
+    Block* first; /* converted, waiting to be written */
+    Block* last;
+    int nblocks;
+    int done;
+} Job;
+
+struct Jobs {
+    Job* list;
+    int njobs;
+    int next; /* next job for a worker */
+    int written; /* next job for the main thread */
+    pthread_mutex_t lock;
+    pthread_cond_t ready; /* a block was queued or a job is done */
+    pthread_cond_t taken; /* a block was dequeued */
+    pthread_t* threads;
+    int nthreads;
+};
+
+/* Can the data of vsym be converted in a worker thread, i.e.
+   without touching any state shared with the rest of ncgen? */
+static int
+genbin_canconvert(Symbol* vsym)
+{
+    Dimset* dimset = &vsym->typ.dimset;
+    Symbol* basetype = vsym->typ.basetype;
+    int rank = dimset->ndims;
+    int firstunlim = findunlimited(dimset,1);
+    int nunlim = countunlimited(dimset);
+    size_t i;
+
+    if(vsym->data == NULL || vsym->var.spool != NULL || rank == 0
+       || basetype->subclass != NC_PRIM)
+	return 0;
+    if(nunlim > 1 || (firstunlim != 0 && firstunlim != rank))
+	return 0;
+    switch (basetype->typ.typecode) {
+    case NC_BYTE: case NC_SHORT: case NC_INT: case NC_FLOAT: case NC_DOUBLE:
+    case NC_UBYTE: case NC_USHORT: case NC_UINT: case NC_INT64: case NC_UINT64:
+	break;
+    default: return 0;
+    }
+    for(i=0;i<vsym->data->length;i++) {
+	switch (datalistith(vsym->data,i)->nctype) {
+	case NC_BYTE: case NC_SHORT: case NC_INT: case NC_FLOAT: case NC_DOUBLE:
+	case NC_UBYTE: case NC_USHORT: case NC_UINT: case NC_INT64: case NC_UINT64:
+	case NC_FILLVALUE:
+	    break;
+	default: return 0;
+	}
+    }
+    return 1;
+}
+
+/* Convert the data of a job's variable a block at a time, as the
+   flat case of generate_array does */
+static void
+genbin_convertjob(Jobs* jobs, Job* job)
+{
+    Symbol* vsym = job->vsym;
+    Symbol* basetype = vsym->typ.basetype;
+    Dimset* dimset = &vsym->typ.dimset;
+    int rank = dimset->ndims;
+    size_t typesize = nctypesize(basetype->typ.typecode);
+    size_t offset, nelems, i;
+    unsigned char value[sizeof(double)+sizeof(long long)];
+    Odometer* odom;
+    nciter_t iter;
+
+    nc_get_iter(vsym,nciterbuffersize,&iter);
+    odom = newodometer(dimset,NULL,NULL);
+    for(offset=0;;offset+=nelems) {
+	Block* block;
+	nelems = nc_next_iter(&iter,odometerstartvector(odom),odometercountvector(odom));
+	if(nelems == 0)
+	    break;
+	block = (Block*)emalloc(sizeof(Block));
+	block->next = NULL;
+	block->data = bbNew();
+	bbSetalloc(block->data,nelems*typesize);
+	block->start = (size_t*)emalloc(rank*sizeof(size_t));
+	block->count = (size_t*)emalloc(rank*sizeof(size_t));
+	memcpy(block->start,odom->start,rank*sizeof(size_t));
+	memcpy(block->count,odom->count,rank*sizeof(size_t));
+	for(i=0;i<nelems;i++) {
+	    NCConstant* con = datalistith(vsym->data,i+offset);
+	    if(con == NULL || isfillconst(con))
+		con = datalistith(job->filler,0);
+	    spoolconvert(basetype,con,(void*)value);
+	    bbAppendn(block->data,(void*)value,typesize);
+	}
+	pthread_mutex_lock(&jobs->lock);
+	while(job->nblocks >= JOBQUEUEMAX)
+	    pthread_cond_wait(&jobs->taken,&jobs->lock);
+	if(job->last == NULL) job->first = block; else job->last->next = block;
+	job->last = block;
+	job->nblocks++;
+	pthread_cond_broadcast(&jobs->ready);
+	pthread_mutex_unlock(&jobs->lock);
+    }
+    odometerfree(odom);
+    pthread_mutex_lock(&jobs->lock);
+    job->done = 1;
+    pthread_cond_broadcast(&jobs->ready);
+    pthread_mutex_unlock(&jobs->lock);
+}
+
+/* Worker: convert jobs until there are none left */
+static void*
+genbin_worker(void* arg)
+{
+    Jobs* jobs = (Jobs*)arg;
+    for(;;) {
+	Job* job = NULL;
+	pthread_mutex_lock(&jobs->lock);
+	if(jobs->next < jobs->njobs)
+	    job = &jobs->list[jobs->next++];
+	pthread_mutex_unlock(&jobs->lock);
+	if(job == NULL)
+	    break;
+	genbin_convertjob(jobs,job);
+    }
+    return NULL;
+}
+
+/* Start workers on the variables that can be converted by them,
+   or return NULL if there are none */
+static Jobs*
+genbin_startjobs(void)
+{
+    Jobs* jobs;
+    int ivar, nvars = listlength(vardefs);
+    int i;
+
+    jobs = (Jobs*)emalloc(sizeof(Jobs));
+    memset((void*)jobs,0,sizeof(Jobs));
+    jobs->list = (Job*)emalloc((nvars+1)*sizeof(Job));
+    for(ivar=0;ivar<nvars;ivar++) {
+	Symbol* vsym = (Symbol*)listget(vardefs,ivar);
+	Job* job;
+	if(!genbin_canconvert(vsym))
+	    continue;
+	job = &jobs->list[jobs->njobs++];
+	memset((void*)job,0,sizeof(Job));
+	job->vsym = vsym;
+	job->filler = getfiller(vsym);
+    }
+    if(jobs->njobs == 0) {
+	efree(jobs->list);
+	efree(jobs);
+	return NULL;
+    }
+    pthread_mutex_init(&jobs->lock,NULL);
+    pthread_cond_init(&jobs->ready,NULL);
+    pthread_cond_init(&jobs->taken,NULL);
+    jobs->nthreads = (nthreads < jobs->njobs ? nthreads : jobs->njobs);
+    jobs->threads = (pthread_t*)emalloc(jobs->nthreads*sizeof(pthread_t));
+    for(i=0;i<jobs->nthreads;i++) {
+	if(pthread_create(&jobs->threads[i],NULL,genbin_worker,jobs) != 0)
+	    break; /* make do with the threads we have */
+    }
+    jobs->nthreads = i;
+    if(jobs->nthreads == 0) { /* convert everything serially */
+	jobs->njobs = 0;
+	genbin_endjobs(jobs);
+	return NULL;
+    }
+    return jobs;
+}
+
+/* If vsym is the next variable converted by the workers, write its
+   blocks as they are converted and return 1, else return 0 */
+static int
+genbin_writejob(Jobs* jobs, Symbol* vsym)
+{
+    Job* job;
+    if(jobs->written == jobs->njobs || jobs->list[jobs->written].vsym != vsym)
+	return 0;
+    job = &jobs->list[jobs->written++];
+    for(;;) {
+	Block* block;
+	pthread_mutex_lock(&jobs->lock);
+	while(job->first == NULL && !job->done)
+	    pthread_cond_wait(&jobs->ready,&jobs->lock);
+	block = job->first;
+	if(block != NULL) {
+	    job->first = block->next;
+	    if(job->first == NULL) job->last = NULL;
+	    job->nblocks--;
+	    pthread_cond_broadcast(&jobs->taken);
+	}
+	pthread_mutex_unlock(&jobs->lock);
+	if(block == NULL)
+	    break;
+	genbin_writevar(bin_generator,vsym,block->data,vsym->typ.dimset.ndims,
+			block->start,block->count);
+	bbFree(block->data);
+	efree(block->start);
+	efree(block->count);
+	efree(block);
+    }
+    return 1;
+}
+
+static void
+genbin_endjobs(Jobs* jobs)
+{
+    int i;
+    for(i=0;i<jobs->nthreads;i++)
+	pthread_join(jobs->threads[i],NULL);
+    pthread_cond_destroy(&jobs->taken);
+    pthread_cond_destroy(&jobs->ready);
+    pthread_mutex_destroy(&jobs->lock);
+    efree(jobs->threads);
+    efree(jobs->list);
+    efree(jobs);
+}
+#endif /*HAVE_PTHREAD_H*/
+
 static int
 genbin_write(Generator* generator, Symbol* sym, Bytebuffer* memory,
              int rank, size_t* start, size_t* count)
@@ -188,6 +188,7 @@ extern int nofill_flag;
 extern int header_only;
 extern char* mainname;
 extern size_t nciterbuffersize;
+extern int nthreads;
 
 extern char* progname; /* for error messages*/
 extern char *netcdf_name; /* command line -o file name */
@@ -53,6 +53,7 @@ GlobalSpecialData globalspecials;
 char* binary_ext = ".nc";
 
 size_t nciterbuffersize;
+int nthreads; /* threads converting variable data, with -j */
 
 struct Vlendata* vlendata;
 
@@ -193,6 +194,7 @@ usage(void)
 " [-d]"
 " [-D debuglevel]"
 " [-h]"
+" [-j nthreads]"
 " [-k kind ]"
 " [-l language=b|c|f77|java]"
 " [-M <name>]"
@@ -231,6 +233,7 @@ main(
     header_only = 0;
     mainname = "main";
     nciterbuffersize = 0;
+    nthreads = 1;
 
     k_flag = 0;
     format_attribute = 0;
@@ -250,7 +253,7 @@ main(
     (void) par_io_init(32, 32);
 #endif
 
-    while ((c = getopt(argc, argv, "134567bB:cdD:fhHk:l:M:no:Pv:xL:")) != EOF)
+    while ((c = getopt(argc, argv, "134567bB:cdD:fhHj:k:l:M:no:Pv:xL:")) != EOF)
       switch(c) {
 	case 'd':
 	  debug = 1;
@@ -387,6 +390,13 @@ main(
 	case 'B':
 	  nciterbuffersize = atoi(optarg);
 	  break;
+	case 'j': /* convert variable data with several threads */
+	  nthreads = atoi(optarg);
+	  if(nthreads < 1) {
+	      derror("%s: -j needs a positive number of threads",progname);
+	      return(1);
+	  }
+	  break;
 	case 'P': /* diskless with persistence */
 	  diskless = 1;
 	  break;
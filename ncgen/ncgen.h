@@ -176,6 +176,7 @@ typedef struct Varinfo {
     int		nattributes; /* |attributes|*/
     List*       attributes;  /* List<Symbol*>*/
     Specialdata special;
+    struct Spool* spool; /* data converted while parsing, or NULL */
 } Varinfo;
 
 typedef struct Groupinfo {
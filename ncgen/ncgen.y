@@ -23,9 +23,6 @@ static char SccsId[] = "$Id: ncgen.y,v 1.42 2010/05/18 21:32:46 dmh Exp $";
 #define ncvar_t void
 #include "nctime.h"
 
-/* parser controls */
-#define YY_NO_INPUT 1
-
 /* True if string a equals string b*/
 #ifndef STREQ
 #define STREQ(a, b)     (*(a) == *(b) && strcmp((a), (b)) == 0)
@@ -653,7 +650,7 @@ varref:
 		    derror("Undefined or forward referenced variable: %s",vsym->name);
 		    YYABORT;
 		}
-		$$=vsym;
+		spoolbegin(vsym); $$=vsym;
 	    }
 	  ;
 
@@ -775,7 +772,7 @@ datadecls:      datadecl ';'
                 ;
 
 datadecl:       varref '=' datalist
-                   {$1->data = $3;}
+                   {$1->data = $3; spoolend($1);}
                 ;
 datalist:
 	  datalist0 {$$ = $1;}
@@ -816,9 +813,9 @@ function:
 
 arglist:
 	  simpleconstant
-	    {$$ = builddatalist(0); datalistextend($$,&($1));}
+	    {$$ = builddatalist(0); dlappend($$,&($1));}
 	| arglist ',' simpleconstant
-	    {datalistextend($1,&($3)); $$=$1;}
+	    {dlappend($1,&($3)); $$=$1;}
 	;
 
 simpleconstant:
@@ -1391,7 +1388,10 @@ containsfills(Datalist* list)
 static void
 datalistextend(Datalist* dl, NCConstant* con)
 {
-    dlappend(dl,con);
+    if(!spoolappend(dl,con))
+        dlappend(dl,con);
+    if(lexrunlength > 0) /* values lexed along with con */
+        lexrunflush(dl);
 }
 
 static void
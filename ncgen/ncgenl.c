@@ -1259,6 +1259,8 @@ static nc_type downconvert(unsigned long long uint64, int*, int, int);
 static int tagmatch(nc_type nct, int tag);
 static int nct2lexeme(nc_type nct);
 static int collecttag(char* text, char** stagp);
+static int lexrun(int token);
+static int lexdouble(const char* text, double* dp);
 
 struct Specialtoken specials[] = {
 {"_FillValue",_FILLVALUE,_FILLVALUE_FLAG},
@@ -1319,7 +1321,7 @@ ID ([A-Za-z_]|{UTF8})([A-Z.@#\[\]a-z_0-9+-]|{UTF8})*
 /* Note: this definition of string will work for utf8 as well,
    although it is a very relaxed definition
 */
-#line 1323 "ncgenl.c"
+#line 1325 "ncgenl.c"
 
 #define INITIAL 0
 #define ST_C_COMMENT 1
@@ -1503,9 +1505,9 @@ YY_DECL
 	register char *yy_cp, *yy_bp;
 	register int yy_act;
     
-#line 217 "ncgen.l"
+#line 219 "ncgen.l"
 
-#line 1509 "ncgenl.c"
+#line 1511 "ncgenl.c"
 
 	if ( !(yy_init) )
 		{
@@ -1590,14 +1592,14 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 218 "ncgen.l"
+#line 220 "ncgen.l"
 { /* whitespace */
 		  break;
 		}
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 222 "ncgen.l"
+#line 224 "ncgen.l"
 { /* comment */
                           break;
                         }
@@ -1605,7 +1607,7 @@ YY_RULE_SETUP
 case 3:
 /* rule 3 can match eol */
 YY_RULE_SETUP
-#line 226 "ncgen.l"
+#line 228 "ncgen.l"
 {int len;
 			 /* In netcdf4, this will be used in a variety
                             of places, so only remove escapes */
@@ -1632,7 +1634,7 @@ ncgtext[MAXTRST-1] = '\0';
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 250 "ncgen.l"
+#line 252 "ncgen.l"
 { /* drop leading 0x; pad to even number of chars */
 		char* p = ncgtext+2;
 		int len = ncgleng - 2;
@@ -1647,113 +1649,113 @@ YY_RULE_SETUP
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 262 "ncgen.l"
+#line 264 "ncgen.l"
 {return lexdebug(COMPOUND);}
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 263 "ncgen.l"
+#line 265 "ncgen.l"
 {return lexdebug(ENUM);}
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 264 "ncgen.l"
+#line 266 "ncgen.l"
 {return lexdebug(OPAQUE_);}
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 266 "ncgen.l"
+#line 268 "ncgen.l"
 {return lexdebug(FLOAT_K);}
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 267 "ncgen.l"
+#line 269 "ncgen.l"
 {return lexdebug(CHAR_K);}
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 268 "ncgen.l"
+#line 270 "ncgen.l"
 {return lexdebug(BYTE_K);}
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 269 "ncgen.l"
+#line 271 "ncgen.l"
 {return lexdebug(UBYTE_K);}
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 270 "ncgen.l"
+#line 272 "ncgen.l"
 {return lexdebug(SHORT_K);}
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 271 "ncgen.l"
+#line 273 "ncgen.l"
 {return lexdebug(USHORT_K);}
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 272 "ncgen.l"
+#line 274 "ncgen.l"
 {return lexdebug(INT_K);}
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 273 "ncgen.l"
+#line 275 "ncgen.l"
 {return lexdebug(UINT_K);}
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 274 "ncgen.l"
+#line 276 "ncgen.l"
 {return lexdebug(INT64_K);}
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 275 "ncgen.l"
+#line 277 "ncgen.l"
 {return lexdebug(UINT64_K);}
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 276 "ncgen.l"
+#line 278 "ncgen.l"
 {return lexdebug(DOUBLE_K);}
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 277 "ncgen.l"
+#line 279 "ncgen.l"
 {int32_val = -1;
 			 return lexdebug(NC_UNLIMITED_K);}
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 280 "ncgen.l"
+#line 282 "ncgen.l"
 {return lexdebug(TYPES);}
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 281 "ncgen.l"
+#line 283 "ncgen.l"
 {return lexdebug(DIMENSIONS);}
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 282 "ncgen.l"
+#line 284 "ncgen.l"
 {return lexdebug(VARIABLES);}
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 283 "ncgen.l"
+#line 285 "ncgen.l"
 {return lexdebug(DATA);}
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 284 "ncgen.l"
+#line 286 "ncgen.l"
 {return lexdebug(GROUP);}
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 286 "ncgen.l"
+#line 288 "ncgen.l"
 {BEGIN(TEXT);return lexdebug(NETCDF);}
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 288 "ncgen.l"
+#line 290 "ncgen.l"
 { /* missing value (pre-2.4 backward compatibility) */
                 if (ncgtext[0] == '-') {
 		    double_val = NEGNC_INFINITE;
@@ -1766,7 +1768,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 297 "ncgen.l"
+#line 299 "ncgen.l"
 { /* missing value (pre-2.4 backward compatibility) */
 		double_val = NAN;
 		specialconstants = 1;
@@ -1775,7 +1777,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 303 "ncgen.l"
+#line 305 "ncgen.l"
 {/* missing value (pre-2.4 backward compatibility)*/
                 if (ncgtext[0] == '-') {
 		    float_val = NEGNC_INFINITEF;
@@ -1788,7 +1790,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 312 "ncgen.l"
+#line 314 "ncgen.l"
 { /* missing value (pre-2.4 backward compatibility) */
 		float_val = NANF;
 		specialconstants = 1;
@@ -1797,7 +1799,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 318 "ncgen.l"
+#line 320 "ncgen.l"
 {
 #ifdef USE_NETCDF4
 		if(l_flag == L_C || l_flag == L_BINARY)
@@ -1810,7 +1812,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 328 "ncgen.l"
+#line 330 "ncgen.l"
 {
 		bbClear(lextext);
 		bbAppendn(lextext,(char*)ncgtext,ncgleng+1); /* include null */
@@ -1821,7 +1823,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 337 "ncgen.l"
+#line 339 "ncgen.l"
 {struct Specialtoken* st;
 		bbClear(lextext);
 		bbAppendn(lextext,(char*)ncgtext,ncgleng+1); /* include null */
@@ -1835,7 +1837,7 @@ YY_RULE_SETUP
 case 33:
 /* rule 33 can match eol */
 YY_RULE_SETUP
-#line 347 "ncgen.l"
+#line 349 "ncgen.l"
 {
 		    int c;
 		    char* p; char* q;
@@ -1854,7 +1856,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 363 "ncgen.l"
+#line 365 "ncgen.l"
 { char* id; int len;
 		    bbClear(lextext);
 		    bbAppendn(lextext,(char*)ncgtext,ncgleng+1); /* include null */
@@ -1869,7 +1871,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 375 "ncgen.l"
+#line 377 "ncgen.l"
 {
 		/*
 		  We need to try to see what size of integer ((u)int).
@@ -1918,7 +1920,7 @@ YY_RULE_SETUP
 		    switch (k_flag) {
 		    case NC_FORMAT_64BIT_DATA:
 		    case NC_FORMAT_NETCDF4:
-			    return lexdebug(nct2lexeme(nct));
+			    return lexdebug(lexrun(nct2lexeme(nct)));
 		    case NC_FORMAT_CLASSIC:
 		    case NC_FORMAT_64BIT_OFFSET:
 		    case NC_FORMAT_NETCDF4_CLASSIC:
@@ -1932,13 +1934,13 @@ YY_RULE_SETUP
 		    if(!tagmatch(nct,tag))  {
 			semwarn(lineno,"Warning: Integer out of range for tag: %s; tag treated as changed.",ncgtext);
 		    }
-		    return lexdebug(nct2lexeme(nct));
+		    return lexdebug(lexrun(nct2lexeme(nct)));
 done: return 0;
 	    }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 441 "ncgen.l"
+#line 443 "ncgen.l"
 {
 		int c;
 		int token = 0;
@@ -1989,18 +1991,18 @@ YY_RULE_SETUP
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 488 "ncgen.l"
+#line 490 "ncgen.l"
 {
-		if (sscanf((char*)ncgtext, "%le", &double_val) != 1) {
+		if (!lexdouble((char*)ncgtext, &double_val)) {
 		    sprintf(errstr,"bad long or double constant: %s",(char*)ncgtext);
 		    yyerror(errstr);
 		}
-                return lexdebug(DOUBLE_CONST);
+                return lexdebug(lexrun(DOUBLE_CONST));
                 }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 495 "ncgen.l"
+#line 497 "ncgen.l"
 {
 		if (sscanf((char*)ncgtext, "%e", &float_val) != 1) {
 		    sprintf(errstr,"bad float constant: %s",(char*)ncgtext);
@@ -2012,7 +2014,7 @@ YY_RULE_SETUP
 case 39:
 /* rule 39 can match eol */
 YY_RULE_SETUP
-#line 502 "ncgen.l"
+#line 504 "ncgen.l"
 {
 	        (void) sscanf((char*)&ncgtext[1],"%c",&byte_val);
 		return lexdebug(BYTE_CONST);
@@ -2020,7 +2022,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 506 "ncgen.l"
+#line 508 "ncgen.l"
 {
 		int oct = unescapeoct(&ncgtext[2]);
 		if(oct < 0) {
@@ -2033,7 +2035,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 515 "ncgen.l"
+#line 517 "ncgen.l"
 {
 		int hex = unescapehex(&ncgtext[3]);
 		if(byte_val < 0) {
@@ -2046,7 +2048,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 524 "ncgen.l"
+#line 526 "ncgen.l"
 {
 	       switch ((char)ncgtext[2]) {
 	          case 'a': byte_val = '\007'; break; /* not everyone under-
@@ -2068,7 +2070,7 @@ YY_RULE_SETUP
 case 43:
 /* rule 43 can match eol */
 YY_RULE_SETUP
-#line 542 "ncgen.l"
+#line 544 "ncgen.l"
 {
 		lineno++ ;
                 break;
@@ -2076,7 +2078,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 547 "ncgen.l"
+#line 549 "ncgen.l"
 {/*initial*/
 	    BEGIN(ST_C_COMMENT);
 	    break;
@@ -2085,21 +2087,21 @@ YY_RULE_SETUP
 case 45:
 /* rule 45 can match eol */
 YY_RULE_SETUP
-#line 552 "ncgen.l"
+#line 554 "ncgen.l"
 {/* continuation */
 				     break;
 				}
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 556 "ncgen.l"
+#line 558 "ncgen.l"
 {/* final */
 			    BEGIN(INITIAL);
 			    break;
 			}
 	YY_BREAK
 case YY_STATE_EOF(ST_C_COMMENT):
-#line 561 "ncgen.l"
+#line 563 "ncgen.l"
 {/* final, error */
 			    fprintf(stderr,"unterminated /**/ comment");
 			    BEGIN(INITIAL);
@@ -2108,17 +2110,17 @@ case YY_STATE_EOF(ST_C_COMMENT):
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 567 "ncgen.l"
+#line 569 "ncgen.l"
 {/* Note: this next rule will not work for UTF8 characters */
 		return lexdebug(ncgtext[0]) ;
 		}
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 570 "ncgen.l"
+#line 572 "ncgen.l"
 ECHO;
 	YY_BREAK
-#line 2122 "ncgenl.c"
+#line 2124 "ncgenl.c"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(TEXT):
 	yyterminate();
@@ -3117,7 +3119,7 @@ void ncgfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 570 "ncgen.l"
+#line 572 "ncgen.l"
 
 
 static int
@@ -3418,3 +3420,186 @@ collecttag(char* text, char** stagp)
     return tag;
 }
 
+/*
+Fast path for the long runs of plain numbers that make up most data
+sections.  While the data of a variable is being spooled (see data.c)
+and the token just lexed is a plain int or double, read any ", value"
+pairs that follow straight from the input, where each value is a
+decimal integer that fits in an int, a decimal floating point number
+without suffix, or _, and queue them; datalistextend appends them
+right after that token's value.  Anything else is pushed back for the
+rules above.
+*/
+
+#define LEXRUNMAX 256 /* max # of values queued for one token */
+#define LEXSKIPMAX 256 /* max # of chars between two values */
+#define LEXITEMMAX 64  /* max # of chars in one value */
+
+static NCConstant lexrunvalues[LEXRUNMAX];
+static int lexrunlength = 0;
+
+static double pow10s[23] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+Convert the text of a floating point constant the way strtod would.
+A mantissa of at most 15 significant digits with a decimal exponent
+within +/-22 converts exactly with one multiplication or division;
+anything else goes to strtod.
+Return 0 if the text has no digits.
+*/
+static int
+lexdouble(const char* text, double* dp)
+{
+    const char* p = text;
+    unsigned long long mantissa = 0;
+    int ndigits = 0; /* significant digits */
+    int anydigits = 0;
+    int exp10 = 0;
+    int isneg = 0;
+
+    if(*p == '+' || *p == '-') isneg = (*p++ == '-');
+    for(;*p >= '0' && *p <= '9';p++) {
+	anydigits = 1;
+	if(mantissa == 0 && *p == '0') continue;
+	mantissa = 10*mantissa + (unsigned long long)(*p - '0');
+	ndigits++;
+    }
+    if(*p == '.') {
+	for(p++;*p >= '0' && *p <= '9';p++) {
+	    anydigits = 1;
+	    exp10--;
+	    if(mantissa == 0 && *p == '0') continue;
+	    mantissa = 10*mantissa + (unsigned long long)(*p - '0');
+	    ndigits++;
+	}
+    }
+    if(!anydigits) return 0;
+    if(*p == 'e' || *p == 'E') {
+	int e = 0, eneg = 0;
+	p++;
+	if(*p == '+' || *p == '-') eneg = (*p++ == '-');
+	for(;*p >= '0' && *p <= '9';p++)
+	    if(e < 10000) e = 10*e + (*p - '0');
+	exp10 += (eneg ? -e : e);
+    }
+    if(ndigits <= 15 && exp10 >= -22 && exp10 <= 22) {
+	double d = (double)mantissa;
+	d = (exp10 < 0 ? d / pow10s[-exp10] : d * pow10s[exp10]);
+	*dp = (isneg ? -d : d);
+    } else
+	*dp = strtod(text,NULL);
+    return 1;
+}
+
+/* Convert one queued value; return 0 if it is not plain */
+static int
+lexrunitem(char* text, NCConstant* con)
+{
+    char* p = text;
+    int ndigits = 0;
+    int isdouble = 0;
+
+    memset((void*)con,0,sizeof(NCConstant));
+    con->lineno = lineno;
+    if(STREQ(text,FILL_STRING)) {
+	con->nctype = NC_FILLVALUE;
+	return 1;
+    }
+    if(*p == '+' || *p == '-') p++;
+    for(;*p >= '0' && *p <= '9';p++) ndigits++;
+    if(*p == '.') {
+	isdouble = 1;
+	for(p++;*p >= '0' && *p <= '9';p++) ndigits++;
+    }
+    if(ndigits == 0) return 0;
+    if(*p == 'e' || *p == 'E') {
+	isdouble = 1;
+	p++;
+	if(*p == '+' || *p == '-') p++;
+	if(*p < '0' || *p > '9') return 0;
+	for(;*p >= '0' && *p <= '9';p++);
+    }
+    if(*p != '\0') return 0;
+    if(isdouble) {
+	con->nctype = NC_DOUBLE;
+	return lexdouble(text,&con->value.doublev);
+    } else {
+	long long value;
+	if(ndigits > 10) return 0;
+	value = strtoll(text,NULL,10);
+	if(value < NC_MIN_INT || value > NC_MAX_INT) return 0;
+	con->nctype = NC_INT;
+	con->value.int32v = (int)value;
+	return 1;
+    }
+}
+
+/* Push back the n chars of text read ahead */
+static void
+lexunput(char* text, int n)
+{
+    while(n > 0) {
+	if(text[--n] == '\n') lineno--;
+	unput(text[n]);
+    }
+}
+
+static int
+lexrun(int token)
+{
+    char text[LEXSKIPMAX+LEXITEMMAX+1];
+
+    if(token != INT_CONST && token != DOUBLE_CONST) return token;
+    if(lexrunlength > 0 || !spooling()) return token;
+    while(lexrunlength < LEXRUNMAX) {
+	int c, n = 0, comma = 0, item;
+	/* Blanks, one comma, blanks */
+	for(;;) {
+	    c = input();
+	    if(c == EOF || c == 0) {lexunput(text,n); return token;}
+	    text[n++] = (char)c;
+	    if(c == '\n') lineno++;
+	    if(c == ',' && !comma) comma = 1;
+	    else if(c != ' ' && c != '\t' && c != '\r' && c != '\n') break;
+	    if(n == LEXSKIPMAX) {lexunput(text,n); return token;}
+	}
+	if(!comma) {lexunput(text,n); return token;}
+	/* The value, up to a char that may follow a value */
+	item = n-1;
+	for(;;) {
+	    if(c == ',' || c == ';' || c == '}' || c == '/'
+	       || c == ' ' || c == '\t' || c == '\r' || c == '\n') break;
+	    if(n - item == LEXITEMMAX) {lexunput(text,n); return token;}
+	    c = input();
+	    if(c == EOF || c == 0) {lexunput(text,n); return token;}
+	    text[n++] = (char)c;
+	    if(c == '\n') lineno++;
+	}
+	text[n-1] = '\0';
+	if(!lexrunitem(text+item,&lexrunvalues[lexrunlength])) {
+	    text[n-1] = (char)c;
+	    lexunput(text,n);
+	    return token;
+	}
+	lexrunlength++;
+	/* Leave the char after the value for next time */
+	text[n-1] = (char)c;
+	lexunput(&text[n-1],1);
+    }
+    return token;
+}
+
+/* Append the values queued by lexrun to dl */
+static void
+lexrunflush(Datalist* dl)
+{
+    int i;
+    for(i=0;i<lexrunlength;i++) {
+	if(!spoolappend(dl,&lexrunvalues[i]))
+	    dlappend(dl,&lexrunvalues[i]);
+    }
+    lexrunlength = 0;
+}
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -65,12 +70,11 @@
 #define yyerror         ncgerror
 #define yydebug         ncgdebug
 #define yynerrs         ncgnerrs
-
 #define yylval          ncglval
 #define yychar          ncgchar
 
-/* Copy the first part of user declarations.  */
-#line 11 "ncgen.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 11 "ncgen.y"
 
 /*
 static char SccsId[] = "$Id: ncgen.y,v 1.42 2010/05/18 21:32:46 dmh Exp $";
@@ -86,9 +90,6 @@ static char SccsId[] = "$Id: ncgen.y,v 1.42 2010/05/18 21:32:46 dmh Exp $";
 #define ncvar_t void
 #include "nctime.h"
 
-/* parser controls */
-#define YY_NO_INPUT 1
-
 /* True if string a equals string b*/
 #ifndef STREQ
 #define STREQ(a, b)     (*(a) == *(b) && strcmp((a), (b)) == 0)
@@ -195,154 +196,255 @@ static void yyerror(fmt,va_alist) const char* fmt; va_dcl;
 extern int lex_init(void);
 
 
-#line 199 "ncgeny.c" /* yacc.c:339  */
+#line 200 "ncgeny.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 1
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "ncgeny.h".  */
-#ifndef YY_NCG_NCGEN_TAB_H_INCLUDED
-# define YY_NCG_NCGEN_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-#if YYDEBUG
-extern int ncgdebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    NC_UNLIMITED_K = 258,
-    CHAR_K = 259,
-    BYTE_K = 260,
-    SHORT_K = 261,
-    INT_K = 262,
-    FLOAT_K = 263,
-    DOUBLE_K = 264,
-    UBYTE_K = 265,
-    USHORT_K = 266,
-    UINT_K = 267,
-    INT64_K = 268,
-    UINT64_K = 269,
-    IDENT = 270,
-    TERMSTRING = 271,
-    CHAR_CONST = 272,
-    BYTE_CONST = 273,
-    SHORT_CONST = 274,
-    INT_CONST = 275,
-    INT64_CONST = 276,
-    UBYTE_CONST = 277,
-    USHORT_CONST = 278,
-    UINT_CONST = 279,
-    UINT64_CONST = 280,
-    FLOAT_CONST = 281,
-    DOUBLE_CONST = 282,
-    DIMENSIONS = 283,
-    VARIABLES = 284,
-    NETCDF = 285,
-    DATA = 286,
-    TYPES = 287,
-    COMPOUND = 288,
-    ENUM = 289,
-    OPAQUE_ = 290,
-    OPAQUESTRING = 291,
-    GROUP = 292,
-    PATH = 293,
-    FILLMARKER = 294,
-    NIL = 295,
-    _FILLVALUE = 296,
-    _FORMAT = 297,
-    _STORAGE = 298,
-    _CHUNKSIZES = 299,
-    _DEFLATELEVEL = 300,
-    _SHUFFLE = 301,
-    _ENDIANNESS = 302,
-    _NOFILL = 303,
-    _FLETCHER32 = 304,
-    _NCPROPS = 305,
-    _ISNETCDF4 = 306,
-    _SUPERBLOCK = 307,
-    DATASETID = 308
-  };
-#endif
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "ncgeny.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 138 "ncgen.y" /* yacc.c:355  */
-
-Symbol* sym;
-unsigned long  size; /* allow for zero size to indicate e.g. UNLIMITED*/
-long           mark; /* track indices into the sequence*/
-int            nctype; /* for tracking attribute list type*/
-Datalist*      datalist;
-NCConstant       constant;
-
-#line 302 "ncgeny.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_NC_UNLIMITED_K = 3,             /* NC_UNLIMITED_K  */
+  YYSYMBOL_CHAR_K = 4,                     /* CHAR_K  */
+  YYSYMBOL_BYTE_K = 5,                     /* BYTE_K  */
+  YYSYMBOL_SHORT_K = 6,                    /* SHORT_K  */
+  YYSYMBOL_INT_K = 7,                      /* INT_K  */
+  YYSYMBOL_FLOAT_K = 8,                    /* FLOAT_K  */
+  YYSYMBOL_DOUBLE_K = 9,                   /* DOUBLE_K  */
+  YYSYMBOL_UBYTE_K = 10,                   /* UBYTE_K  */
+  YYSYMBOL_USHORT_K = 11,                  /* USHORT_K  */
+  YYSYMBOL_UINT_K = 12,                    /* UINT_K  */
+  YYSYMBOL_INT64_K = 13,                   /* INT64_K  */
+  YYSYMBOL_UINT64_K = 14,                  /* UINT64_K  */
+  YYSYMBOL_IDENT = 15,                     /* IDENT  */
+  YYSYMBOL_TERMSTRING = 16,                /* TERMSTRING  */
+  YYSYMBOL_CHAR_CONST = 17,                /* CHAR_CONST  */
+  YYSYMBOL_BYTE_CONST = 18,                /* BYTE_CONST  */
+  YYSYMBOL_SHORT_CONST = 19,               /* SHORT_CONST  */
+  YYSYMBOL_INT_CONST = 20,                 /* INT_CONST  */
+  YYSYMBOL_INT64_CONST = 21,               /* INT64_CONST  */
+  YYSYMBOL_UBYTE_CONST = 22,               /* UBYTE_CONST  */
+  YYSYMBOL_USHORT_CONST = 23,              /* USHORT_CONST  */
+  YYSYMBOL_UINT_CONST = 24,                /* UINT_CONST  */
+  YYSYMBOL_UINT64_CONST = 25,              /* UINT64_CONST  */
+  YYSYMBOL_FLOAT_CONST = 26,               /* FLOAT_CONST  */
+  YYSYMBOL_DOUBLE_CONST = 27,              /* DOUBLE_CONST  */
+  YYSYMBOL_DIMENSIONS = 28,                /* DIMENSIONS  */
+  YYSYMBOL_VARIABLES = 29,                 /* VARIABLES  */
+  YYSYMBOL_NETCDF = 30,                    /* NETCDF  */
+  YYSYMBOL_DATA = 31,                      /* DATA  */
+  YYSYMBOL_TYPES = 32,                     /* TYPES  */
+  YYSYMBOL_COMPOUND = 33,                  /* COMPOUND  */
+  YYSYMBOL_ENUM = 34,                      /* ENUM  */
+  YYSYMBOL_OPAQUE_ = 35,                   /* OPAQUE_  */
+  YYSYMBOL_OPAQUESTRING = 36,              /* OPAQUESTRING  */
+  YYSYMBOL_GROUP = 37,                     /* GROUP  */
+  YYSYMBOL_PATH = 38,                      /* PATH  */
+  YYSYMBOL_FILLMARKER = 39,                /* FILLMARKER  */
+  YYSYMBOL_NIL = 40,                       /* NIL  */
+  YYSYMBOL__FILLVALUE = 41,                /* _FILLVALUE  */
+  YYSYMBOL__FORMAT = 42,                   /* _FORMAT  */
+  YYSYMBOL__STORAGE = 43,                  /* _STORAGE  */
+  YYSYMBOL__CHUNKSIZES = 44,               /* _CHUNKSIZES  */
+  YYSYMBOL__DEFLATELEVEL = 45,             /* _DEFLATELEVEL  */
+  YYSYMBOL__SHUFFLE = 46,                  /* _SHUFFLE  */
+  YYSYMBOL__ENDIANNESS = 47,               /* _ENDIANNESS  */
+  YYSYMBOL__NOFILL = 48,                   /* _NOFILL  */
+  YYSYMBOL__FLETCHER32 = 49,               /* _FLETCHER32  */
+  YYSYMBOL__NCPROPS = 50,                  /* _NCPROPS  */
+  YYSYMBOL__ISNETCDF4 = 51,                /* _ISNETCDF4  */
+  YYSYMBOL__SUPERBLOCK = 52,               /* _SUPERBLOCK  */
+  YYSYMBOL_DATASETID = 53,                 /* DATASETID  */
+  YYSYMBOL_54_ = 54,                       /* '{'  */
+  YYSYMBOL_55_ = 55,                       /* '}'  */
+  YYSYMBOL_56_ = 56,                       /* ';'  */
+  YYSYMBOL_57_ = 57,                       /* ','  */
+  YYSYMBOL_58_ = 58,                       /* '='  */
+  YYSYMBOL_59_ = 59,                       /* '('  */
+  YYSYMBOL_60_ = 60,                       /* ')'  */
+  YYSYMBOL_61_ = 61,                       /* '*'  */
+  YYSYMBOL_62_ = 62,                       /* ':'  */
+  YYSYMBOL_YYACCEPT = 63,                  /* $accept  */
+  YYSYMBOL_ncdesc = 64,                    /* ncdesc  */
+  YYSYMBOL_datasetid = 65,                 /* datasetid  */
+  YYSYMBOL_rootgroup = 66,                 /* rootgroup  */
+  YYSYMBOL_groupbody = 67,                 /* groupbody  */
+  YYSYMBOL_subgrouplist = 68,              /* subgrouplist  */
+  YYSYMBOL_namedgroup = 69,                /* namedgroup  */
+  YYSYMBOL_70_1 = 70,                      /* $@1  */
+  YYSYMBOL_71_2 = 71,                      /* $@2  */
+  YYSYMBOL_typesection = 72,               /* typesection  */
+  YYSYMBOL_typedecls = 73,                 /* typedecls  */
+  YYSYMBOL_typename = 74,                  /* typename  */
+  YYSYMBOL_type_or_attr_decl = 75,         /* type_or_attr_decl  */
+  YYSYMBOL_typedecl = 76,                  /* typedecl  */
+  YYSYMBOL_optsemicolon = 77,              /* optsemicolon  */
+  YYSYMBOL_enumdecl = 78,                  /* enumdecl  */
+  YYSYMBOL_enumidlist = 79,                /* enumidlist  */
+  YYSYMBOL_enumid = 80,                    /* enumid  */
+  YYSYMBOL_opaquedecl = 81,                /* opaquedecl  */
+  YYSYMBOL_vlendecl = 82,                  /* vlendecl  */
+  YYSYMBOL_compounddecl = 83,              /* compounddecl  */
+  YYSYMBOL_fields = 84,                    /* fields  */
+  YYSYMBOL_field = 85,                     /* field  */
+  YYSYMBOL_primtype = 86,                  /* primtype  */
+  YYSYMBOL_dimsection = 87,                /* dimsection  */
+  YYSYMBOL_dimdecls = 88,                  /* dimdecls  */
+  YYSYMBOL_dim_or_attr_decl = 89,          /* dim_or_attr_decl  */
+  YYSYMBOL_dimdeclist = 90,                /* dimdeclist  */
+  YYSYMBOL_dimdecl = 91,                   /* dimdecl  */
+  YYSYMBOL_dimd = 92,                      /* dimd  */
+  YYSYMBOL_vasection = 93,                 /* vasection  */
+  YYSYMBOL_vadecls = 94,                   /* vadecls  */
+  YYSYMBOL_vadecl_or_attr = 95,            /* vadecl_or_attr  */
+  YYSYMBOL_vardecl = 96,                   /* vardecl  */
+  YYSYMBOL_varlist = 97,                   /* varlist  */
+  YYSYMBOL_varspec = 98,                   /* varspec  */
+  YYSYMBOL_dimspec = 99,                   /* dimspec  */
+  YYSYMBOL_dimlist = 100,                  /* dimlist  */
+  YYSYMBOL_dimref = 101,                   /* dimref  */
+  YYSYMBOL_fieldlist = 102,                /* fieldlist  */
+  YYSYMBOL_fieldspec = 103,                /* fieldspec  */
+  YYSYMBOL_fielddimspec = 104,             /* fielddimspec  */
+  YYSYMBOL_fielddimlist = 105,             /* fielddimlist  */
+  YYSYMBOL_fielddim = 106,                 /* fielddim  */
+  YYSYMBOL_varref = 107,                   /* varref  */
+  YYSYMBOL_typeref = 108,                  /* typeref  */
+  YYSYMBOL_type_var_ref = 109,             /* type_var_ref  */
+  YYSYMBOL_attrdecllist = 110,             /* attrdecllist  */
+  YYSYMBOL_attrdecl = 111,                 /* attrdecl  */
+  YYSYMBOL_path = 112,                     /* path  */
+  YYSYMBOL_datasection = 113,              /* datasection  */
+  YYSYMBOL_datadecls = 114,                /* datadecls  */
+  YYSYMBOL_datadecl = 115,                 /* datadecl  */
+  YYSYMBOL_datalist = 116,                 /* datalist  */
+  YYSYMBOL_datalist0 = 117,                /* datalist0  */
+  YYSYMBOL_datalist1 = 118,                /* datalist1  */
+  YYSYMBOL_dataitem = 119,                 /* dataitem  */
+  YYSYMBOL_constdata = 120,                /* constdata  */
+  YYSYMBOL_econstref = 121,                /* econstref  */
+  YYSYMBOL_function = 122,                 /* function  */
+  YYSYMBOL_arglist = 123,                  /* arglist  */
+  YYSYMBOL_simpleconstant = 124,           /* simpleconstant  */
+  YYSYMBOL_intlist = 125,                  /* intlist  */
+  YYSYMBOL_constint = 126,                 /* constint  */
+  YYSYMBOL_conststring = 127,              /* conststring  */
+  YYSYMBOL_constbool = 128,                /* constbool  */
+  YYSYMBOL_ident = 129                     /* ident  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE ncglval;
 
-int ncgparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_NCG_NCGEN_TAB_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 319 "ncgeny.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -350,15 +452,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -372,47 +487,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -425,8 +536,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -491,8 +616,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -501,17 +625,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -524,11 +648,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -540,12 +664,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -568,17 +692,20 @@ union yyalloc
 /* YYNSTATES -- Number of states.  */
 #define YYNSTATES  258
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   308
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -614,46 +741,53 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   218,   218,   224,   226,   233,   240,   240,   243,   252,
-     242,   257,   258,   259,   263,   263,   265,   275,   275,   278,
-     279,   280,   281,   284,   284,   287,   317,   319,   336,   345,
-     357,   371,   404,   405,   408,   422,   423,   424,   425,   426,
-     427,   428,   429,   430,   431,   432,   435,   436,   437,   440,
-     441,   444,   444,   446,   447,   451,   458,   468,   480,   481,
-     482,   485,   486,   489,   489,   491,   513,   517,   521,   548,
-     549,   552,   553,   557,   571,   575,   580,   609,   610,   614,
-     615,   620,   630,   650,   661,   672,   691,   698,   698,   701,
-     703,   705,   707,   709,   718,   729,   731,   733,   735,   737,
-     739,   741,   743,   745,   747,   752,   759,   768,   769,   770,
-     773,   774,   777,   781,   782,   786,   790,   791,   796,   797,
-     801,   802,   803,   804,   805,   806,   810,   814,   818,   820,
-     825,   826,   827,   828,   829,   830,   831,   832,   833,   834,
-     835,   836,   840,   841,   845,   847,   849,   851,   856,   860,
-     861,   867
+       0,   215,   215,   221,   223,   230,   237,   237,   240,   249,
+     239,   254,   255,   256,   260,   260,   262,   272,   272,   275,
+     276,   277,   278,   281,   281,   284,   314,   316,   333,   342,
+     354,   368,   401,   402,   405,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   432,   433,   434,   437,
+     438,   441,   441,   443,   444,   448,   455,   465,   477,   478,
+     479,   482,   483,   486,   486,   488,   510,   514,   518,   545,
+     546,   549,   550,   554,   568,   572,   577,   606,   607,   611,
+     612,   617,   627,   647,   658,   669,   688,   695,   695,   698,
+     700,   702,   704,   706,   715,   726,   728,   730,   732,   734,
+     736,   738,   740,   742,   744,   749,   756,   765,   766,   767,
+     770,   771,   774,   778,   779,   783,   787,   788,   793,   794,
+     798,   799,   800,   801,   802,   803,   807,   811,   815,   817,
+     822,   823,   824,   825,   826,   827,   828,   829,   830,   831,
+     832,   833,   837,   838,   842,   844,   846,   848,   853,   857,
+     858,   864
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 1
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "NC_UNLIMITED_K", "CHAR_K", "BYTE_K",
-  "SHORT_K", "INT_K", "FLOAT_K", "DOUBLE_K", "UBYTE_K", "USHORT_K",
-  "UINT_K", "INT64_K", "UINT64_K", "IDENT", "TERMSTRING", "CHAR_CONST",
-  "BYTE_CONST", "SHORT_CONST", "INT_CONST", "INT64_CONST", "UBYTE_CONST",
-  "USHORT_CONST", "UINT_CONST", "UINT64_CONST", "FLOAT_CONST",
-  "DOUBLE_CONST", "DIMENSIONS", "VARIABLES", "NETCDF", "DATA", "TYPES",
-  "COMPOUND", "ENUM", "OPAQUE_", "OPAQUESTRING", "GROUP", "PATH",
-  "FILLMARKER", "NIL", "_FILLVALUE", "_FORMAT", "_STORAGE", "_CHUNKSIZES",
-  "_DEFLATELEVEL", "_SHUFFLE", "_ENDIANNESS", "_NOFILL", "_FLETCHER32",
-  "_NCPROPS", "_ISNETCDF4", "_SUPERBLOCK", "DATASETID", "'{'", "'}'",
-  "';'", "','", "'='", "'('", "')'", "'*'", "':'", "$accept", "ncdesc",
-  "datasetid", "rootgroup", "groupbody", "subgrouplist", "namedgroup",
-  "$@1", "$@2", "typesection", "typedecls", "typename",
+  "\"end of file\"", "error", "\"invalid token\"", "NC_UNLIMITED_K",
+  "CHAR_K", "BYTE_K", "SHORT_K", "INT_K", "FLOAT_K", "DOUBLE_K", "UBYTE_K",
+  "USHORT_K", "UINT_K", "INT64_K", "UINT64_K", "IDENT", "TERMSTRING",
+  "CHAR_CONST", "BYTE_CONST", "SHORT_CONST", "INT_CONST", "INT64_CONST",
+  "UBYTE_CONST", "USHORT_CONST", "UINT_CONST", "UINT64_CONST",
+  "FLOAT_CONST", "DOUBLE_CONST", "DIMENSIONS", "VARIABLES", "NETCDF",
+  "DATA", "TYPES", "COMPOUND", "ENUM", "OPAQUE_", "OPAQUESTRING", "GROUP",
+  "PATH", "FILLMARKER", "NIL", "_FILLVALUE", "_FORMAT", "_STORAGE",
+  "_CHUNKSIZES", "_DEFLATELEVEL", "_SHUFFLE", "_ENDIANNESS", "_NOFILL",
+  "_FLETCHER32", "_NCPROPS", "_ISNETCDF4", "_SUPERBLOCK", "DATASETID",
+  "'{'", "'}'", "';'", "','", "'='", "'('", "')'", "'*'", "':'", "$accept",
+  "ncdesc", "datasetid", "rootgroup", "groupbody", "subgrouplist",
+  "namedgroup", "$@1", "$@2", "typesection", "typedecls", "typename",
   "type_or_attr_decl", "typedecl", "optsemicolon", "enumdecl",
   "enumidlist", "enumid", "opaquedecl", "vlendecl", "compounddecl",
   "fields", "field", "primtype", "dimsection", "dimdecls",
@@ -666,35 +800,26 @@ static const char *const yytname[] =
   "constdata", "econstref", "function", "arglist", "simpleconstant",
   "intlist", "constint", "conststring", "constbool", "ident", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   123,   125,    59,    44,    61,    40,
-      41,    42,    58
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -133
+#define YYPACT_NINF (-133)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-133)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -106
+#define YYTABLE_NINF (-106)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
      -11,   -48,    20,  -133,   -19,  -133,   210,  -133,  -133,  -133,
@@ -725,9 +850,9 @@ static const yytype_int16 yypact[] =
      -12,  -133,   210,    -2,  -133,  -133,  -133,  -133
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
        0,     0,     0,     3,     0,     1,    87,     2,    35,    36,
@@ -758,7 +883,7 @@ static const yytype_uint8 yydefact[] =
        0,    70,    87,     0,    78,    72,    10,    80
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
     -133,  -133,  -133,  -133,    28,     4,  -133,  -133,  -133,  -133,
@@ -770,10 +895,10 @@ static const yytype_int16 yypgoto[] =
     -133,  -132,  -133,   -42,   -31,   -76,   -21
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
 {
-      -1,     2,     4,     7,    22,    35,    48,   179,   242,    39,
+       0,     2,     4,     7,    22,    35,    48,   179,   242,    39,
       61,   123,    62,    63,   128,    64,   215,   216,    65,    66,
       67,   183,   184,    23,    72,   135,   136,   137,   138,   139,
      143,   168,   169,   170,   197,   198,   222,   237,   238,   211,
@@ -782,9 +907,9 @@ static const yytype_int16 yydefgoto[] =
      177,   109,   152,    81,    82,    83,    29
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
       34,    73,    84,    19,   101,     3,    36,   144,    70,    69,
@@ -869,8 +994,8 @@ static const yytype_int16 yycheck[] =
       38
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,    30,    64,    53,    65,     0,    54,    66,     4,     5,
@@ -901,7 +1026,7 @@ static const yytype_uint8 yystos[] =
       57,    60,    55,    57,    60,   101,   110,   106
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
        0,    63,    64,    65,    66,    67,    68,    68,    70,    71,
@@ -922,8 +1047,8 @@ static const yytype_uint8 yyr1[] =
      128,   129
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     3,     1,     4,     5,     0,     2,     0,     0,
        9,     0,     1,     2,     1,     2,     1,     1,     2,     2,
@@ -944,39 +1069,39 @@ static const yytype_uint8 yyr2[] =
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -993,55 +1118,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1050,7 +1172,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1073,21 +1195,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1102,8 +1224,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1126,28 +1248,76 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
 static char *
@@ -1161,10 +1331,10 @@ yystpcpy (char *yydest, const char *yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -1172,14 +1342,13 @@ yystpcpy (char *yydest, const char *yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
         switch (*++yyp)
           {
@@ -1190,7 +1359,10 @@ yytnamerr (char *yyres, const char *yystr)
           case '\\':
             if (*++yyp != '\\')
               goto do_not_strip_quotes;
-            /* Fall through.  */
+            else
+              goto append;
+
+          append:
           default:
             if (yyres)
               yyres[yyn] = *yyp;
@@ -1205,36 +1377,20 @@ yytnamerr (char *yyres, const char *yystr)
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
@@ -1258,63 +1414,78 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
   {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
   }
 
   if (*yymsg_alloc < yysize)
@@ -1323,7 +1494,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -1335,40 +1506,39 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -1377,6 +1547,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1384,43 +1556,39 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1428,71 +1596,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -1500,30 +1672,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1534,18 +1707,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1573,15 +1757,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1596,7 +1778,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -1616,75 +1798,75 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 221 "ncgen.y" /* yacc.c:1646  */
-    {if (error_count > 0) YYABORT;}
-#line 1623 "ncgeny.c" /* yacc.c:1646  */
+  case 2: /* ncdesc: NETCDF datasetid rootgroup  */
+#line 218 "ncgen.y"
+        {if (error_count > 0) YYABORT;}
+#line 1805 "ncgeny.c"
     break;
 
-  case 3:
-#line 224 "ncgen.y" /* yacc.c:1646  */
-    {createrootgroup(datasetname);}
-#line 1629 "ncgeny.c" /* yacc.c:1646  */
+  case 3: /* datasetid: DATASETID  */
+#line 221 "ncgen.y"
+                     {createrootgroup(datasetname);}
+#line 1811 "ncgeny.c"
     break;
 
-  case 8:
-#line 243 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 8: /* $@1: %empty  */
+#line 240 "ncgen.y"
+            {
 		Symbol* id = (yyvsp[-1].sym);
                 markcdf4("Group specification");
 		if(creategroup(id) == NULL)
                     yyerror("duplicate group declaration within parent group for %s",
                                 id->name);
             }
-#line 1641 "ncgeny.c" /* yacc.c:1646  */
+#line 1823 "ncgeny.c"
     break;
 
-  case 9:
-#line 252 "ncgen.y" /* yacc.c:1646  */
-    {listpop(groupstack);}
-#line 1647 "ncgeny.c" /* yacc.c:1646  */
+  case 9: /* $@2: %empty  */
+#line 249 "ncgen.y"
+            {listpop(groupstack);}
+#line 1829 "ncgeny.c"
     break;
 
-  case 12:
-#line 258 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1653 "ncgeny.c" /* yacc.c:1646  */
+  case 12: /* typesection: TYPES  */
+#line 255 "ncgen.y"
+                        {}
+#line 1835 "ncgeny.c"
     break;
 
-  case 13:
-#line 260 "ncgen.y" /* yacc.c:1646  */
-    {markcdf4("Type specification");}
-#line 1659 "ncgeny.c" /* yacc.c:1646  */
+  case 13: /* typesection: TYPES typedecls  */
+#line 257 "ncgen.y"
+                        {markcdf4("Type specification");}
+#line 1841 "ncgeny.c"
     break;
 
-  case 16:
-#line 266 "ncgen.y" /* yacc.c:1646  */
-    { /* Use when defining a type */
+  case 16: /* typename: ident  */
+#line 263 "ncgen.y"
+            { /* Use when defining a type */
               (yyvsp[0].sym)->objectclass = NC_TYPE;
               if(dupobjectcheck(NC_TYPE,(yyvsp[0].sym)))
                     yyerror("duplicate type declaration for %s",
                             (yyvsp[0].sym)->name);
               listpush(typdefs,(void*)(yyvsp[0].sym));
 	    }
-#line 1671 "ncgeny.c" /* yacc.c:1646  */
+#line 1853 "ncgeny.c"
     break;
 
-  case 17:
-#line 275 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1677 "ncgeny.c" /* yacc.c:1646  */
+  case 17: /* type_or_attr_decl: typedecl  */
+#line 272 "ncgen.y"
+                            {}
+#line 1859 "ncgeny.c"
     break;
 
-  case 18:
-#line 275 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1683 "ncgeny.c" /* yacc.c:1646  */
+  case 18: /* type_or_attr_decl: attrdecl ';'  */
+#line 272 "ncgen.y"
+                                              {}
+#line 1865 "ncgeny.c"
     break;
 
-  case 25:
-#line 289 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 25: /* enumdecl: primtype ENUM typename '{' enumidlist '}'  */
+#line 286 "ncgen.y"
+              {
 		int i;
                 addtogroup((yyvsp[-3].sym)); /* sets prefix*/
                 (yyvsp[-3].sym)->objectclass=NC_TYPE;
@@ -1710,18 +1892,18 @@ yyreduce:
                 }
                 listsetlength(stack,stackbase);/* remove stack nodes*/
               }
-#line 1714 "ncgeny.c" /* yacc.c:1646  */
+#line 1896 "ncgeny.c"
     break;
 
-  case 26:
-#line 318 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 1720 "ncgeny.c" /* yacc.c:1646  */
+  case 26: /* enumidlist: enumid  */
+#line 315 "ncgen.y"
+                {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
+#line 1902 "ncgeny.c"
     break;
 
-  case 27:
-#line 320 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 27: /* enumidlist: enumidlist ',' enumid  */
+#line 317 "ncgen.y"
+                {
 		    int i;
 		    (yyval.mark)=(yyvsp[-2].mark);
 		    /* check for duplicates*/
@@ -1735,23 +1917,23 @@ yyreduce:
 		    }
 		    listpush(stack,(void*)(yyvsp[0].sym));
 		}
-#line 1739 "ncgeny.c" /* yacc.c:1646  */
+#line 1921 "ncgeny.c"
     break;
 
-  case 28:
-#line 337 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 28: /* enumid: ident '=' constint  */
+#line 334 "ncgen.y"
+        {
             (yyvsp[-2].sym)->objectclass=NC_TYPE;
             (yyvsp[-2].sym)->subclass=NC_ECONST;
             (yyvsp[-2].sym)->typ.econst=(yyvsp[0].constant);
 	    (yyval.sym)=(yyvsp[-2].sym);
         }
-#line 1750 "ncgeny.c" /* yacc.c:1646  */
+#line 1932 "ncgeny.c"
     break;
 
-  case 29:
-#line 346 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 29: /* opaquedecl: OPAQUE_ '(' INT_CONST ')' typename  */
+#line 343 "ncgen.y"
+                {
 		    vercheck(NC_OPAQUE);
                     addtogroup((yyvsp[0].sym)); /*sets prefix*/
                     (yyvsp[0].sym)->objectclass=NC_TYPE;
@@ -1760,12 +1942,12 @@ yyreduce:
                     (yyvsp[0].sym)->typ.size=int32_val;
                     (yyvsp[0].sym)->typ.alignment=nctypealignment(NC_OPAQUE);
                 }
-#line 1764 "ncgeny.c" /* yacc.c:1646  */
+#line 1946 "ncgeny.c"
     break;
 
-  case 30:
-#line 358 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 30: /* vlendecl: typeref '(' '*' ')' typename  */
+#line 355 "ncgen.y"
+                {
                     Symbol* basetype = (yyvsp[-4].sym);
 		    vercheck(NC_VLEN);
                     addtogroup((yyvsp[0].sym)); /*sets prefix*/
@@ -1776,12 +1958,12 @@ yyreduce:
                     (yyvsp[0].sym)->typ.size=VLENSIZE;
                     (yyvsp[0].sym)->typ.alignment=nctypealignment(NC_VLEN);
                 }
-#line 1780 "ncgeny.c" /* yacc.c:1646  */
+#line 1962 "ncgeny.c"
     break;
 
-  case 31:
-#line 372 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 31: /* compounddecl: COMPOUND typename '{' fields '}'  */
+#line 369 "ncgen.y"
+          {
 	    int i,j;
 	    vercheck(NC_COMPOUND);
             addtogroup((yyvsp[-3].sym));
@@ -1810,24 +1992,24 @@ yyreduce:
 	    }
 	    listsetlength(stack,stackbase);/* remove stack nodes*/
           }
-#line 1814 "ncgeny.c" /* yacc.c:1646  */
+#line 1996 "ncgeny.c"
     break;
 
-  case 32:
-#line 404 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-1].mark);}
-#line 1820 "ncgeny.c" /* yacc.c:1646  */
+  case 32: /* fields: field ';'  */
+#line 401 "ncgen.y"
+                    {(yyval.mark)=(yyvsp[-1].mark);}
+#line 2002 "ncgeny.c"
     break;
 
-  case 33:
-#line 405 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-2].mark);}
-#line 1826 "ncgeny.c" /* yacc.c:1646  */
+  case 33: /* fields: fields field ';'  */
+#line 402 "ncgen.y"
+                              {(yyval.mark)=(yyvsp[-2].mark);}
+#line 2008 "ncgeny.c"
     break;
 
-  case 34:
-#line 409 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 34: /* field: typeref fieldlist  */
+#line 406 "ncgen.y"
+        {
 	    int i;
 	    (yyval.mark)=(yyvsp[0].mark);
 	    stackbase=(yyvsp[0].mark);
@@ -1838,125 +2020,125 @@ yyreduce:
 		f->typ.basetype = (yyvsp[-1].sym);
             }
         }
-#line 1842 "ncgeny.c" /* yacc.c:1646  */
+#line 2024 "ncgeny.c"
     break;
 
-  case 35:
-#line 422 "ncgen.y" /* yacc.c:1646  */
-    { (yyval.sym) = primsymbols[NC_CHAR]; }
-#line 1848 "ncgeny.c" /* yacc.c:1646  */
+  case 35: /* primtype: CHAR_K  */
+#line 419 "ncgen.y"
+                          { (yyval.sym) = primsymbols[NC_CHAR]; }
+#line 2030 "ncgeny.c"
     break;
 
-  case 36:
-#line 423 "ncgen.y" /* yacc.c:1646  */
-    { (yyval.sym) = primsymbols[NC_BYTE]; }
-#line 1854 "ncgeny.c" /* yacc.c:1646  */
+  case 36: /* primtype: BYTE_K  */
+#line 420 "ncgen.y"
+                          { (yyval.sym) = primsymbols[NC_BYTE]; }
+#line 2036 "ncgeny.c"
     break;
 
-  case 37:
-#line 424 "ncgen.y" /* yacc.c:1646  */
-    { (yyval.sym) = primsymbols[NC_SHORT]; }
-#line 1860 "ncgeny.c" /* yacc.c:1646  */
+  case 37: /* primtype: SHORT_K  */
+#line 421 "ncgen.y"
+                          { (yyval.sym) = primsymbols[NC_SHORT]; }
+#line 2042 "ncgeny.c"
     break;
 
-  case 38:
-#line 425 "ncgen.y" /* yacc.c:1646  */
-    { (yyval.sym) = primsymbols[NC_INT]; }
-#line 1866 "ncgeny.c" /* yacc.c:1646  */
+  case 38: /* primtype: INT_K  */
+#line 422 "ncgen.y"
+                          { (yyval.sym) = primsymbols[NC_INT]; }
+#line 2048 "ncgeny.c"
     break;
 
-  case 39:
-#line 426 "ncgen.y" /* yacc.c:1646  */
-    { (yyval.sym) = primsymbols[NC_FLOAT]; }
-#line 1872 "ncgeny.c" /* yacc.c:1646  */
+  case 39: /* primtype: FLOAT_K  */
+#line 423 "ncgen.y"
+                          { (yyval.sym) = primsymbols[NC_FLOAT]; }
+#line 2054 "ncgeny.c"
     break;
 
-  case 40:
-#line 427 "ncgen.y" /* yacc.c:1646  */
-    { (yyval.sym) = primsymbols[NC_DOUBLE]; }
-#line 1878 "ncgeny.c" /* yacc.c:1646  */
+  case 40: /* primtype: DOUBLE_K  */
+#line 424 "ncgen.y"
+                          { (yyval.sym) = primsymbols[NC_DOUBLE]; }
+#line 2060 "ncgeny.c"
     break;
 
-  case 41:
-#line 428 "ncgen.y" /* yacc.c:1646  */
-    { vercheck(NC_UBYTE); (yyval.sym) = primsymbols[NC_UBYTE]; }
-#line 1884 "ncgeny.c" /* yacc.c:1646  */
+  case 41: /* primtype: UBYTE_K  */
+#line 425 "ncgen.y"
+                           { vercheck(NC_UBYTE); (yyval.sym) = primsymbols[NC_UBYTE]; }
+#line 2066 "ncgeny.c"
     break;
 
-  case 42:
-#line 429 "ncgen.y" /* yacc.c:1646  */
-    { vercheck(NC_USHORT); (yyval.sym) = primsymbols[NC_USHORT]; }
-#line 1890 "ncgeny.c" /* yacc.c:1646  */
+  case 42: /* primtype: USHORT_K  */
+#line 426 "ncgen.y"
+                           { vercheck(NC_USHORT); (yyval.sym) = primsymbols[NC_USHORT]; }
+#line 2072 "ncgeny.c"
     break;
 
-  case 43:
-#line 430 "ncgen.y" /* yacc.c:1646  */
-    { vercheck(NC_UINT); (yyval.sym) = primsymbols[NC_UINT]; }
-#line 1896 "ncgeny.c" /* yacc.c:1646  */
+  case 43: /* primtype: UINT_K  */
+#line 427 "ncgen.y"
+                           { vercheck(NC_UINT); (yyval.sym) = primsymbols[NC_UINT]; }
+#line 2078 "ncgeny.c"
     break;
 
-  case 44:
-#line 431 "ncgen.y" /* yacc.c:1646  */
-    { vercheck(NC_INT64); (yyval.sym) = primsymbols[NC_INT64]; }
-#line 1902 "ncgeny.c" /* yacc.c:1646  */
+  case 44: /* primtype: INT64_K  */
+#line 428 "ncgen.y"
+                            { vercheck(NC_INT64); (yyval.sym) = primsymbols[NC_INT64]; }
+#line 2084 "ncgeny.c"
     break;
 
-  case 45:
-#line 432 "ncgen.y" /* yacc.c:1646  */
-    { vercheck(NC_UINT64); (yyval.sym) = primsymbols[NC_UINT64]; }
-#line 1908 "ncgeny.c" /* yacc.c:1646  */
+  case 45: /* primtype: UINT64_K  */
+#line 429 "ncgen.y"
+                             { vercheck(NC_UINT64); (yyval.sym) = primsymbols[NC_UINT64]; }
+#line 2090 "ncgeny.c"
     break;
 
-  case 47:
-#line 436 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1914 "ncgeny.c" /* yacc.c:1646  */
+  case 47: /* dimsection: DIMENSIONS  */
+#line 433 "ncgen.y"
+                             {}
+#line 2096 "ncgeny.c"
     break;
 
-  case 48:
-#line 437 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1920 "ncgeny.c" /* yacc.c:1646  */
+  case 48: /* dimsection: DIMENSIONS dimdecls  */
+#line 434 "ncgen.y"
+                                      {}
+#line 2102 "ncgeny.c"
     break;
 
-  case 51:
-#line 444 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1926 "ncgeny.c" /* yacc.c:1646  */
+  case 51: /* dim_or_attr_decl: dimdeclist  */
+#line 441 "ncgen.y"
+                             {}
+#line 2108 "ncgeny.c"
     break;
 
-  case 52:
-#line 444 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1932 "ncgeny.c" /* yacc.c:1646  */
+  case 52: /* dim_or_attr_decl: attrdecl  */
+#line 441 "ncgen.y"
+                                           {}
+#line 2114 "ncgeny.c"
     break;
 
-  case 55:
-#line 452 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 55: /* dimdecl: dimd '=' constint  */
+#line 449 "ncgen.y"
+              {
 		(yyvsp[-2].sym)->dim.declsize = (size_t)extractint((yyvsp[0].constant));
 #ifdef GENDEBUG1
 fprintf(stderr,"dimension: %s = %llu\n",(yyvsp[-2].sym)->name,(unsigned long long)(yyvsp[-2].sym)->dim.declsize);
 #endif
 	      }
-#line 1943 "ncgeny.c" /* yacc.c:1646  */
+#line 2125 "ncgeny.c"
     break;
 
-  case 56:
-#line 459 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 56: /* dimdecl: dimd '=' NC_UNLIMITED_K  */
+#line 456 "ncgen.y"
+                   {
 		        (yyvsp[-2].sym)->dim.declsize = NC_UNLIMITED;
 		        (yyvsp[-2].sym)->dim.isunlimited = 1;
 #ifdef GENDEBUG1
 fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 #endif
 		   }
-#line 1955 "ncgeny.c" /* yacc.c:1646  */
+#line 2137 "ncgeny.c"
     break;
 
-  case 57:
-#line 469 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 57: /* dimd: ident  */
+#line 466 "ncgen.y"
+                   {
                      (yyvsp[0].sym)->objectclass=NC_DIM;
                      if(dupobjectcheck(NC_DIM,(yyvsp[0].sym)))
                         yyerror( "Duplicate dimension declaration for %s",
@@ -1965,36 +2147,36 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		     (yyval.sym)=(yyvsp[0].sym);
 		     listpush(dimdefs,(void*)(yyvsp[0].sym));
                    }
-#line 1969 "ncgeny.c" /* yacc.c:1646  */
+#line 2151 "ncgeny.c"
     break;
 
-  case 59:
-#line 481 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1975 "ncgeny.c" /* yacc.c:1646  */
+  case 59: /* vasection: VARIABLES  */
+#line 478 "ncgen.y"
+                            {}
+#line 2157 "ncgeny.c"
     break;
 
-  case 60:
-#line 482 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1981 "ncgeny.c" /* yacc.c:1646  */
+  case 60: /* vasection: VARIABLES vadecls  */
+#line 479 "ncgen.y"
+                                    {}
+#line 2163 "ncgeny.c"
     break;
 
-  case 63:
-#line 489 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1987 "ncgeny.c" /* yacc.c:1646  */
+  case 63: /* vadecl_or_attr: vardecl  */
+#line 486 "ncgen.y"
+                        {}
+#line 2169 "ncgeny.c"
     break;
 
-  case 64:
-#line 489 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 1993 "ncgeny.c" /* yacc.c:1646  */
+  case 64: /* vadecl_or_attr: attrdecl  */
+#line 486 "ncgen.y"
+                                      {}
+#line 2175 "ncgeny.c"
     break;
 
-  case 65:
-#line 492 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 65: /* vardecl: typeref varlist  */
+#line 489 "ncgen.y"
+                {
 		    int i;
 		    stackbase=(yyvsp[0].mark);
 		    stacklen=listlength(stack);
@@ -2013,26 +2195,26 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		    }
 		    listsetlength(stack,stackbase);/* remove stack nodes*/
 		}
-#line 2017 "ncgeny.c" /* yacc.c:1646  */
+#line 2199 "ncgeny.c"
     break;
 
-  case 66:
-#line 514 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=listlength(stack);
+  case 66: /* varlist: varspec  */
+#line 511 "ncgen.y"
+                {(yyval.mark)=listlength(stack);
                  listpush(stack,(void*)(yyvsp[0].sym));
 		}
-#line 2025 "ncgeny.c" /* yacc.c:1646  */
+#line 2207 "ncgeny.c"
     break;
 
-  case 67:
-#line 518 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2031 "ncgeny.c" /* yacc.c:1646  */
+  case 67: /* varlist: varlist ',' varspec  */
+#line 515 "ncgen.y"
+                {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
+#line 2213 "ncgeny.c"
     break;
 
-  case 68:
-#line 522 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 68: /* varspec: ident dimspec  */
+#line 519 "ncgen.y"
+                    {
 		    int i;
 		    Dimset dimset;
 		    stacklen=listlength(stack);
@@ -2056,36 +2238,36 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
                     (yyvsp[-1].sym)->objectclass=NC_VAR;
 		    listsetlength(stack,stackbase);/* remove stack nodes*/
 		    }
-#line 2060 "ncgeny.c" /* yacc.c:1646  */
+#line 2242 "ncgeny.c"
     break;
 
-  case 69:
-#line 548 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=listlength(stack);}
-#line 2066 "ncgeny.c" /* yacc.c:1646  */
+  case 69: /* dimspec: %empty  */
+#line 545 "ncgen.y"
+                            {(yyval.mark)=listlength(stack);}
+#line 2248 "ncgeny.c"
     break;
 
-  case 70:
-#line 549 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-1].mark);}
-#line 2072 "ncgeny.c" /* yacc.c:1646  */
+  case 70: /* dimspec: '(' dimlist ')'  */
+#line 546 "ncgen.y"
+                                  {(yyval.mark)=(yyvsp[-1].mark);}
+#line 2254 "ncgeny.c"
     break;
 
-  case 71:
-#line 552 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2078 "ncgeny.c" /* yacc.c:1646  */
+  case 71: /* dimlist: dimref  */
+#line 549 "ncgen.y"
+                       {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
+#line 2260 "ncgeny.c"
     break;
 
-  case 72:
-#line 554 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2084 "ncgeny.c" /* yacc.c:1646  */
+  case 72: /* dimlist: dimlist ',' dimref  */
+#line 551 "ncgen.y"
+                    {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
+#line 2266 "ncgeny.c"
     break;
 
-  case 73:
-#line 558 "ncgen.y" /* yacc.c:1646  */
-    {Symbol* dimsym = (yyvsp[0].sym);
+  case 73: /* dimref: path  */
+#line 555 "ncgen.y"
+            {Symbol* dimsym = (yyvsp[0].sym);
 		dimsym->objectclass = NC_DIM;
 		/* Find the actual dimension*/
 		dimsym = locate(dimsym);
@@ -2095,26 +2277,26 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		}
 		(yyval.sym)=dimsym;
 	    }
-#line 2099 "ncgeny.c" /* yacc.c:1646  */
+#line 2281 "ncgeny.c"
     break;
 
-  case 74:
-#line 572 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=listlength(stack);
+  case 74: /* fieldlist: fieldspec  */
+#line 569 "ncgen.y"
+            {(yyval.mark)=listlength(stack);
              listpush(stack,(void*)(yyvsp[0].sym));
 	    }
-#line 2107 "ncgeny.c" /* yacc.c:1646  */
+#line 2289 "ncgeny.c"
     break;
 
-  case 75:
-#line 576 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2113 "ncgeny.c" /* yacc.c:1646  */
+  case 75: /* fieldlist: fieldlist ',' fieldspec  */
+#line 573 "ncgen.y"
+            {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
+#line 2295 "ncgeny.c"
     break;
 
-  case 76:
-#line 581 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 76: /* fieldspec: ident fielddimspec  */
+#line 578 "ncgen.y"
+            {
 		int i;
 		Dimset dimset;
 		stackbase=(yyvsp[0].mark);
@@ -2140,36 +2322,36 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		listsetlength(stack,stackbase);/* remove stack nodes*/
 		(yyval.sym) = (yyvsp[-1].sym);
 	    }
-#line 2144 "ncgeny.c" /* yacc.c:1646  */
+#line 2326 "ncgeny.c"
     break;
 
-  case 77:
-#line 609 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=listlength(stack);}
-#line 2150 "ncgeny.c" /* yacc.c:1646  */
+  case 77: /* fielddimspec: %empty  */
+#line 606 "ncgen.y"
+                                 {(yyval.mark)=listlength(stack);}
+#line 2332 "ncgeny.c"
     break;
 
-  case 78:
-#line 610 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-1].mark);}
-#line 2156 "ncgeny.c" /* yacc.c:1646  */
+  case 78: /* fielddimspec: '(' fielddimlist ')'  */
+#line 607 "ncgen.y"
+                                       {(yyval.mark)=(yyvsp[-1].mark);}
+#line 2338 "ncgeny.c"
     break;
 
-  case 79:
-#line 614 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2162 "ncgeny.c" /* yacc.c:1646  */
+  case 79: /* fielddimlist: fielddim  */
+#line 611 "ncgen.y"
+                   {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
+#line 2344 "ncgeny.c"
     break;
 
-  case 80:
-#line 616 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2168 "ncgeny.c" /* yacc.c:1646  */
+  case 80: /* fielddimlist: fielddimlist ',' fielddim  */
+#line 613 "ncgen.y"
+            {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
+#line 2350 "ncgeny.c"
     break;
 
-  case 81:
-#line 621 "ncgen.y" /* yacc.c:1646  */
-    {  /* Anonymous integer dimension.
+  case 81: /* fielddim: UINT_CONST  */
+#line 618 "ncgen.y"
+            {  /* Anonymous integer dimension.
 	         Can only occur in type definitions*/
 	     char anon[32];
 	     sprintf(anon,"const%u",uint32_val);
@@ -2178,12 +2360,12 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 	     (yyval.sym)->dim.isconstant = 1;
 	     (yyval.sym)->dim.declsize = uint32_val;
 	    }
-#line 2182 "ncgeny.c" /* yacc.c:1646  */
+#line 2364 "ncgeny.c"
     break;
 
-  case 82:
-#line 631 "ncgen.y" /* yacc.c:1646  */
-    {  /* Anonymous integer dimension.
+  case 82: /* fielddim: INT_CONST  */
+#line 628 "ncgen.y"
+            {  /* Anonymous integer dimension.
 	         Can only occur in type definitions*/
 	     char anon[32];
 	     if(int32_val <= 0) {
@@ -2196,36 +2378,36 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 	     (yyval.sym)->dim.isconstant = 1;
 	     (yyval.sym)->dim.declsize = int32_val;
 	    }
-#line 2200 "ncgeny.c" /* yacc.c:1646  */
+#line 2382 "ncgeny.c"
     break;
 
-  case 83:
-#line 651 "ncgen.y" /* yacc.c:1646  */
-    {Symbol* vsym = (yyvsp[0].sym);
+  case 83: /* varref: type_var_ref  */
+#line 648 "ncgen.y"
+            {Symbol* vsym = (yyvsp[0].sym);
 		if(vsym->objectclass != NC_VAR) {
 		    derror("Undefined or forward referenced variable: %s",vsym->name);
 		    YYABORT;
 		}
-		(yyval.sym)=vsym;
+		spoolbegin(vsym); (yyval.sym)=vsym;
 	    }
-#line 2212 "ncgeny.c" /* yacc.c:1646  */
+#line 2394 "ncgeny.c"
     break;
 
-  case 84:
-#line 662 "ncgen.y" /* yacc.c:1646  */
-    {Symbol* tsym = (yyvsp[0].sym);
+  case 84: /* typeref: type_var_ref  */
+#line 659 "ncgen.y"
+            {Symbol* tsym = (yyvsp[0].sym);
 		if(tsym->objectclass != NC_TYPE) {
 		    derror("Undefined or forward referenced type: %s",tsym->name);
 		    YYABORT;
 		}
 		(yyval.sym)=tsym;
 	    }
-#line 2224 "ncgeny.c" /* yacc.c:1646  */
+#line 2406 "ncgeny.c"
     break;
 
-  case 85:
-#line 673 "ncgen.y" /* yacc.c:1646  */
-    {Symbol* tvsym = (yyvsp[0].sym); Symbol* sym;
+  case 85: /* type_var_ref: path  */
+#line 670 "ncgen.y"
+            {Symbol* tvsym = (yyvsp[0].sym); Symbol* sym;
 		/* disambiguate*/
 		tvsym->objectclass = NC_VAR;
 		sym = locate(tvsym);
@@ -2243,54 +2425,54 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		}
 		(yyval.sym)=tvsym;
 	    }
-#line 2247 "ncgeny.c" /* yacc.c:1646  */
+#line 2429 "ncgeny.c"
     break;
 
-  case 86:
-#line 691 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym)=(yyvsp[0].sym);}
-#line 2253 "ncgeny.c" /* yacc.c:1646  */
+  case 86: /* type_var_ref: primtype  */
+#line 688 "ncgen.y"
+                   {(yyval.sym)=(yyvsp[0].sym);}
+#line 2435 "ncgeny.c"
     break;
 
-  case 87:
-#line 698 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 2259 "ncgeny.c" /* yacc.c:1646  */
+  case 87: /* attrdecllist: %empty  */
+#line 695 "ncgen.y"
+                        {}
+#line 2441 "ncgeny.c"
     break;
 
-  case 88:
-#line 698 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 2265 "ncgeny.c" /* yacc.c:1646  */
+  case 88: /* attrdecllist: attrdecl ';' attrdecllist  */
+#line 695 "ncgen.y"
+                                                       {}
+#line 2447 "ncgeny.c"
     break;
 
-  case 89:
-#line 702 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_NCPROPS_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),ATTRGLOBAL);}
-#line 2271 "ncgeny.c" /* yacc.c:1646  */
+  case 89: /* attrdecl: ':' _NCPROPS '=' conststring  */
+#line 699 "ncgen.y"
+            {(yyval.sym) = makespecial(_NCPROPS_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),ATTRGLOBAL);}
+#line 2453 "ncgeny.c"
     break;
 
-  case 90:
-#line 704 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_ISNETCDF4_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),ATTRGLOBAL);}
-#line 2277 "ncgeny.c" /* yacc.c:1646  */
+  case 90: /* attrdecl: ':' _ISNETCDF4 '=' constbool  */
+#line 701 "ncgen.y"
+            {(yyval.sym) = makespecial(_ISNETCDF4_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),ATTRGLOBAL);}
+#line 2459 "ncgeny.c"
     break;
 
-  case 91:
-#line 706 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_SUPERBLOCK_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),ATTRGLOBAL);}
-#line 2283 "ncgeny.c" /* yacc.c:1646  */
+  case 91: /* attrdecl: ':' _SUPERBLOCK '=' constint  */
+#line 703 "ncgen.y"
+            {(yyval.sym) = makespecial(_SUPERBLOCK_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),ATTRGLOBAL);}
+#line 2465 "ncgeny.c"
     break;
 
-  case 92:
-#line 708 "ncgen.y" /* yacc.c:1646  */
-    { (yyval.sym)=makeattribute((yyvsp[-2].sym),NULL,NULL,(yyvsp[0].datalist),ATTRGLOBAL);}
-#line 2289 "ncgeny.c" /* yacc.c:1646  */
+  case 92: /* attrdecl: ':' ident '=' datalist  */
+#line 705 "ncgen.y"
+            { (yyval.sym)=makeattribute((yyvsp[-2].sym),NULL,NULL,(yyvsp[0].datalist),ATTRGLOBAL);}
+#line 2471 "ncgeny.c"
     break;
 
-  case 93:
-#line 710 "ncgen.y" /* yacc.c:1646  */
-    {Symbol* tsym = (yyvsp[-5].sym); Symbol* vsym = (yyvsp[-4].sym); Symbol* asym = (yyvsp[-2].sym);
+  case 93: /* attrdecl: typeref type_var_ref ':' ident '=' datalist  */
+#line 707 "ncgen.y"
+            {Symbol* tsym = (yyvsp[-5].sym); Symbol* vsym = (yyvsp[-4].sym); Symbol* asym = (yyvsp[-2].sym);
 		if(vsym->objectclass == NC_VAR) {
 		    (yyval.sym)=makeattribute(asym,vsym,tsym,(yyvsp[0].datalist),ATTRVAR);
 		} else {
@@ -2298,12 +2480,12 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		    YYABORT;
 		}
 	    }
-#line 2302 "ncgeny.c" /* yacc.c:1646  */
+#line 2484 "ncgeny.c"
     break;
 
-  case 94:
-#line 719 "ncgen.y" /* yacc.c:1646  */
-    {Symbol* sym = (yyvsp[-4].sym); Symbol* asym = (yyvsp[-2].sym);
+  case 94: /* attrdecl: type_var_ref ':' ident '=' datalist  */
+#line 716 "ncgen.y"
+            {Symbol* sym = (yyvsp[-4].sym); Symbol* asym = (yyvsp[-2].sym);
 		if(sym->objectclass == NC_VAR) {
 		    (yyval.sym)=makeattribute(asym,sym,NULL,(yyvsp[0].datalist),ATTRVAR);
 		} else if(sym->objectclass == NC_TYPE) {
@@ -2313,339 +2495,340 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		    YYABORT;
 		}
 	    }
-#line 2317 "ncgeny.c" /* yacc.c:1646  */
+#line 2499 "ncgeny.c"
     break;
 
-  case 95:
-#line 730 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_FILLVALUE_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].datalist),0);}
-#line 2323 "ncgeny.c" /* yacc.c:1646  */
+  case 95: /* attrdecl: type_var_ref ':' _FILLVALUE '=' datalist  */
+#line 727 "ncgen.y"
+            {(yyval.sym) = makespecial(_FILLVALUE_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].datalist),0);}
+#line 2505 "ncgeny.c"
     break;
 
-  case 96:
-#line 732 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_FILLVALUE_FLAG,(yyvsp[-4].sym),(yyvsp[-5].sym),(void*)(yyvsp[0].datalist),0);}
-#line 2329 "ncgeny.c" /* yacc.c:1646  */
+  case 96: /* attrdecl: typeref type_var_ref ':' _FILLVALUE '=' datalist  */
+#line 729 "ncgen.y"
+            {(yyval.sym) = makespecial(_FILLVALUE_FLAG,(yyvsp[-4].sym),(yyvsp[-5].sym),(void*)(yyvsp[0].datalist),0);}
+#line 2511 "ncgeny.c"
     break;
 
-  case 97:
-#line 734 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_STORAGE_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
-#line 2335 "ncgeny.c" /* yacc.c:1646  */
+  case 97: /* attrdecl: type_var_ref ':' _STORAGE '=' conststring  */
+#line 731 "ncgen.y"
+            {(yyval.sym) = makespecial(_STORAGE_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
+#line 2517 "ncgeny.c"
     break;
 
-  case 98:
-#line 736 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_CHUNKSIZES_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].datalist),0);}
-#line 2341 "ncgeny.c" /* yacc.c:1646  */
+  case 98: /* attrdecl: type_var_ref ':' _CHUNKSIZES '=' intlist  */
+#line 733 "ncgen.y"
+            {(yyval.sym) = makespecial(_CHUNKSIZES_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].datalist),0);}
+#line 2523 "ncgeny.c"
     break;
 
-  case 99:
-#line 738 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_FLETCHER32_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
-#line 2347 "ncgeny.c" /* yacc.c:1646  */
+  case 99: /* attrdecl: type_var_ref ':' _FLETCHER32 '=' constbool  */
+#line 735 "ncgen.y"
+            {(yyval.sym) = makespecial(_FLETCHER32_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
+#line 2529 "ncgeny.c"
     break;
 
-  case 100:
-#line 740 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_DEFLATE_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
-#line 2353 "ncgeny.c" /* yacc.c:1646  */
+  case 100: /* attrdecl: type_var_ref ':' _DEFLATELEVEL '=' constint  */
+#line 737 "ncgen.y"
+            {(yyval.sym) = makespecial(_DEFLATE_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
+#line 2535 "ncgeny.c"
     break;
 
-  case 101:
-#line 742 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_SHUFFLE_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
-#line 2359 "ncgeny.c" /* yacc.c:1646  */
+  case 101: /* attrdecl: type_var_ref ':' _SHUFFLE '=' constbool  */
+#line 739 "ncgen.y"
+            {(yyval.sym) = makespecial(_SHUFFLE_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
+#line 2541 "ncgeny.c"
     break;
 
-  case 102:
-#line 744 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_ENDIAN_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
-#line 2365 "ncgeny.c" /* yacc.c:1646  */
+  case 102: /* attrdecl: type_var_ref ':' _ENDIANNESS '=' conststring  */
+#line 741 "ncgen.y"
+            {(yyval.sym) = makespecial(_ENDIAN_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
+#line 2547 "ncgeny.c"
     break;
 
-  case 103:
-#line 746 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_NOFILL_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
-#line 2371 "ncgeny.c" /* yacc.c:1646  */
+  case 103: /* attrdecl: type_var_ref ':' _NOFILL '=' constbool  */
+#line 743 "ncgen.y"
+            {(yyval.sym) = makespecial(_NOFILL_FLAG,(yyvsp[-4].sym),NULL,(void*)&(yyvsp[0].constant),1);}
+#line 2553 "ncgeny.c"
     break;
 
-  case 104:
-#line 748 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym) = makespecial(_FORMAT_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),1);}
-#line 2377 "ncgeny.c" /* yacc.c:1646  */
+  case 104: /* attrdecl: ':' _FORMAT '=' conststring  */
+#line 745 "ncgen.y"
+            {(yyval.sym) = makespecial(_FORMAT_FLAG,NULL,NULL,(void*)&(yyvsp[0].constant),1);}
+#line 2559 "ncgeny.c"
     break;
 
-  case 105:
-#line 753 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 105: /* path: ident  */
+#line 750 "ncgen.y"
+            {
 	        (yyval.sym)=(yyvsp[0].sym);
                 (yyvsp[0].sym)->ref.is_ref=1;
                 (yyvsp[0].sym)->is_prefixed=0;
                 setpathcurrent((yyvsp[0].sym));
 	    }
-#line 2388 "ncgeny.c" /* yacc.c:1646  */
+#line 2570 "ncgeny.c"
     break;
 
-  case 106:
-#line 760 "ncgen.y" /* yacc.c:1646  */
-    {
+  case 106: /* path: PATH  */
+#line 757 "ncgen.y"
+            {
 	        (yyval.sym)=(yyvsp[0].sym);
                 (yyvsp[0].sym)->ref.is_ref=1;
                 (yyvsp[0].sym)->is_prefixed=1;
 	        /* path is set in ncgen.l*/
 	    }
-#line 2399 "ncgeny.c" /* yacc.c:1646  */
+#line 2581 "ncgeny.c"
     break;
 
-  case 108:
-#line 769 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 2405 "ncgeny.c" /* yacc.c:1646  */
+  case 108: /* datasection: DATA  */
+#line 766 "ncgen.y"
+                       {}
+#line 2587 "ncgeny.c"
     break;
 
-  case 109:
-#line 770 "ncgen.y" /* yacc.c:1646  */
-    {}
-#line 2411 "ncgeny.c" /* yacc.c:1646  */
+  case 109: /* datasection: DATA datadecls  */
+#line 767 "ncgen.y"
+                                 {}
+#line 2593 "ncgeny.c"
     break;
 
-  case 112:
-#line 778 "ncgen.y" /* yacc.c:1646  */
-    {(yyvsp[-2].sym)->data = (yyvsp[0].datalist);}
-#line 2417 "ncgeny.c" /* yacc.c:1646  */
+  case 112: /* datadecl: varref '=' datalist  */
+#line 775 "ncgen.y"
+                   {(yyvsp[-2].sym)->data = (yyvsp[0].datalist); spoolend((yyvsp[-2].sym));}
+#line 2599 "ncgeny.c"
     break;
 
-  case 113:
-#line 781 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.datalist) = (yyvsp[0].datalist);}
-#line 2423 "ncgeny.c" /* yacc.c:1646  */
+  case 113: /* datalist: datalist0  */
+#line 778 "ncgen.y"
+                    {(yyval.datalist) = (yyvsp[0].datalist);}
+#line 2605 "ncgeny.c"
     break;
 
-  case 114:
-#line 782 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.datalist) = (yyvsp[0].datalist);}
-#line 2429 "ncgeny.c" /* yacc.c:1646  */
+  case 114: /* datalist: datalist1  */
+#line 779 "ncgen.y"
+                    {(yyval.datalist) = (yyvsp[0].datalist);}
+#line 2611 "ncgeny.c"
     break;
 
-  case 115:
-#line 786 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.datalist) = builddatalist(0);}
-#line 2435 "ncgeny.c" /* yacc.c:1646  */
+  case 115: /* datalist0: %empty  */
+#line 783 "ncgen.y"
+                  {(yyval.datalist) = builddatalist(0);}
+#line 2617 "ncgeny.c"
     break;
 
-  case 116:
-#line 790 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.datalist) = builddatalist(0); datalistextend((yyval.datalist),&((yyvsp[0].constant)));}
-#line 2441 "ncgeny.c" /* yacc.c:1646  */
+  case 116: /* datalist1: dataitem  */
+#line 787 "ncgen.y"
+                   {(yyval.datalist) = builddatalist(0); datalistextend((yyval.datalist),&((yyvsp[0].constant)));}
+#line 2623 "ncgeny.c"
     break;
 
-  case 117:
-#line 792 "ncgen.y" /* yacc.c:1646  */
-    {datalistextend((yyvsp[-2].datalist),&((yyvsp[0].constant))); (yyval.datalist)=(yyvsp[-2].datalist);}
-#line 2447 "ncgeny.c" /* yacc.c:1646  */
+  case 117: /* datalist1: datalist ',' dataitem  */
+#line 789 "ncgen.y"
+            {datalistextend((yyvsp[-2].datalist),&((yyvsp[0].constant))); (yyval.datalist)=(yyvsp[-2].datalist);}
+#line 2629 "ncgeny.c"
     break;
 
-  case 118:
-#line 796 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=(yyvsp[0].constant);}
-#line 2453 "ncgeny.c" /* yacc.c:1646  */
+  case 118: /* dataitem: constdata  */
+#line 793 "ncgen.y"
+                    {(yyval.constant)=(yyvsp[0].constant);}
+#line 2635 "ncgeny.c"
     break;
 
-  case 119:
-#line 797 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=builddatasublist((yyvsp[-1].datalist));}
-#line 2459 "ncgeny.c" /* yacc.c:1646  */
+  case 119: /* dataitem: '{' datalist '}'  */
+#line 794 "ncgen.y"
+                           {(yyval.constant)=builddatasublist((yyvsp[-1].datalist));}
+#line 2641 "ncgeny.c"
     break;
 
-  case 120:
-#line 801 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=(yyvsp[0].constant);}
-#line 2465 "ncgeny.c" /* yacc.c:1646  */
+  case 120: /* constdata: simpleconstant  */
+#line 798 "ncgen.y"
+                              {(yyval.constant)=(yyvsp[0].constant);}
+#line 2647 "ncgeny.c"
     break;
 
-  case 121:
-#line 802 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_OPAQUE);}
-#line 2471 "ncgeny.c" /* yacc.c:1646  */
+  case 121: /* constdata: OPAQUESTRING  */
+#line 799 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_OPAQUE);}
+#line 2653 "ncgeny.c"
     break;
 
-  case 122:
-#line 803 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_FILLVALUE);}
-#line 2477 "ncgeny.c" /* yacc.c:1646  */
+  case 122: /* constdata: FILLMARKER  */
+#line 800 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_FILLVALUE);}
+#line 2659 "ncgeny.c"
     break;
 
-  case 123:
-#line 804 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_NIL);}
-#line 2483 "ncgeny.c" /* yacc.c:1646  */
+  case 123: /* constdata: NIL  */
+#line 801 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_NIL);}
+#line 2665 "ncgeny.c"
     break;
 
-  case 124:
-#line 805 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=(yyvsp[0].constant);}
-#line 2489 "ncgeny.c" /* yacc.c:1646  */
+  case 124: /* constdata: econstref  */
+#line 802 "ncgen.y"
+                        {(yyval.constant)=(yyvsp[0].constant);}
+#line 2671 "ncgeny.c"
     break;
 
-  case 126:
-#line 810 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant) = makeenumconstref((yyvsp[0].sym));}
-#line 2495 "ncgeny.c" /* yacc.c:1646  */
+  case 126: /* econstref: path  */
+#line 807 "ncgen.y"
+             {(yyval.constant) = makeenumconstref((yyvsp[0].sym));}
+#line 2677 "ncgeny.c"
     break;
 
-  case 127:
-#line 814 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=evaluate((yyvsp[-3].sym),(yyvsp[-1].datalist));}
-#line 2501 "ncgeny.c" /* yacc.c:1646  */
+  case 127: /* function: ident '(' arglist ')'  */
+#line 811 "ncgen.y"
+                              {(yyval.constant)=evaluate((yyvsp[-3].sym),(yyvsp[-1].datalist));}
+#line 2683 "ncgeny.c"
     break;
 
-  case 128:
-#line 819 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.datalist) = builddatalist(0); datalistextend((yyval.datalist),&((yyvsp[0].constant)));}
-#line 2507 "ncgeny.c" /* yacc.c:1646  */
+  case 128: /* arglist: simpleconstant  */
+#line 816 "ncgen.y"
+            {(yyval.datalist) = builddatalist(0); dlappend((yyval.datalist),&((yyvsp[0].constant)));}
+#line 2689 "ncgeny.c"
     break;
 
-  case 129:
-#line 821 "ncgen.y" /* yacc.c:1646  */
-    {datalistextend((yyvsp[-2].datalist),&((yyvsp[0].constant))); (yyval.datalist)=(yyvsp[-2].datalist);}
-#line 2513 "ncgeny.c" /* yacc.c:1646  */
+  case 129: /* arglist: arglist ',' simpleconstant  */
+#line 818 "ncgen.y"
+            {dlappend((yyvsp[-2].datalist),&((yyvsp[0].constant))); (yyval.datalist)=(yyvsp[-2].datalist);}
+#line 2695 "ncgeny.c"
     break;
 
-  case 130:
-#line 825 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_CHAR);}
-#line 2519 "ncgeny.c" /* yacc.c:1646  */
+  case 130: /* simpleconstant: CHAR_CONST  */
+#line 822 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_CHAR);}
+#line 2701 "ncgeny.c"
     break;
 
-  case 131:
-#line 826 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_BYTE);}
-#line 2525 "ncgeny.c" /* yacc.c:1646  */
+  case 131: /* simpleconstant: BYTE_CONST  */
+#line 823 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_BYTE);}
+#line 2707 "ncgeny.c"
     break;
 
-  case 132:
-#line 827 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_SHORT);}
-#line 2531 "ncgeny.c" /* yacc.c:1646  */
+  case 132: /* simpleconstant: SHORT_CONST  */
+#line 824 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_SHORT);}
+#line 2713 "ncgeny.c"
     break;
 
-  case 133:
-#line 828 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_INT);}
-#line 2537 "ncgeny.c" /* yacc.c:1646  */
+  case 133: /* simpleconstant: INT_CONST  */
+#line 825 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_INT);}
+#line 2719 "ncgeny.c"
     break;
 
-  case 134:
-#line 829 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_INT64);}
-#line 2543 "ncgeny.c" /* yacc.c:1646  */
+  case 134: /* simpleconstant: INT64_CONST  */
+#line 826 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_INT64);}
+#line 2725 "ncgeny.c"
     break;
 
-  case 135:
-#line 830 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_UBYTE);}
-#line 2549 "ncgeny.c" /* yacc.c:1646  */
+  case 135: /* simpleconstant: UBYTE_CONST  */
+#line 827 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_UBYTE);}
+#line 2731 "ncgeny.c"
     break;
 
-  case 136:
-#line 831 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_USHORT);}
-#line 2555 "ncgeny.c" /* yacc.c:1646  */
+  case 136: /* simpleconstant: USHORT_CONST  */
+#line 828 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_USHORT);}
+#line 2737 "ncgeny.c"
     break;
 
-  case 137:
-#line 832 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_UINT);}
-#line 2561 "ncgeny.c" /* yacc.c:1646  */
+  case 137: /* simpleconstant: UINT_CONST  */
+#line 829 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_UINT);}
+#line 2743 "ncgeny.c"
     break;
 
-  case 138:
-#line 833 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_UINT64);}
-#line 2567 "ncgeny.c" /* yacc.c:1646  */
+  case 138: /* simpleconstant: UINT64_CONST  */
+#line 830 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_UINT64);}
+#line 2749 "ncgeny.c"
     break;
 
-  case 139:
-#line 834 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_FLOAT);}
-#line 2573 "ncgeny.c" /* yacc.c:1646  */
+  case 139: /* simpleconstant: FLOAT_CONST  */
+#line 831 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_FLOAT);}
+#line 2755 "ncgeny.c"
     break;
 
-  case 140:
-#line 835 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_DOUBLE);}
-#line 2579 "ncgeny.c" /* yacc.c:1646  */
+  case 140: /* simpleconstant: DOUBLE_CONST  */
+#line 832 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_DOUBLE);}
+#line 2761 "ncgeny.c"
     break;
 
-  case 141:
-#line 836 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_STRING);}
-#line 2585 "ncgeny.c" /* yacc.c:1646  */
+  case 141: /* simpleconstant: TERMSTRING  */
+#line 833 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_STRING);}
+#line 2767 "ncgeny.c"
     break;
 
-  case 142:
-#line 840 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.datalist) = builddatalist(0); datalistextend((yyval.datalist),&((yyvsp[0].constant)));}
-#line 2591 "ncgeny.c" /* yacc.c:1646  */
+  case 142: /* intlist: constint  */
+#line 837 "ncgen.y"
+                   {(yyval.datalist) = builddatalist(0); datalistextend((yyval.datalist),&((yyvsp[0].constant)));}
+#line 2773 "ncgeny.c"
     break;
 
-  case 143:
-#line 841 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.datalist)=(yyvsp[-2].datalist); datalistextend((yyvsp[-2].datalist),&((yyvsp[0].constant)));}
-#line 2597 "ncgeny.c" /* yacc.c:1646  */
+  case 143: /* intlist: intlist ',' constint  */
+#line 838 "ncgen.y"
+                               {(yyval.datalist)=(yyvsp[-2].datalist); datalistextend((yyvsp[-2].datalist),&((yyvsp[0].constant)));}
+#line 2779 "ncgeny.c"
     break;
 
-  case 144:
-#line 846 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_INT);}
-#line 2603 "ncgeny.c" /* yacc.c:1646  */
+  case 144: /* constint: INT_CONST  */
+#line 843 "ncgen.y"
+                {(yyval.constant)=makeconstdata(NC_INT);}
+#line 2785 "ncgeny.c"
     break;
 
-  case 145:
-#line 848 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_UINT);}
-#line 2609 "ncgeny.c" /* yacc.c:1646  */
+  case 145: /* constint: UINT_CONST  */
+#line 845 "ncgen.y"
+                {(yyval.constant)=makeconstdata(NC_UINT);}
+#line 2791 "ncgeny.c"
     break;
 
-  case 146:
-#line 850 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_INT64);}
-#line 2615 "ncgeny.c" /* yacc.c:1646  */
+  case 146: /* constint: INT64_CONST  */
+#line 847 "ncgen.y"
+                {(yyval.constant)=makeconstdata(NC_INT64);}
+#line 2797 "ncgeny.c"
     break;
 
-  case 147:
-#line 852 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_UINT64);}
-#line 2621 "ncgeny.c" /* yacc.c:1646  */
+  case 147: /* constint: UINT64_CONST  */
+#line 849 "ncgen.y"
+                {(yyval.constant)=makeconstdata(NC_UINT64);}
+#line 2803 "ncgeny.c"
     break;
 
-  case 148:
-#line 856 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=makeconstdata(NC_STRING);}
-#line 2627 "ncgeny.c" /* yacc.c:1646  */
+  case 148: /* conststring: TERMSTRING  */
+#line 853 "ncgen.y"
+                        {(yyval.constant)=makeconstdata(NC_STRING);}
+#line 2809 "ncgeny.c"
     break;
 
-  case 149:
-#line 860 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=(yyvsp[0].constant);}
-#line 2633 "ncgeny.c" /* yacc.c:1646  */
+  case 149: /* constbool: conststring  */
+#line 857 "ncgen.y"
+                      {(yyval.constant)=(yyvsp[0].constant);}
+#line 2815 "ncgeny.c"
     break;
 
-  case 150:
-#line 861 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.constant)=(yyvsp[0].constant);}
-#line 2639 "ncgeny.c" /* yacc.c:1646  */
+  case 150: /* constbool: constint  */
+#line 858 "ncgen.y"
+                   {(yyval.constant)=(yyvsp[0].constant);}
+#line 2821 "ncgeny.c"
     break;
 
-  case 151:
-#line 867 "ncgen.y" /* yacc.c:1646  */
-    {(yyval.sym)=(yyvsp[0].sym);}
-#line 2645 "ncgeny.c" /* yacc.c:1646  */
+  case 151: /* ident: IDENT  */
+#line 864 "ncgen.y"
+              {(yyval.sym)=(yyvsp[0].sym);}
+#line 2827 "ncgeny.c"
     break;
 
 
-#line 2649 "ncgeny.c" /* yacc.c:1646  */
+#line 2831 "ncgeny.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2659,25 +2842,23 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -2688,50 +2869,44 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2760,12 +2935,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -2782,13 +2956,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2802,7 +2977,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2814,7 +2989,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2825,26 +3000,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -2860,20 +3039,19 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
   return yyresult;
 }
-#line 870 "ncgen.y" /* yacc.c:1906  */
+
+#line 867 "ncgen.y"
 
 
 #ifndef NO_STDARG
@@ -3398,7 +3576,10 @@ containsfills(Datalist* list)
 static void
 datalistextend(Datalist* dl, NCConstant* con)
 {
-    dlappend(dl,con);
+    if(!spoolappend(dl,con))
+        dlappend(dl,con);
+    if(lexrunlength > 0) /* values lexed along with con */
+        lexrunflush(dl);
 }
 
 static void
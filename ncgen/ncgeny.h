@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_NCG_NCGEN_TAB_H_INCLUDED
 # define YY_NCG_NCGEN_TAB_H_INCLUDED
 /* Debug traces.  */
@@ -40,71 +45,75 @@
 extern int ncgdebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    NC_UNLIMITED_K = 258,
-    CHAR_K = 259,
-    BYTE_K = 260,
-    SHORT_K = 261,
-    INT_K = 262,
-    FLOAT_K = 263,
-    DOUBLE_K = 264,
-    UBYTE_K = 265,
-    USHORT_K = 266,
-    UINT_K = 267,
-    INT64_K = 268,
-    UINT64_K = 269,
-    IDENT = 270,
-    TERMSTRING = 271,
-    CHAR_CONST = 272,
-    BYTE_CONST = 273,
-    SHORT_CONST = 274,
-    INT_CONST = 275,
-    INT64_CONST = 276,
-    UBYTE_CONST = 277,
-    USHORT_CONST = 278,
-    UINT_CONST = 279,
-    UINT64_CONST = 280,
-    FLOAT_CONST = 281,
-    DOUBLE_CONST = 282,
-    DIMENSIONS = 283,
-    VARIABLES = 284,
-    NETCDF = 285,
-    DATA = 286,
-    TYPES = 287,
-    COMPOUND = 288,
-    ENUM = 289,
-    OPAQUE_ = 290,
-    OPAQUESTRING = 291,
-    GROUP = 292,
-    PATH = 293,
-    FILLMARKER = 294,
-    NIL = 295,
-    _FILLVALUE = 296,
-    _FORMAT = 297,
-    _STORAGE = 298,
-    _CHUNKSIZES = 299,
-    _DEFLATELEVEL = 300,
-    _SHUFFLE = 301,
-    _ENDIANNESS = 302,
-    _NOFILL = 303,
-    _FLETCHER32 = 304,
-    _NCPROPS = 305,
-    _ISNETCDF4 = 306,
-    _SUPERBLOCK = 307,
-    DATASETID = 308
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    NC_UNLIMITED_K = 258,          /* NC_UNLIMITED_K  */
+    CHAR_K = 259,                  /* CHAR_K  */
+    BYTE_K = 260,                  /* BYTE_K  */
+    SHORT_K = 261,                 /* SHORT_K  */
+    INT_K = 262,                   /* INT_K  */
+    FLOAT_K = 263,                 /* FLOAT_K  */
+    DOUBLE_K = 264,                /* DOUBLE_K  */
+    UBYTE_K = 265,                 /* UBYTE_K  */
+    USHORT_K = 266,                /* USHORT_K  */
+    UINT_K = 267,                  /* UINT_K  */
+    INT64_K = 268,                 /* INT64_K  */
+    UINT64_K = 269,                /* UINT64_K  */
+    IDENT = 270,                   /* IDENT  */
+    TERMSTRING = 271,              /* TERMSTRING  */
+    CHAR_CONST = 272,              /* CHAR_CONST  */
+    BYTE_CONST = 273,              /* BYTE_CONST  */
+    SHORT_CONST = 274,             /* SHORT_CONST  */
+    INT_CONST = 275,               /* INT_CONST  */
+    INT64_CONST = 276,             /* INT64_CONST  */
+    UBYTE_CONST = 277,             /* UBYTE_CONST  */
+    USHORT_CONST = 278,            /* USHORT_CONST  */
+    UINT_CONST = 279,              /* UINT_CONST  */
+    UINT64_CONST = 280,            /* UINT64_CONST  */
+    FLOAT_CONST = 281,             /* FLOAT_CONST  */
+    DOUBLE_CONST = 282,            /* DOUBLE_CONST  */
+    DIMENSIONS = 283,              /* DIMENSIONS  */
+    VARIABLES = 284,               /* VARIABLES  */
+    NETCDF = 285,                  /* NETCDF  */
+    DATA = 286,                    /* DATA  */
+    TYPES = 287,                   /* TYPES  */
+    COMPOUND = 288,                /* COMPOUND  */
+    ENUM = 289,                    /* ENUM  */
+    OPAQUE_ = 290,                 /* OPAQUE_  */
+    OPAQUESTRING = 291,            /* OPAQUESTRING  */
+    GROUP = 292,                   /* GROUP  */
+    PATH = 293,                    /* PATH  */
+    FILLMARKER = 294,              /* FILLMARKER  */
+    NIL = 295,                     /* NIL  */
+    _FILLVALUE = 296,              /* _FILLVALUE  */
+    _FORMAT = 297,                 /* _FORMAT  */
+    _STORAGE = 298,                /* _STORAGE  */
+    _CHUNKSIZES = 299,             /* _CHUNKSIZES  */
+    _DEFLATELEVEL = 300,           /* _DEFLATELEVEL  */
+    _SHUFFLE = 301,                /* _SHUFFLE  */
+    _ENDIANNESS = 302,             /* _ENDIANNESS  */
+    _NOFILL = 303,                 /* _NOFILL  */
+    _FLETCHER32 = 304,             /* _FLETCHER32  */
+    _NCPROPS = 305,                /* _NCPROPS  */
+    _ISNETCDF4 = 306,              /* _ISNETCDF4  */
+    _SUPERBLOCK = 307,             /* _SUPERBLOCK  */
+    DATASETID = 308                /* DATASETID  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 138 "ncgen.y" /* yacc.c:1909  */
+#line 135 "ncgen.y"
 
 Symbol* sym;
 unsigned long  size; /* allow for zero size to indicate e.g. UNLIMITED*/
@@ -113,9 +122,9 @@ int            nctype; /* for tracking attribute list type*/
 Datalist*      datalist;
 NCConstant       constant;
 
-#line 117 "ncgeny.h" /* yacc.c:1909  */
-};
+#line 126 "ncgeny.h"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -124,6 +133,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE ncglval;
 
+
 int ncgparse (void);
 
+
 #endif /* !YY_NCG_NCGEN_TAB_H_INCLUDED  */
@@ -687,6 +687,8 @@ processvars(void)
         /* If we are in classic mode, then convert long -> int32 */
 	if(usingclassic) {
 	    if(basetype->typ.typecode == NC_LONG || basetype->typ.typecode == NC_INT64) {
+		if(basetype->typ.typecode == NC_INT64)
+		    spoolrelease(vsym); /* spooled as 64-bit values */
 	        vsym->typ.basetype = primsymbols[NC_INT];
 		basetype = vsym->typ.basetype;
 	    }
@@ -1179,7 +1181,16 @@ processunlimiteddims(void)
 	ischar = (var->typ.basetype->typ.typecode == NC_CHAR);
 	first = findunlimited(dimset,0);
 	if(first == dimset->ndims) continue; /* no unlimited dims */
-	if(first == 0) {
+	if(var->var.spool != NULL) {
+	    /* Spooled data, so only the first dimension is unlimited */
+	    Symbol* unlim = dimset->dimsyms[0];
+	    size_t xproduct = crossproduct(dimset,1,dimset->ndims);
+	    size_t unlimsize = var->var.spool->count / xproduct;
+	    if(var->var.spool->count % xproduct != 0)
+		unlimsize++; /* => fill requires at some point */
+	    if(unlim->dim.declsize < unlimsize)
+		unlim->dim.declsize = unlimsize;
+	} else if(first == 0) {
 	    computeunlimitedsizes(dimset,first,var->data,ischar);
 	} else {
 	    int j;
@@ -130,6 +130,58 @@ oc_fetch(OCobject link, const char* constraint,
     return OCTHROW(ocerr);
 }
 
+/*!
+This procedure is used to send several DATADDS requests to the server
+at once, over concurrent connections when the link allows it,
+and produce a corresponding tree for each.
+
+\param[in] link The link through which the server is accessed.
+\param[in] n The number of requests.
+\param[in] constraints The constraint for each request.
+\param[in] flags The 'OR' of OCflags to control the fetch (see oc_fetch).
+\param[out] roots A vector of n locations to store the root node
+of the tree associated with each request.
+
+\retval OC_NOERR The procedure executed normally.
+\retval OC_EINVAL  One of the arguments (link, etc.) was invalid.
+*/
+
+OCerror
+oc_fetchn(OCobject link, size_t n, const char** constraints,
+          OCflags flags, OCobject* roots)
+{
+    OCstate* state;
+    OCerror ocerr = OC_NOERR;
+    OCVERIFY(OC_State,link);
+    OCDEREF(OCstate*,state,link);
+
+    if(n > 0 && (constraints == NULL || roots == NULL))
+	return OCTHROW(OC_EINVAL);
+    ocerr = ocfetchn(state,n,constraints,flags,(OCnode**)roots);
+    return OCTHROW(ocerr);
+}
+
+/*!
+This procedure tells whether oc_fetchn would send its requests
+over concurrent connections, rather than one at a time. This is not
+so for requests fetched to disk, for local files, when the persistent
+http cache is in use, or when curl has no curl_multi_wait.
+
+\param[in] link The link through which the server is accessed.
+\param[in] flags The OCflags that would be passed to oc_fetchn.
+
+\retval 1 if the requests would be fetched concurrently, 0 otherwise.
+*/
+
+int
+oc_fetchn_concurrent(OCobject link, OCflags flags)
+{
+    OCstate* state;
+    OCVERIFYX(OC_State,link,0);
+    OCDEREF(OCstate*,state,link);
+    return ocfetchconcurrent(state,flags);
+}
+
 
 /*!
 This procedure reclaims all resources
@@ -218,6 +218,16 @@ extern OCerror oc_fetch(OClink,
 			OCflags,
 			OCddsnode*);
 
+/* Fetch n DataDDS responses, concurrently when possible */
+extern OCerror oc_fetchn(OClink,
+			size_t n,
+			const char** constraints,
+			OCflags,
+			OCddsnode* roots);
+
+/* Would oc_fetchn fetch its responses concurrently? */
+extern int oc_fetchn_concurrent(OClink, OCflags);
+
 extern OCerror oc_root_free(OClink, OCddsnode root);
 extern const char* oc_tree_text(OClink, OCddsnode root);
 
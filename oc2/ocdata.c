@@ -320,61 +320,30 @@ ocread(OCdata* data, XXDR* xdrs, char* memory, size_t memsize, size_t start, siz
 
     case OC_Int32: case OC_UInt32: case OC_Float32:
 	xxdr_setpos(xdrs,data->xdroffset+xdrstart);
-	if(!xxdr_getbytes(xdrs,memory,xdrtotal)) {goto xdrfail;}
-	if(!xxdr_network_order) {
-	    unsigned int* p;
-	    for(p=(unsigned int*)memory,i=0;i<count;i++,p++) {
-		swapinline32(p);
-	    }
-	}
+	if(!xxdr_getn_uint(xdrs,(unsigned int*)memory,(off_t)count))
+	    {goto xdrfail;}
 	break;
 	
     case OC_Int64: case OC_UInt64:
 	xxdr_setpos(xdrs,data->xdroffset+xdrstart);
-	if(!xxdr_getbytes(xdrs,memory,xdrtotal)) {goto xdrfail;}
-	if(!xxdr_network_order) {
-	    unsigned long long* llp;
-	    for(llp=(unsigned long long*)memory,i=0;i<count;i++,llp++) {
-		swapinline64(llp);
-	    }
-	}
+	if(!xxdr_getn_ulonglong(xdrs,(unsigned long long*)memory,(off_t)count))
+	    {goto xdrfail;}
         break;
 
     case OC_Float64:
 	xxdr_setpos(xdrs,data->xdroffset+xdrstart);
-	if(!xxdr_getbytes(xdrs,memory,xdrtotal)) {goto xdrfail;}
-	{
-	    double* dp;
-	    for(dp=(double*)memory,i=0;i<count;i++,dp++) {
-		double swap;
-		xxdrntohdouble((char*)dp,&swap);
-		*dp = swap;
-	    }
-	}
+	if(!xxdr_getn_double(xdrs,(double*)memory,(off_t)count))
+	    {goto xdrfail;}
 	break;
 
     /* non-packed fixed length, but memory size < xdrsize */
-    case OC_Int16: case OC_UInt16: {
-	/* In order to avoid allocating a lot of space, we do this one int at a time */
-	/* Remember also that the short is not packed, so its xdr size is twice
-           its memory size */
+    case OC_Int16: case OC_UInt16:
+	/* Remember that the short is not packed, so its xdr size is twice
+           its memory size; xxdr_getn_ushort narrows a chunk at a time */
         xxdr_setpos(xdrs,data->xdroffset+xdrstart);
-        if(scalar) {
-	    if(!xxdr_ushort(xdrs,(unsigned short*)memory)) {goto xdrfail;}
-	} else {
-	    unsigned short* sp = (unsigned short*)memory;
-	    for(i=0;i<count;i++,sp++) {
-	        unsigned int tmp;
-		if(!xxdr_getbytes(xdrs,(char*)&tmp,(off_t)XDRUNIT))
-		    {goto xdrfail;}
-		/* convert from network order if necessary */
-		if(!xxdr_network_order)
-		    swapinline32(&tmp);
-		/* store as unsigned short */
-		*sp = (unsigned short)tmp;
-	    }
-	}
-	} break;
+	if(!xxdr_getn_ushort(xdrs,(unsigned short*)memory,(off_t)count))
+	    {goto xdrfail;}
+	break;
 
     /* Do the byte types, packed/unpacked */
     case OC_Byte:
@@ -11,12 +11,19 @@
 
 static size_t WriteFileCallback(void*, size_t, size_t, void*);
 static size_t WriteMemoryCallback(void*, size_t, size_t, void*);
+static OCerror httperror(long httpcode);
 
 struct Fetchdata {
 	FILE* stream;
 	size_t size;
 };
 
+struct Fetchmemory {
+	CURL* curl;
+	NCbytes* buf;
+	int sized; /* buf has been sized for the content length, if known */
+};
+
 long
 ocfetchhttpcode(CURL* curl)
 {
@@ -32,6 +39,31 @@ ocfetchhttpcode(CURL* curl)
     return httpcode;
 }
 
+/* Make the fetches that follow conditional on the resource having
+   been modified since lastmodified; lastmodified < 0 => unconditional */
+OCerror
+ocfetchcondition(CURL* curl, long lastmodified)
+{
+    CURLcode cstat = CURLE_OK;
+    long condition = (lastmodified < 0 ? CURL_TIMECOND_NONE
+                                       : CURL_TIMECOND_IFMODSINCE);
+    cstat = CURLERR(curl_easy_setopt(curl, CURLOPT_TIMECONDITION, condition));
+    if(cstat == CURLE_OK)
+        cstat = CURLERR(curl_easy_setopt(curl, CURLOPT_TIMEVALUE,
+                                 (lastmodified < 0 ? 0L : lastmodified)));
+    return (cstat == CURLE_OK ? OC_NOERR : OCTHROW(OC_ECURL));
+}
+
+/* Did the last (conditional) fetch find the resource unmodified? */
+int
+ocfetchunmet(CURL* curl)
+{
+    long unmet = 0;
+    if(curl_easy_getinfo(curl,CURLINFO_CONDITION_UNMET,&unmet) != CURLE_OK)
+        unmet = 0;
+    return (unmet != 0 || ocfetchhttpcode(curl) == 304);
+}
+
 OCerror
 ocfetchurl_file(CURL* curl, const char* url, FILE* stream,
 		off_t* sizep, long* filetime)
@@ -94,6 +126,7 @@ ocfetchurl(CURL* curl, const char* url, NCbytes* buf, long* filetime,
 	CURLcode cstat = CURLE_OK;
 	size_t len;
         long httpcode = 0;
+	struct Fetchmemory fetchmemory;
 
 	/* Set the URL */
 	cstat = CURLERR(CURLERR(curl_easy_setopt(curl, CURLOPT_URL, (void*)url)));
@@ -124,8 +157,11 @@ ocfetchurl(CURL* curl, const char* url, NCbytes* buf, long* filetime,
 	if (cstat != CURLE_OK)
 		goto fail;
 
-	/* we pass our file to the callback function */
-	cstat = CURLERR(curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)buf));
+	/* we pass our buffer to the callback function */
+	fetchmemory.curl = curl;
+	fetchmemory.buf = buf;
+	fetchmemory.sized = 0;
+	cstat = CURLERR(curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)&fetchmemory));
 	if (cstat != CURLE_OK)
 		goto fail;
 
@@ -161,15 +197,123 @@ ocfetchurl(CURL* curl, const char* url, NCbytes* buf, long* filetime,
 
 fail:
 	nclog(NCLOGERR, "curl error: %s", curl_easy_strerror(cstat));
+	return OCTHROW(httperror(httpcode));
+}
+
+/* Map the http code of a failed fetch to an OC error */
+static OCerror
+httperror(long httpcode)
+{
 	switch (httpcode) {
-	case 401: stat = OC_EAUTH; break;
-	case 404: stat = OC_ENOFILE; break;
-	case 500: stat = OC_EDAPSVC; break;
-	case 200: break;
-	default: stat = OC_ECURL; break;
+	case 401: return OC_EAUTH;
+	case 404: return OC_ENOFILE;
+	case 500: return OC_EDAPSVC;
+	case 200: return OC_NOERR;
+	default: break;
 	}
+	return OC_ECURL;
+}
+
+#ifdef HAVE_CURL_MULTI_WAIT
+/* Fetch n urls into bufs[0..n-1] over concurrent connections, each
+   using a copy of the options set on curl. As each fetch completes,
+   completed is called with its index, its status, http code and last
+   modified time, so the response can be used while the others are
+   still in flight; the first error returned by it stops the fetches
+   and is returned. */
+OCerror
+ocfetchurls(CURL* curl, size_t n, char** urls, NCbytes** bufs,
+            OCfetchdone completed, void* arg)
+{
+	OCerror stat = OC_NOERR;
+	CURLMcode mstat = CURLM_OK;
+	CURLM* multi = NULL;
+	CURL** handles = NULL;
+	struct Fetchmemory* fetchmemory = NULL;
+	size_t i;
+	int running = 0;
+
+	handles = (CURL**)calloc(n,sizeof(CURL*));
+	fetchmemory = (struct Fetchmemory*)calloc(n,sizeof(struct Fetchmemory));
+	if(handles == NULL || fetchmemory == NULL)
+	    {stat = OC_ENOMEM; goto done;}
+	if((multi = curl_multi_init()) == NULL)
+	    {stat = OC_ECURL; goto done;}
+
+	for(i=0;i<n;i++) {
+	    CURL* h = curl_easy_duphandle(curl);
+	    if(h == NULL) {stat = OC_ECURL; goto done;}
+	    handles[i] = h;
+	    fetchmemory[i].curl = h;
+	    fetchmemory[i].buf = bufs[i];
+	    fetchmemory[i].sized = 0;
+	    if(CURLERR(curl_easy_setopt(h, CURLOPT_URL, (void*)urls[i])) != CURLE_OK
+	       || CURLERR(curl_easy_setopt(h, CURLOPT_WRITEFUNCTION, WriteMemoryCallback)) != CURLE_OK
+	       || CURLERR(curl_easy_setopt(h, CURLOPT_WRITEDATA, (void*)&fetchmemory[i])) != CURLE_OK
+	       || CURLERR(curl_easy_setopt(h, CURLOPT_PRIVATE, (void*)i)) != CURLE_OK
+	       || CURLERR(curl_easy_setopt(h, CURLOPT_FILETIME, (long)1)) != CURLE_OK)
+		{stat = OC_ECURL; goto done;}
+	    if(curl_multi_add_handle(multi,h) != CURLM_OK)
+		{stat = OC_ECURL; goto done;}
+	}
+
+	/* Run the transfers, handing each one off as it completes */
+	do {
+	    CURLMsg* msg;
+	    int nmsgs;
+	    mstat = curl_multi_perform(multi,&running);
+	    if(mstat != CURLM_OK) break;
+	    while((msg = curl_multi_info_read(multi,&nmsgs)) != NULL) {
+		CURLcode cstat;
+		OCerror fstat = OC_NOERR;
+		long httpcode, filetime = -1;
+		void* priv = NULL;
+		if(msg->msg != CURLMSG_DONE) continue;
+		cstat = msg->data.result;
+		(void)curl_easy_getinfo(msg->easy_handle,CURLINFO_PRIVATE,(char**)&priv);
+		i = (size_t)priv;
+		if(cstat == CURLE_PARTIAL_FILE) {
+		    /* Log it but otherwise ignore */
+		    nclog(NCLOGWARN, "curl error: %s; ignored",
+			   curl_easy_strerror(cstat));
+		    cstat = CURLE_OK;
+		}
+		httpcode = ocfetchhttpcode(msg->easy_handle);
+		if(cstat == CURLE_OK)
+		    cstat = CURLERR(curl_easy_getinfo(msg->easy_handle,CURLINFO_FILETIME,&filetime));
+		if(cstat != CURLE_OK) {
+		    nclog(NCLOGERR, "curl error: %s", curl_easy_strerror(cstat));
+		    fstat = httperror(httpcode);
+		    if(fstat == OC_NOERR) fstat = OC_ECURL;
+		} else {
+		    /* Null terminate the buffer*/
+		    size_t len = ncbyteslength(bufs[i]);
+		    ncbytesappend(bufs[i], '\0');
+		    ncbytessetlength(bufs[i], len); /* dont count null in buffer size*/
+		}
+		if((stat = completed(arg,i,fstat,httpcode,filetime)) != OC_NOERR)
+		    goto done;
+	    }
+	    if(running > 0)
+		mstat = curl_multi_wait(multi,NULL,0,1000,NULL);
+	} while(mstat == CURLM_OK && running > 0);
+	if(mstat != CURLM_OK) {
+	    nclog(NCLOGERR, "curl error: %s", curl_multi_strerror(mstat));
+	    stat = OC_ECURL;
+	}
+
+done:
+	for(i=0;handles != NULL && i<n;i++) {
+	    if(handles[i] == NULL) continue;
+	    if(multi != NULL) (void)curl_multi_remove_handle(multi,handles[i]);
+	    curl_easy_cleanup(handles[i]);
+	}
+	if(multi != NULL) (void)curl_multi_cleanup(multi);
+	if(handles != NULL) free(handles);
+	if(fetchmemory != NULL) free(fetchmemory);
 	return OCTHROW(stat);
 }
+#endif /*HAVE_CURL_MULTI_WAIT*/
 
 static size_t
 WriteFileCallback(void* ptr, size_t size, size_t nmemb,	void* data)
@@ -196,9 +340,26 @@ static size_t
 WriteMemoryCallback(void *ptr, size_t size, size_t nmemb, void *data)
 {
 	size_t realsize = size * nmemb;
-	NCbytes* buf = (NCbytes*) data;
+	struct Fetchmemory* fetchmemory = (struct Fetchmemory*) data;
+	NCbytes* buf = fetchmemory->buf;
         if(realsize == 0)
 	    nclog(NCLOGWARN,"WriteMemoryCallback: zero sized chunk");
+	/* Once the headers are in, make room for the whole response at
+	   once, so large dods datasets are not copied as the buffer grows */
+	if(!fetchmemory->sized) {
+#if LIBCURL_VERSION_NUM >= 0x073700 /* 7.55.0 */
+	    curl_off_t length = -1;
+	    CURLINFO info = CURLINFO_CONTENT_LENGTH_DOWNLOAD_T;
+#else
+	    double length = -1;
+	    CURLINFO info = CURLINFO_CONTENT_LENGTH_DOWNLOAD;
+#endif
+	    fetchmemory->sized = 1;
+	    if(curl_easy_getinfo(fetchmemory->curl,info,&length) == CURLE_OK
+	       && length > 0
+	       && !ncbytessetalloc(buf,ncbyteslength(buf)+(unsigned long)length+1))
+		return 0; /* out of memory: fail the transfer */
+	}
 	/* Optimize for reading potentially large dods datasets */
 	if(!ncbytesavail(buf,realsize)) {
 	    /* double the size of the packet */
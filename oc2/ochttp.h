@@ -9,9 +9,18 @@ extern void curlclose(CURL*);
 
 extern OCerror ocfetchurl(CURL*, const char*, NCbytes*, long*, struct OCcredentials*);
 extern OCerror ocfetchurl_file(CURL*, const char*, FILE*, off_t*, long*);
+#ifdef HAVE_CURL_MULTI_WAIT
+/* Called by ocfetchurls as each fetch completes */
+typedef OCerror (*OCfetchdone)(void* arg, size_t index, OCerror stat,
+                               long httpcode, long filetime);
+extern OCerror ocfetchurls(CURL*, size_t, char**, NCbytes**, OCfetchdone, void*);
+#endif
 
 extern long ocfetchhttpcode(CURL* curl);
 
+extern OCerror ocfetchcondition(CURL* curl, long lastmodified);
+extern int ocfetchunmet(CURL* curl);
+
 extern OCerror ocfetchlastmodified(CURL* curl, char* url, long* filetime);
 
 extern OCerror occurlopen(CURL** curlp);
@@ -45,7 +45,9 @@
 #define CLBRACE '{'
 #define CRBRACE '}'
 
-static OCerror ocextractddsinmemory(OCstate*,OCtree*,int);
+static OCerror ocextractddsinmemory(OCstate*,OCtree*,NCbytes*,int);
+static OCtree* ocnewtree(OCstate*,const char*,OCdxd);
+static OCerror ocdecode(OCstate*,OCtree*,OCdxd,OCflags,OCnode**);
 static OCerror ocextractddsinfile(OCstate*,OCtree*,int);
 static char* constraintescape(const char* url);
 static OCerror createtempfile(OCstate*,OCtree*);
@@ -202,22 +204,29 @@ fail:
     return OCTHROW(stat);
 }
 
+static OCtree*
+ocnewtree(OCstate* state, const char* constraint, OCdxd kind)
+{
+    OCtree* tree = (OCtree*)ocmalloc(sizeof(OCtree));
+    if(tree == NULL) return NULL;
+    memset((void*)tree,0,sizeof(OCtree));
+    tree->dxdclass = kind;
+    tree->state = state;
+    tree->constraint = constraintescape(constraint);
+    if(tree->constraint == NULL)
+	tree->constraint = nulldup(constraint);
+    return tree;
+}
+
 OCerror
 ocfetch(OCstate* state, const char* constraint, OCdxd kind, OCflags flags,
         OCnode** rootp)
 {
     OCtree* tree = NULL;
-    OCnode* root = NULL;
     OCerror stat = OC_NOERR;
 
-    tree = (OCtree*)ocmalloc(sizeof(OCtree));
+    tree = ocnewtree(state,constraint,kind);
     MEMCHECK(tree,OC_ENOMEM);
-    memset((void*)tree,0,sizeof(OCtree));
-    tree->dxdclass = kind;
-    tree->state = state;
-    tree->constraint = constraintescape(constraint);
-    if(tree->constraint == NULL)
-	tree->constraint = nulldup(constraint);
 
     /* Set per-fetch curl properties */
 #if 0 /* temporarily make per-link */
@@ -245,9 +254,12 @@ ocfetch(OCstate* state, const char* constraint, OCdxd kind, OCflags flags,
 	if((flags & OCONDISK) != 0) {/* store in file */
 	    /* Create the datadds file immediately
                so that DRNO can reference it*/
-            /* Make the tmp file*/
-            stat = createtempfile(state,tree);
-            if(stat) {OCTHROWCHK(stat); goto fail;}
+            /* Make the tmp file, unless the data is already in a
+               local file that can be read in place */
+	    if(!ocislocalfile(state,state->uri)) {
+                stat = createtempfile(state,tree);
+                if(stat) {OCTHROWCHK(stat); goto fail;}
+	    }
             stat = readDATADDS(state,tree,flags);
 	    if(stat == OC_NOERR) {
                 /* Separate the DDS from data and return the dds;
@@ -259,7 +271,7 @@ ocfetch(OCstate* state, const char* constraint, OCdxd kind, OCflags flags,
 	    if(stat == OC_NOERR) {
                 /* Separate the DDS from data and return the dds;
                will modify packet */
-            stat = ocextractddsinmemory(state,tree,flags);
+            stat = ocextractddsinmemory(state,tree,state->packet,flags);
 	}
 	}
 	break;
@@ -276,6 +288,141 @@ ocfetch(OCstate* state, const char* constraint, OCdxd kind, OCflags flags,
 	}
 	goto fail;
     }
+    return ocdecode(state,tree,kind,flags,rootp);
+
+fail:
+    octree_free(tree);
+    return OCTHROW(stat);
+}
+
+#ifdef HAVE_CURL_MULTI_WAIT
+/* State shared by ocfetchn and fetchndone */
+struct Fetchn {
+    OCstate* state;
+    OCflags flags;
+    OCtree** trees;
+    NCbytes** bufs;
+    OCnode** roots;
+};
+
+/* Decode one response of ocfetchn as soon as it arrives */
+static OCerror
+fetchndone(void* arg, size_t i, OCerror stat, long httpcode, long filetime)
+{
+    struct Fetchn* fetchn = (struct Fetchn*)arg;
+    OCstate* state = fetchn->state;
+    OCtree* tree = fetchn->trees[i];
+
+    state->error.httpcode = httpcode;
+    if(stat != OC_NOERR) {
+	oc_curl_printerror(state);
+	if(httpcode >= 400) {
+	    nclog(NCLOGWARN,"oc_open: Could not read url; http error = %l",httpcode);
+	} else {
+	    nclog(NCLOGWARN,"oc_open: Could not read url");
+	}
+	return OCTHROW(stat);
+    }
+    state->datalastmodified = filetime;
+    fetchn->trees[i] = NULL; /* ocdecode takes control of tree */
+    tree->data.datasize = ncbyteslength(fetchn->bufs[i]);
+    stat = ocextractddsinmemory(state,tree,fetchn->bufs[i],fetchn->flags);
+    if(stat != OC_NOERR) {
+	octree_free(tree);
+	return OCTHROW(stat);
+    }
+    /* The memory now belongs to the tree */
+    ncbytesfree(fetchn->bufs[i]);
+    fetchn->bufs[i] = NULL;
+    return ocdecode(state,tree,OCDATADDS,fetchn->flags,&fetchn->roots[i]);
+}
+#endif /*HAVE_CURL_MULTI_WAIT*/
+
+/* Can several DataDDS responses be fetched over concurrent
+   connections? Only in-memory responses from a remote server are;
+   the persistent http cache is consulted one response at a time. */
+int
+ocfetchconcurrent(OCstate* state, OCflags flags)
+{
+#ifdef HAVE_CURL_MULTI_WAIT
+    return ((flags & OCONDISK) == 0 && state->httpcache.dir == NULL
+	    && strcmp(state->uri->protocol,"file") != 0);
+#else
+    return 0;
+#endif
+}
+
+/* Fetch the DataDDS for each of n constraints, over concurrent
+   connections when that is possible; roots[i] receives the root of
+   the tree for constraints[i]. On failure, no roots are returned. */
+OCerror
+ocfetchn(OCstate* state, size_t n, const char** constraints, OCflags flags,
+         OCnode** roots)
+{
+    OCerror stat = OC_NOERR;
+    size_t i;
+
+    for(i=0;i<n;i++) roots[i] = NULL;
+#ifdef HAVE_CURL_MULTI_WAIT
+    if(n > 1 && ocfetchconcurrent(state,flags)) {
+	struct Fetchn fetchn;
+	char** urls = (char**)calloc(n,sizeof(char*));
+	fetchn.state = state;
+	fetchn.flags = flags;
+	fetchn.roots = roots;
+	fetchn.trees = (OCtree**)calloc(n,sizeof(OCtree*));
+	fetchn.bufs = (NCbytes**)calloc(n,sizeof(NCbytes*));
+	if(urls == NULL || fetchn.trees == NULL || fetchn.bufs == NULL)
+	    {stat = OC_ENOMEM; goto done;}
+	for(i=0;i<n;i++) {
+	    OCtree* tree = ocnewtree(state,constraints[i],OCDATADDS);
+	    fetchn.trees[i] = tree;
+	    fetchn.bufs[i] = ncbytesnew();
+	    if(tree == NULL || fetchn.bufs[i] == NULL) {stat = OC_ENOMEM; goto done;}
+	    ncurisetquery(state->uri,tree->constraint);
+	    urls[i] = ncuribuild(state->uri,NULL,".dods",
+				 NCURIBASE|NCURIQUERY|NCURIENCODE);
+	    if(urls[i] == NULL) {stat = OC_ENOMEM; goto done;}
+	    if(ocdebug > 0)
+		{fprintf(stderr,"fetch url=%s\n",urls[i]); fflush(stderr);}
+	}
+	stat = ocfetchurls(state->curl,n,urls,fetchn.bufs,fetchndone,&fetchn);
+	if(ocdebug > 0)
+	    {fprintf(stderr,"fetch complete\n"); fflush(stderr);}
+done:
+	for(i=0;i<n;i++) {
+	    if(fetchn.trees != NULL && fetchn.trees[i] != NULL)
+		octree_free(fetchn.trees[i]);
+	    if(fetchn.bufs != NULL) ncbytesfree(fetchn.bufs[i]);
+	    if(urls != NULL) nullfree(urls[i]);
+	    if(stat != OC_NOERR && roots[i] != NULL)
+		{ocroot_free(roots[i]); roots[i] = NULL;}
+	}
+	nullfree(fetchn.trees);
+	nullfree(fetchn.bufs);
+	nullfree(urls);
+	return OCTHROW(stat);
+    }
+#endif /*HAVE_CURL_MULTI_WAIT*/
+    for(i=0;i<n;i++) {
+	stat = ocfetch(state,constraints[i],OCDATADDS,flags,&roots[i]);
+	if(stat != OC_NOERR) break;
+    }
+    if(stat != OC_NOERR) {
+	for(i=0;i<n;i++)
+	    if(roots[i] != NULL) {ocroot_free(roots[i]); roots[i] = NULL;}
+    }
+    return OCTHROW(stat);
+}
+
+/* Parse the text of a fetched tree and, for a DataDDS, set up
+   access to its data; on success the root is added to state->trees,
+   on failure the tree is reclaimed. */
+static OCerror
+ocdecode(OCstate* state, OCtree* tree, OCdxd kind, OCflags flags, OCnode** rootp)
+{
+    OCnode* root = NULL;
+    OCerror stat = OC_NOERR;
 
     tree->nodes = NULL;
     stat = DAPparse(state,tree,tree->text);
@@ -443,17 +590,18 @@ occlose(OCstate* state)
     ocfree(state->proxy.host);
     ocfree(state->proxy.userpwd);
     ocfree(state->creds.userpwd);
+    nchttpcache_clear(&state->httpcache);
     if(state->curl != NULL) occurlclose(state->curl);
     ocfree(state);
 }
 
 static OCerror
-ocextractddsinmemory(OCstate* state, OCtree* tree, OCflags flags)
+ocextractddsinmemory(OCstate* state, OCtree* tree, NCbytes* packet, OCflags flags)
 {
     OCerror stat = OC_NOERR;
     size_t ddslen, bod, bodfound;
     /* Read until we find the separator (or EOF)*/
-    bodfound = ocfindbod(state->packet,&bod,&ddslen);
+    bodfound = ocfindbod(packet,&bod,&ddslen);
     if(!bodfound) {/* No BOD; pretend */
 	bod = tree->data.bod;
 	ddslen = tree->data.datasize;
@@ -463,12 +611,12 @@ ocextractddsinmemory(OCstate* state, OCtree* tree, OCflags flags)
     /* copy out the dds */
     if(ddslen > 0) {
         tree->text = (char*)ocmalloc(ddslen+1);
-        memcpy((void*)tree->text,(void*)ncbytescontents(state->packet),ddslen);
+        memcpy((void*)tree->text,(void*)ncbytescontents(packet),ddslen);
         tree->text[ddslen] = '\0';
     } else
 	tree->text = NULL;
     /* Extract the inmemory contents */
-    tree->data.memory = ncbytesextract(state->packet);
+    tree->data.memory = ncbytesextract(packet);
 #ifdef OCIGNORE
     /* guarantee the data part is on an 8 byte boundary */
     if(tree->data.bod % 8 != 0) {
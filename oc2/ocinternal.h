@@ -44,6 +44,7 @@
 #include "nclist.h"
 #include "ncbytes.h"
 #include "ncuri.h"
+#include "nchttpcache.h"
 
 #ifndef HAVE_STRNDUP
 /* Not all systems have strndup, so provide one*/
@@ -223,6 +224,7 @@ struct OCstate {
     struct OCcredentials {
 	char *userpwd; /*CURLOPT_USERPWD*/
     } creds;
+    NChttpcache httpcache; /* HTTP.CACHE.DIR; dir == NULL => no caching */
     void* usercurldata;
     long ddslastmodified;
     long datalastmodified;
@@ -265,6 +267,8 @@ extern NClist* CEparse(OCstate*,char* input);
 extern OCerror ocopen(OCstate** statep, const char* url);
 extern void occlose(OCstate* state);
 extern OCerror ocfetch(OCstate*, const char*, OCdxd, OCflags, OCnode**);
+extern OCerror ocfetchn(OCstate*, size_t, const char**, OCflags, OCnode**);
+extern int ocfetchconcurrent(OCstate*, OCflags);
 extern int oc_network_order;
 extern int oc_invert_xdr_double;
 extern OCerror ocinternalinitialize(void);
@@ -542,6 +542,18 @@ ocrc_process(OCstate* state)
             nclog(NCLOGNOTE,"HTTP.NETRC: %s", state->curlflags.netrc);
     }
 
+    if((value = ocrc_lookup("HTTP.CACHE.DIR",url_hostport)) != NULL) {
+	unsigned long long maxsize = 0;
+	char* size = ocrc_lookup("HTTP.CACHE.MAXSIZE",url_hostport);
+	if(size != NULL)
+	    maxsize = strtoull(size,NULL,10);
+	if(nchttpcache_init(&state->httpcache,value,maxsize) != NC_NOERR)
+	    nclog(NCLOGWARN,"HTTP.CACHE.DIR: %s unusable; not caching",value);
+	else if(ocdebug > 0)
+	    nclog(NCLOGNOTE,"HTTP.CACHE.DIR: %s (%llu bytes)",
+		  state->httpcache.dir,state->httpcache.maxsize);
+    }
+
     { /* Handle various cases for user + password */
 	/* First, see if the user+pwd was in the original url */
 	char* userpwd = NULL;
@@ -22,8 +22,10 @@
 
 /*Forward*/
 static int readpacket(OCstate* state, NCURI*, NCbytes*, OCdxd, long*);
+static int fetchcached(OCstate*, const char* url, NCbytes*, FILE*, off_t*, long*);
+static int fetchresponse(OCstate*, const char* url, NCbytes*, FILE*, off_t*, long*);
 static int readfile(const char* path, const char* suffix, NCbytes* packet);
-static int readfiletofile(const char* path, const char* suffix, FILE* stream, off_t*);
+static int openfile(const char* path, const char* suffix, FILE** streamp, off_t*);
 
 int
 readDDS(OCstate* state, OCtree* tree)
@@ -77,6 +79,13 @@ ocdxdextension(OCdxd dxd)
     return NULL;
 }
 
+/* Is url a file://... url that we read ourselves, rather than with curl? */
+int
+ocislocalfile(OCstate* state, NCURI* url)
+{
+    return (strcmp(url->protocol,"file")==0 && !state->curlflags.proto_file);
+}
+
 static int
 readpacket(OCstate* state, NCURI* url,NCbytes* packet,OCdxd dxd,long* lastmodified)
 {
@@ -84,11 +93,10 @@ readpacket(OCstate* state, NCURI* url,NCbytes* packet,OCdxd dxd,long* lastmodifi
    int fileprotocol = 0;
    const char* suffix = ocdxdextension(dxd);
    char* fetchurl = NULL;
-   CURL* curl = state->curl;
 
    fileprotocol = (strcmp(url->protocol,"file")==0);
 
-   if(fileprotocol && !state->curlflags.proto_file) {
+   if(ocislocalfile(state,url)) {
         /* Short circuit file://... urls*/
 	/* We do this because the test code always needs to read files*/
 	fetchurl = ncuribuild(url,NULL,NULL,NCURIBASE);
@@ -101,7 +109,7 @@ readpacket(OCstate* state, NCURI* url,NCbytes* packet,OCdxd dxd,long* lastmodifi
 	MEMCHECK(fetchurl,OC_ENOMEM);
 	if(ocdebug > 0)
             {fprintf(stderr,"fetch url=%s\n",fetchurl); fflush(stderr);}
-        stat = ocfetchurl(curl,fetchurl,packet,lastmodified,&state->creds);
+        stat = fetchcached(state,fetchurl,packet,NULL,NULL,lastmodified);
 	if(stat)
 	    oc_curl_printerror(state);
 	if(ocdebug > 0)
@@ -139,9 +147,11 @@ fprintf(stderr,"readDATADDS:\n");
 
         fileprotocol = (strcmp(url->protocol,"file")==0);
 
-        if(fileprotocol && !state->curlflags.proto_file) {
+        if(ocislocalfile(state,url)) {
+            /* Read the .dods file in place, rather than copying it
+               to a temp file */
             readurl = ncuribuild(url,NULL,NULL,NCURIBASE);
-            stat = readfiletofile(readurl, ".dods", tree->data.file, &tree->data.datasize);
+            stat = openfile(readurl, ".dods", &tree->data.file, &tree->data.datasize);
         } else {
             int flags = NCURIBASE;
             if(!fileprotocol) flags |= NCURIQUERY;
@@ -151,8 +161,8 @@ fprintf(stderr,"readDATADDS:\n");
             MEMCHECK(readurl,OC_ENOMEM);
             if (ocdebug > 0) 
                 {fprintf(stderr, "fetch url=%s\n", readurl);fflush(stderr);}
-            stat = ocfetchurl_file(state->curl, readurl, tree->data.file,
-                                   &tree->data.datasize, &lastmod);
+            stat = fetchcached(state, readurl, NULL, tree->data.file,
+                               &tree->data.datasize, &lastmod);
             if(stat == OC_NOERR)
                 state->datalastmodified = lastmod;
             if (ocdebug > 0) 
@@ -163,44 +173,107 @@ fprintf(stderr,"readDATADDS:\n");
     return OCTHROW(stat);
 }
 
+/* Fetch url into packet or, if packet is NULL, into stream */
 static int
-readfiletofile(const char* path, const char* suffix, FILE* stream, off_t* sizep)
+fetchresponse(OCstate* state, const char* url, NCbytes* packet, FILE* stream,
+         off_t* sizep, long* filetime)
+{
+    if(packet != NULL)
+        return ocfetchurl(state->curl,url,packet,filetime,&state->creds);
+    return ocfetchurl_file(state->curl,url,stream,sizep,filetime);
+}
+
+/* Fetch url into packet or, if packet is NULL, into stream, going
+   through the persistent http cache (HTTP.CACHE.DIR) if there is one:
+   a cached response is revalidated with a conditional GET and used
+   if the server reports that it has not been modified. */
+static int
+fetchcached(OCstate* state, const char* url, NCbytes* packet, FILE* stream,
+         off_t* sizep, long* lastmodified)
 {
     int stat = OC_NOERR;
-    NCbytes* packet = ncbytesnew();
-    size_t len;
-    /* check for leading file:/// */
-    if(ocstrncmp(path,"file:///",8)==0) path += 7; /* assume absolute path*/
-    stat = readfile(path,suffix,packet);
-#ifdef OCDEBUG
-fprintf(stderr,"readfiletofile: packet.size=%lu\n",
-		(unsigned long)ncbyteslength(packet));
-#endif
-    if(stat != OC_NOERR) goto unwind;
-    len = nclistlength(packet);
-    if(stat == OC_NOERR) {
-	size_t written;
-        fseek(stream,0,SEEK_SET);
-	written = fwrite(ncbytescontents(packet),1,len,stream);
-	if(written != len) {
-#ifdef OCDEBUG
-fprintf(stderr,"readfiletofile: written!=length: %lu :: %lu\n",
-	(unsigned long)written,(unsigned long)len);
-#endif
-	    stat = OC_EIO;
-	}
+    NChttpcache* cache = (state->httpcache.dir != NULL ? &state->httpcache : NULL);
+    long cachedtime = -1;
+    long filetime = -1;
+    int cached = 0;
+
+    if(cache != NULL && nchttpcache_lookup(cache,url,&cachedtime))
+        cached = (ocfetchcondition(state->curl,cachedtime) == OC_NOERR);
+    stat = fetchresponse(state,url,packet,stream,sizep,&filetime);
+    if(cached)
+        (void)ocfetchcondition(state->curl,-1);
+    if(stat != OC_NOERR) goto done;
+
+    if(cached && ocfetchunmet(state->curl)) {
+        int cstat;
+        if(ocdebug > 0)
+            {fprintf(stderr,"fetch from cache: %s\n",url); fflush(stderr);}
+        if(packet != NULL) {
+            cstat = nchttpcache_get(cache,url,packet);
+            if(cstat == NC_NOERR) {
+                unsigned long len = ncbyteslength(packet);
+                ncbytesappend(packet,'\0');
+                ncbytessetlength(packet,len);
+            }
+        } else
+            cstat = nchttpcache_getfile(cache,url,stream,sizep);
+        if(cstat == NC_NOERR) {
+            filetime = cachedtime;
+            goto havedata;
+        }
+        /* The entry was evicted (possibly by another process) since
+           it was looked up, so fetch the response unconditionally */
+        if(packet != NULL)
+            ncbytesclear(packet);
+        else
+            rewind(stream);
+        filetime = -1;
+        stat = fetchresponse(state,url,packet,stream,sizep,&filetime);
+        if(stat != OC_NOERR) goto done;
+    }
+    if(cache != NULL && filetime >= 0) {
+        /* Failing to cache the response is not an error */
+        if(packet != NULL)
+            (void)nchttpcache_put(cache,url,filetime,ncbytescontents(packet),
+                                  (size_t)ncbyteslength(packet));
+        else
+            (void)nchttpcache_putfile(cache,url,filetime,stream);
     }
-    if(sizep != NULL) *sizep = len;
-unwind:
-    ncbytesfree(packet);
+havedata:
+    if(lastmodified != NULL) *lastmodified = filetime;
+done:
     return OCTHROW(stat);
 }
 
+static int
+openfile(const char* path, const char* suffix, FILE** streamp, off_t* sizep)
+{
+    char filename[1024];
+    FILE* stream;
+    /* check for leading file:/// */
+    if(ocstrncmp(path,"file://",7)==0) path += 7; /* assume absolute path*/
+    if(!occopycat(filename,sizeof(filename),2,path,(suffix != NULL ? suffix : "")))
+	return OCTHROW(OC_EOVERRUN);
+    stream = fopen(filename,"rb");
+    if(stream == NULL) {
+	nclog(NCLOGERR,"open failed:%s",filename);
+	return OCTHROW(OC_EOPEN);
+    }
+    if(fseek(stream,0,SEEK_END) < 0) {
+	nclog(NCLOGERR,"fseek failed: %s",filename);
+	fclose(stream);
+	return OCTHROW(OC_EIO);
+    }
+    if(sizep != NULL) *sizep = (off_t)ftell(stream);
+    rewind(stream);
+    *streamp = stream;
+    return OCTHROW(OC_NOERR);
+}
+
 static int
 readfile(const char* path, const char* suffix, NCbytes* packet)
 {
     int stat = OC_NOERR;
-    char buf[1024];
     char filename[1024];
     int fd = -1;
     int flags = 0;
@@ -229,8 +302,16 @@ readfile(const char* path, const char* suffix, NCbytes* packet)
     /* Move file pointer back to the beginning of the file */
     (void)lseek(fd,(off_t)0,SEEK_SET);
     stat = OC_NOERR;
-    for(totalread=0;;) {
-	off_t count = (off_t)read(fd,buf,sizeof(buf));
+    /* Read the whole file straight into the packet (plus room for
+       the null that callers add) */
+    if(!ncbytessetalloc(packet,ncbyteslength(packet)+(unsigned long)filesize+1)) {
+	stat = OC_ENOMEM;
+	goto done;
+    }
+    for(totalread=0;totalread < filesize;) {
+	unsigned long len = ncbyteslength(packet);
+	off_t count = (off_t)read(fd,ncbytescontents(packet)+len,
+				  (size_t)(filesize - totalread));
 	if(count == 0)
 	    break; /*eof*/
 	else if(count <  0) {
@@ -238,7 +319,7 @@ readfile(const char* path, const char* suffix, NCbytes* packet)
 	    nclog(NCLOGERR,"read failed: %s",filename);
 	    goto done;
 	}
-	ncbytesappendn(packet,buf,(unsigned long)count);
+	ncbytessetlength(packet,len+(unsigned long)count);
 	totalread += count;
     }
     if(totalread < filesize) {
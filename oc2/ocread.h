@@ -10,4 +10,6 @@ extern int readDAS(OCstate*, OCtree*);
 
 extern int readDATADDS(OCstate*, OCtree*, int inmemory);
 
+extern int ocislocalfile(OCstate*, NCURI*);
+
 #endif /*READ_H*/
@@ -140,10 +140,13 @@ ocfindbod(NCbytes* buffer, size_t* bodp, size_t* ddslenp)
     
     content = ncbytescontents(buffer);
 
-    for(marks = DDSdatamarks;*marks;marks++) {
-	char* mark = *marks;
-        size_t tlen = strlen(mark);
-        for(i=0;i<len;i++) {
+    /* Stop at the first mark, which ends the dds text, rather than
+       looking for each mark in turn through the (binary) data */
+    for(i=0;i<len;i++) {
+	if(content[i] != 'D') continue;
+        for(marks = DDSdatamarks;*marks;marks++) {
+	    char* mark = *marks;
+            size_t tlen = strlen(mark);
 	    if((i+tlen) <= len 
 	        && (ocstrncmp(content+i,mark,tlen)==0)) {
 	       *ddslenp = i;
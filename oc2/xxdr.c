@@ -155,6 +155,102 @@ xxdr_ulonglong(XXDR* xdr, unsigned long long* llp)
    return 1;
 }
 
+/**************************************************/
+/* Bulk operations: get count consecutive array values from the
+   underlying stream with a single getbytes call, then convert the
+   whole run from network order in one tight loop (which compilers
+   can vectorize) rather than once per value through xxdr_uint etc.
+*/
+
+/* Reverse the bytes of each of count 32-bit words in place */
+static void
+xxdr_swapn32(unsigned int* ip, off_t count)
+{
+    off_t i;
+    for(i=0;i<count;i++) {
+	unsigned int v = ip[i];
+	ip[i] = (v >> 24)
+		| ((v >> 8) & 0x0000ff00U)
+		| ((v << 8) & 0x00ff0000U)
+		| (v << 24);
+    }
+}
+
+/* Reverse the bytes of each of count 64-bit words in place */
+static void
+xxdr_swapn64(unsigned long long* llp, off_t count)
+{
+    off_t i;
+    for(i=0;i<count;i++) {
+	unsigned long long v = llp[i];
+	v = ((v >> 8) & 0x00ff00ff00ff00ffULL) | ((v & 0x00ff00ff00ff00ffULL) << 8);
+	v = ((v >> 16) & 0x0000ffff0000ffffULL) | ((v & 0x0000ffff0000ffffULL) << 16);
+	llp[i] = (v >> 32) | (v << 32);
+    }
+}
+
+/* get count unsigned ints from underlying stream */
+int
+xxdr_getn_uint(XXDR* xdr, unsigned int* ip, off_t count)
+{
+    if(!ip) return 0;
+    if(!xdr->getbytes(xdr,(char*)ip,count*(off_t)sizeof(*ip)))
+	return 0;
+    if(!xxdr_network_order)
+	xxdr_swapn32(ip,count);
+    return 1;
+}
+
+/* get count unsigned shorts, each in one XDRUNIT, from underlying stream */
+int
+xxdr_getn_ushort(XXDR* xdr, unsigned short* sp, off_t count)
+{
+    unsigned int units[1024];
+    if(!sp) return 0;
+    while(count > 0) {
+	off_t i, n = (count < 1024 ? count : 1024);
+	if(!xxdr_getn_uint(xdr,units,n))
+	    return 0;
+	for(i=0;i<n;i++)
+	    sp[i] = (unsigned short)units[i];
+	sp += n;
+	count -= n;
+    }
+    return 1;
+}
+
+/* get count unsigned long longs from underlying stream */
+int
+xxdr_getn_ulonglong(XXDR* xdr, unsigned long long* llp, off_t count)
+{
+    if(!llp) return 0;
+    if(!xdr->getbytes(xdr,(char*)llp,count*(off_t)sizeof(*llp)))
+	return 0;
+    if(!xxdr_network_order)
+	xxdr_swapn64(llp,count);
+    return 1;
+}
+
+/* get count floats from underlying stream */
+int
+xxdr_getn_float(XXDR* xdr, float* fp, off_t count)
+{
+    return xxdr_getn_uint(xdr,(unsigned int*)fp,count);
+}
+
+/* get count doubles from underlying stream */
+int
+xxdr_getn_double(XXDR* xdr, double* dp, off_t count)
+{
+    if(!dp) return 0;
+    if(!xdr->getbytes(xdr,(char*)dp,count*(off_t)sizeof(*dp)))
+	return 0;
+    /* see xxdrntohdouble */
+    if(!xxdr_big_endian)
+	xxdr_swapn64((unsigned long long*)dp,count);
+    return 1;
+}
+
 /* get some bytes from underlying stream;
    will move xdrs pointer to next XDRUNIT boundary*/
 int
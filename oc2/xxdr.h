@@ -157,6 +157,14 @@ extern int xxdr_float(XXDR* , float*);
 /* get a double from underlying stream*/
 extern int xxdr_double(XXDR* , double*);
 
+/* get count consecutive values of an array from underlying stream,
+   converting them all at once */
+extern int xxdr_getn_ushort(XXDR*, unsigned short*, off_t);
+extern int xxdr_getn_uint(XXDR*, unsigned int*, off_t);
+extern int xxdr_getn_ulonglong(XXDR*, unsigned long long*, off_t);
+extern int xxdr_getn_float(XXDR*, float*, off_t);
+extern int xxdr_getn_double(XXDR*, double*, off_t);
+
 /* get some bytes from underlying stream;
    Warning: will read upto the next XDRUNIT boundary
 */